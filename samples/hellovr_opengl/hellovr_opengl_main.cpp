@@ -8,16 +8,34 @@
 #include <stdio.h>
 #include <string>
 #include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+#include <math.h>
 
 #include <openvr.h>
 
 #include <d3d11_1.h>
 
+#include "shared/dynamicresolution.h"
+#include "shared/framescheduler.h"
+#include "shared/frustumculler.h"
+#include "shared/imageloader.h"
+#include "shared/latencytracer.h"
 #include "shared/lodepng.h"
 #include "shared/Matrices.h"
 #include "shared/pathtools.h"
+#include "shared/RigidTransform.h"
+#include "shared/startupprofiler.h"
+#include "shared/tracebackend.h"
+#include "shared/tracebuffer.h"
+#include "shared/trackeddevicetable.h"
 
+#ifdef USE_NVTX
 #include "nvToolsExt.h"
+#endif
 
 #define USE_OPENVR
 //#define USE_DIRECTX_TEXTURE
@@ -33,7 +51,10 @@ BOOL (WINAPI *wglDXUnregisterObjectNV)(HANDLE hDevice, HANDLE hObject) = nullptr
 BOOL (WINAPI *wglDXLockObjectsNV)(HANDLE hDevice, GLint count, HANDLE *hObjects) = nullptr;
 BOOL (WINAPI *wglDXUnlockObjectsNV)(HANDLE hDevice, GLint count, HANDLE *hObjects) = nullptr;
 
-int NvtxRangePushColored(const char *msg, uint32_t color) {
+// NvtxRangePushColored and NvtxRangePop come from shared/tracebackend.h and
+// reach NVTX through these hooks when the nvtx backend is enabled.
+#ifdef USE_NVTX
+static void NvtxPushHook(const char *msg, uint32_t color) {
   nvtxEventAttributes_t eventAttrib = { 0 };
   eventAttrib.version = NVTX_VERSION;
   eventAttrib.size = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
@@ -41,12 +62,13 @@ int NvtxRangePushColored(const char *msg, uint32_t color) {
   eventAttrib.color = color;
   eventAttrib.messageType = NVTX_MESSAGE_TYPE_ASCII;
   eventAttrib.message.ascii = msg;
-  return ::nvtxRangePushEx(&eventAttrib);
+  ::nvtxRangePushEx(&eventAttrib);
 }
 
-void NvtxRangePop() {
+static void NvtxPopHook() {
   ::nvtxRangePop();
 }
+#endif
 
 class CGLRenderModel
 {
@@ -68,9 +90,140 @@ private:
   std::string m_sModelName;
 };
 
+//-----------------------------------------------------------------------------
+// Purpose: A persistently mapped buffer for data that changes every frame.
+//          It is split into one region per frame in flight. Vertices and
+//          uniforms are written straight into the mapping, and a region is
+//          only reused once the fence EndFrame put behind its last use has
+//          passed, so the driver never reallocates or synchronizes the buffer.
+//-----------------------------------------------------------------------------
+class CGLStreamingBuffer
+{
+public:
+  CGLStreamingBuffer();
+  ~CGLStreamingBuffer();
+
+  bool BInit( GLsizeiptr nBytesPerFrame, int nFrames );
+  void Cleanup();
+
+  /** Starts allocating from this frame's region, first waiting for the GPU to be
+  * done with the last frame that used it. Usually the frame fence has already
+  * been waited on and this doesn't block. */
+  void BeginFrame( int nFrame );
+
+  /** Fences the current region after the commands that read it */
+  void EndFrame();
+
+  /** Returns nBytes of write-only mapped memory and its offset in the buffer,
+  * or NULL if this frame's region is full */
+  void *Alloc( GLsizeiptr nBytes, GLsizeiptr nAlignment, GLintptr *pnOffset );
+
+  GLuint GetBuffer() const { return m_glBuffer; }
+
+private:
+  GLuint m_glBuffer;
+  unsigned char *m_pMapped;
+  GLsizeiptr m_nBytesPerFrame;
+  GLintptr m_nFrameEnd;
+  GLintptr m_nHead;
+  int m_nFrame;
+  std::vector< GLsync > m_vecRegionFence;                  // one per region, 0 once waited on
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Keeps linked program binaries on disk so later launches skip
+//          compiling. Entries are keyed by a hash of the shader source and
+//          of GL_RENDERER and GL_VERSION, so a new GPU or driver just misses
+//          and the programs are compiled and stored again.
+//-----------------------------------------------------------------------------
+class CGLProgramCache
+{
+public:
+  CGLProgramCache();
+
+  /** Needs a current context. Returns false, and caches nothing, if the driver
+  * has no program binary formats or the directory can't be created. */
+  bool BInit( const std::string &sDirectory );
+
+  /** Returns the linked program for this source, or 0 if it isn't cached */
+  GLuint LoadProgram( const char *pchVertexShader, const char *pchFragmentShader ) const;
+
+  /** Writes out a program linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT. Safe to call
+  * from a thread with a context that shares objects with the one BInit ran on. */
+  void StoreProgram( const char *pchVertexShader, const char *pchFragmentShader, GLuint unProgram ) const;
+
+private:
+  std::string GetFilename( const char *pchVertexShader, const char *pchFragmentShader, uint64_t *pulKey ) const;
+
+  bool m_bEnabled;
+  std::string m_sDirectory;
+  uint64_t m_ulContextHash;
+};
+
 static bool g_bPrintf = true;
 
-static const int kNumBuffers = 1;
+#ifdef HELLOVR_COUNT_ALLOCATIONS
+// Every allocation made through operator new, for the -benchmark report. Only the
+// Benchmark configuration replaces the global allocator; new[] and the sized
+// deletes forward to these.
+static std::atomic< uint64_t > g_ulHeapAllocations( 0 );
+
+void *operator new( size_t unSize )
+{
+  g_ulHeapAllocations.fetch_add( 1, std::memory_order_relaxed );
+  void *pMemory = malloc( unSize ? unSize : 1 );
+  if ( pMemory == NULL )
+    throw std::bad_alloc();
+  return pMemory;
+}
+
+void operator delete( void *pMemory ) noexcept
+{
+  free( pMemory );
+}
+#endif
+
+// Returns false in builds that don't count allocations
+static bool GetHeapAllocationCount( uint64_t *pulAllocations )
+{
+#ifdef HELLOVR_COUNT_ALLOCATIONS
+  *pulAllocations = g_ulHeapAllocations.load( std::memory_order_relaxed );
+  return true;
+#else
+  *pulAllocations = 0;
+  return false;
+#endif
+}
+
+// Coordinate frames for RigidTransform
+struct TrackingSpace {};
+struct HeadSpace {};
+struct EyeSpace {};
+
+// Sets of eye framebuffers. The CPU can record up to kNumBuffers frames
+// ahead of the GPU before it has to wait on a frame fence.
+static const int kNumBuffers = 2;
+
+// Uniform buffer binding for the per-frame matrix block. The block holds the
+// matrices of up to MATRIX_BLOCK_DEVICE_COUNT connected devices, packed in
+// CTrackedDeviceTable order rather than by device index, so it doesn't grow
+// with the device indices in use. The count is pasted into the shader source.
+static const GLuint k_unMatrixBlockBinding = 0;
+#define MATRIX_BLOCK_DEVICE_COUNT 64
+#define MATRIX_BLOCK_STRING2( x ) #x
+#define MATRIX_BLOCK_STRING( x ) MATRIX_BLOCK_STRING2( x )
+
+// Render scales -dynres moves between, relative to the recommended size. The
+// eye buffers are allocated at the largest. The scene's GPU time is held to a
+// fraction of the frame since the compositor needs the GPU too.
+static const float k_flMinRenderScale = 0.5f;
+static const float k_flMaxRenderScale = 1.4f;
+static const uint32_t k_unRenderScaleLevels = 10;
+static const double k_flSceneGpuBudgetFraction = 0.85;
+
+// -benchmark renders this many frames before it starts measuring, so shader
+// and texture uploads the driver defers don't land in the numbers.
+static const uint32_t k_unBenchmarkWarmupFrames = 30;
 
 //-----------------------------------------------------------------------------
 // Purpose:
@@ -82,10 +235,13 @@ public:
   virtual ~CMainApplication();
 
   bool BInit();
+  bool BFinishVRInit();
   bool BInitGL();
   bool BInitCompositor();
+  void ReportStartupProfile();
 
   void SetupRenderModels();
+  void FinishRenderModelLoads();
 
   void Shutdown();
 
@@ -93,10 +249,22 @@ public:
   bool HandleInput();
   void ProcessVREvent( const vr::VREvent_t & event );
   void RenderFrame();
-
+  void WaitForFrameBuffer( int nBuffer );
+  void ReportFramePipelineStats();
+  void WaitForFrameStart();
+  void ReportFrameScheduleStats();
+  void UpdateRenderScale();
+  void SetBenchmarkCameraPose( uint32_t unFrame );
+  bool RecordBenchmarkFrame();
+  void WriteBenchmarkReport();
+
+  void StartTexturemapLoads();
   bool SetupTexturemaps();
 
+  void BuildScene();
   void SetupScene();
+  void SetupSceneVertices( std::vector<float> &vertdataarray );
+  void CullScene();
   void AddCubeToScene( Matrix4 mat, std::vector<float> &vertdata );
   void AddCubeVertex( float fl0, float fl1, float fl2, float fl3, float fl4, std::vector<float> &vertdata );
 
@@ -109,34 +277,67 @@ public:
   void RenderStereoTargets();
   void RenderDistortion();
   void RenderScene( vr::Hmd_Eye nEye );
+  void RenderSceneSinglePass();
+  void DrawSceneCubes();
 
   Matrix4 GetHMDMatrixProjectionEye( vr::Hmd_Eye nEye );
-  Matrix4 GetHMDMatrixPoseEye( vr::Hmd_Eye nEye );
+  RigidTransform<EyeSpace, HeadSpace> GetHMDMatrixPoseEye( vr::Hmd_Eye nEye );
   Matrix4 GetCurrentViewProjectionMatrix( vr::Hmd_Eye nEye );
   void UpdateHMDMatrixPose();
+  void UpdateLateHMDMatrixPose();
+  void SetupTrackedDevices();
+  void SetTrackedDeviceConnected( vr::TrackedDeviceIndex_t unDevice, bool bConnected );
+  void GrowTrackedDeviceArrays();
+  void ApplyTrackedDevicePoses();
+  void UpdateMatrixBlock();
+  void UploadMatrixBlock();
 
-  Matrix4 ConvertSteamVRMatrixToMatrix4( const vr::HmdMatrix34_t &matPose );
+  static void ConvertSteamVRPosesToMatrices( const vr::TrackedDevicePose_t *pPoses, uint32_t unCount, float (*prmat4Out)[16] );
 
   GLuint CompileGLShader( const char *pchShaderName, const char *pchVertexShader, const char *pchFragmentShader );
-  bool CreateAllShaders();
+  void CreateAllShaders();
+  bool BFinishCreateAllShaders();
+  void AddShaderProgram( GLuint *punProgramID, const char *pchShaderName, const char *pchVertexShader, const char *pchFragmentShader );
+  void CompileShaderPrograms();
 
   void SetupRenderModelForTrackedDevice( vr::TrackedDeviceIndex_t unTrackedDeviceIndex );
+  CGLRenderModel *FindRenderModel( const char *pchRenderModelName );
   CGLRenderModel *FindOrLoadRenderModel( const char *pchRenderModelName );
+  CGLRenderModel *CreateRenderModel( const char *pchRenderModelName, vr::RenderModel_t *pModel, vr::RenderModel_TextureMap_t *pTexture );
 
 private: 
   bool m_bDebugOpenGL;
   bool m_bVerbose;
   bool m_bPerf;
   bool m_bVblank;
-  bool m_bGlFinishHack;
+  bool m_bGlFinishHack;                                    // with vblank, serialize CPU and GPU with glFinish instead of frame fences
+  uint32_t m_unTraceBackends;                              // ETraceBackend flags from -trace, by default all that are built in
 
   vr::IVRSystem *m_pHMD;
   vr::IVRRenderModels *m_pRenderModels;
+  std::thread m_vrInitThread;                              // runs VR_Init while the window and context are created
+  vr::EVRInitError m_eVRInitError;
   std::string m_strDriver;
   std::string m_strDisplay;
-  vr::TrackedDevicePose_t m_rTrackedDevicePose[ vr::k_unMaxTrackedDeviceCount ];
-  Matrix4 m_rmat4DevicePose[ vr::k_unMaxTrackedDeviceCount ];
-  bool m_rbShowTrackedDevice[ vr::k_unMaxTrackedDeviceCount ];
+  CTrackedDeviceTable m_trackedDevices;
+  std::vector< vr::TrackedDevicePose_t > m_vecTrackedDevicePose;   // indexed by device, for the runtime to fill
+  std::vector< vr::TrackedDevicePose_t > m_vecConnectedPoses;      // snapshot of m_trackedDevices, one per connected device
+  std::vector< vr::TrackedDeviceIndex_t > m_vecConnectedDevices;   // the device each snapshot pose is for
+  uint32_t m_unConnectedPoses;
+
+  // Every matrix the shaders need for a frame, packed with the std140 layout
+  // (mat4 array stride of 64 bytes) so it goes up in one buffer update.
+  struct MatrixBlock_t
+  {
+    float rmat4ViewProjection[ 2 ][ 16 ];   // indexed by vr::Hmd_Eye
+    float rmat4DeviceToTracking[ MATRIX_BLOCK_DEVICE_COUNT ][ 16 ];   // indexed like m_vecConnectedPoses
+  };
+  MatrixBlock_t m_matrixBlock;
+  uint32_t m_unMatrixBlockDevices;                         // device matrices in use, the rest isn't uploaded
+
+  CGLStreamingBuffer m_streamingBuffer;                    // per-frame vertices and uniforms
+  GLint m_nUniformBufferAlignment;
+  std::vector< bool > m_vecShowTrackedDevice;              // indexed by device
 
 private: // SDL bookkeeping
   SDL_Window *m_pWindow;
@@ -144,6 +345,7 @@ private: // SDL bookkeeping
   uint32_t m_nWindowHeight;
 
   SDL_GLContext m_pContext;
+  SDL_GLContext m_pShaderContext;                          // shares objects with m_pContext, for compiling off the main thread
 
 private: // OpenGL bookkeeping
   int m_iTrackedControllerCount;
@@ -151,9 +353,20 @@ private: // OpenGL bookkeeping
   int m_iValidPoseCount;
   int m_iValidPoseCount_Last;
   bool m_bShowCubes;
+  bool m_bInstancedCubes;                                  // one cube mesh drawn once per cube instead of a baked vertex array
+  bool m_bCullScene;                                       // frustum cull the instanced cubes each frame
+  bool m_bSinglePassStereo;                                // both eyes in one pass into a side by side target
+
+  uint32_t m_unDrawCalls;                                  // scene draw calls since the last stereo report
+  uint64_t m_ulSceneDrawCalls;                             // scene draw calls since startup
+  double m_flStereoCpuMs;
+  uint32_t m_unStereoStatsFrames;
+
+  CFrustumCuller m_sceneCuller;
+  CullStats_t m_cullStatsTotal;                            // summed since the last report
+  uint32_t m_unCullStatsFrames;
 
   std::string m_strPoseClasses;                            // what classes we saw poses for this frame
-  char m_rDevClassChar[ vr::k_unMaxTrackedDeviceCount ];   // for each device, a character representing its class
 
   int m_iSceneVolumeWidth;
   int m_iSceneVolumeHeight;
@@ -169,21 +382,23 @@ private: // OpenGL bookkeeping
   GLuint m_iTexture;
 
   unsigned int m_uiVertcount;
+  unsigned int m_uiInstanceCount;
 
   GLuint m_glSceneVertBuffer;
+  GLuint m_glSceneInstanceBuffer;
+  GLuint m_glSceneIndirectBuffer;
   GLuint m_unSceneVAO;
   GLuint m_unLensVAO;
   GLuint m_glIDVertBuffer;
   GLuint m_glIDIndexBuffer;
   unsigned int m_uiIndexSize;
 
-  GLuint m_glControllerVertBuffer;
   GLuint m_unControllerVAO;
   unsigned int m_uiControllerVertcount;
 
-  Matrix4 m_mat4HMDPose;
-  Matrix4 m_mat4eyePosLeft;
-  Matrix4 m_mat4eyePosRight;
+  RigidTransform<HeadSpace, TrackingSpace> m_xformHMDPose;
+  RigidTransform<EyeSpace, HeadSpace> m_xformEyePosLeft;
+  RigidTransform<EyeSpace, HeadSpace> m_xformEyePosRight;
 
   Matrix4 m_mat4ProjectionCenter;
   Matrix4 m_mat4ProjectionLeft;
@@ -204,13 +419,15 @@ private: // OpenGL bookkeeping
   };
 
   GLuint m_unSceneProgramID;
+  GLuint m_unSceneSinglePassProgramID;
   GLuint m_unLensProgramID;
   GLuint m_unControllerTransformProgramID;
   GLuint m_unRenderModelProgramID;
 
-  GLint m_nSceneMatrixLocation;
-  GLint m_nControllerMatrixLocation;
-  GLint m_nRenderModelMatrixLocation;
+  GLint m_nSceneEyeLocation;
+  GLint m_nControllerEyeLocation;
+  GLint m_nRenderModelEyeLocation;
+  GLint m_nRenderModelDeviceLocation;
 
   struct FramebufferDesc
   {
@@ -220,19 +437,103 @@ private: // OpenGL bookkeeping
   };
   FramebufferDesc leftEyeDesc[kNumBuffers];
   FramebufferDesc rightEyeDesc[kNumBuffers];
+  FramebufferDesc stereoDesc[kNumBuffers];                 // left eye in the left half, right eye in the right
   int cur_frame_buffer_;
 
+  GLsync m_rFrameFence[kNumBuffers];                       // signalled when the GPU is done with that buffer's last frame
+  GLuint m_rGpuTimerQuery[kNumBuffers];
+  bool m_rbGpuTimerPending[kNumBuffers];
+
+  struct FramePipelineStats_t
+  {
+    double flLastFrameStart;
+    double flFrameMs;
+    double flFenceWaitMs;
+    double flGpuRenderMs;
+    double flCompositorIntervalMs;
+    double flCompositorSceneGpuMs;
+    uint32_t unDroppedFrames;
+    uint32_t unFrames;
+    uint32_t unGpuSamples;
+    uint32_t unCompositorSamples;
+    uint32_t unFinishedFrames;                             // serialized with glFinish rather than fenced
+  };
+  FramePipelineStats_t m_pipelineStats;
+
+  struct ShaderProgramSource_t
+  {
+    GLuint *punProgramID;
+    const char *pchShaderName;
+    const char *pchVertexShader;
+    const char *pchFragmentShader;
+  };
+  CGLProgramCache m_programCache;
+  std::vector< ShaderProgramSource_t > m_vecUncompiledPrograms;  // cache misses, compiled by m_shaderCompileThread
+  std::thread m_shaderCompileThread;
+  uint32_t m_unShaderPrograms;
+  uint32_t m_unCachedPrograms;
+  double m_flShaderStartTime;
+
+  bool m_bJustInTimeFrameStart;                            // hold back input and pose sampling until just enough time is left
+  CFrameScheduler m_frameScheduler;
+  double m_flFrameWorkStart;                               // when this frame's input and pose sampling began
+  double m_flLastGpuRenderMs;                              // most recent GL timer query result
+  double m_flLastCompositorGpuMs;                          // most recent scene GPU time the compositor measured
+  float m_flFrameDuration;                                 // seconds between vsyncs
+  float m_flVsyncToPhotons;
+
   bool CreateFrameBuffer( int nWidth, int nHeight, FramebufferDesc &framebufferDesc );
   
-  uint32_t m_nRenderWidth;
+  uint32_t m_nRenderWidth;                                 // allocated per eye, at the largest render scale
   uint32_t m_nRenderHeight;
+  uint32_t m_nRecommendedWidth;                            // per eye at a render scale of 1
+  uint32_t m_nRecommendedHeight;
+  uint32_t m_nViewportWidth;                               // per eye at the current render scale
+  uint32_t m_nViewportHeight;
+
+  bool m_bDynamicResolution;
+  CDynamicResolution m_dynamicResolution;
+
+  bool m_bLatencyTrace;                                    // -latencytrace: follow each frame from WaitGetPoses to its present
+  CLatencyTracer m_latencyTracer;
+  uint32_t m_unLatencyFrameIndex;                          // the compositor's index for the frame being rendered
+
+  uint32_t m_unBenchmarkFrames;                            // -benchmark: frames to measure without an HMD, 0 to run normally
+  uint32_t m_unBenchmarkFrame;                             // frames rendered so far, warmup included
+  double m_flBenchmarkLastFrameEnd;
+  uint64_t m_ulBenchmarkStartDrawCalls;                    // counters as the warmup ended
+  uint64_t m_ulBenchmarkStartAllocations;
+  std::vector< double > m_vecBenchmarkFrameMs;             // reserved up front so recording doesn't allocate
+  std::vector< double > m_vecBenchmarkCpuMs;
+  std::vector< double > m_vecBenchmarkGpuMs;               // one per frame, warmup included, in frame order
 
   std::vector< CGLRenderModel * > m_vecRenderModels;
-  CGLRenderModel *m_rTrackedDeviceToRenderModel[ vr::k_unMaxTrackedDeviceCount ];
+  std::vector< CGLRenderModel * > m_vecTrackedDeviceToRenderModel;  // indexed by device
 
-  std::string present_buffer_;
-  std::string submit0_buffer_;
-  std::string submit1_buffer_;
+  // Render models the runtime reported at startup are read on another thread
+  // and turned into GL models by the first frame that finds them all loaded.
+  struct LoadedRenderModel_t
+  {
+    vr::TrackedDeviceIndex_t unTrackedDevice;
+    std::string sName;
+    vr::RenderModel_t *pModel;                             // NULL if it failed to load
+    vr::RenderModel_TextureMap_t *pTexture;
+  };
+  std::vector< LoadedRenderModel_t > m_vecLoadedRenderModels;
+  std::thread m_renderModelThread;
+  std::atomic< bool > m_bRenderModelsLoaded;
+
+  CStartupProfiler m_startupProfiler;
+  uint32_t m_unVRInitPhase;                                // phase ids set by the threads that run them
+  uint32_t m_unSceneBuildPhase;
+  uint32_t m_unShaderCompilePhase;
+
+  std::thread m_sceneBuildThread;
+  std::vector< float > m_vecSceneVertices;                 // built by m_sceneBuildThread, freed once uploaded
+  std::vector< float > m_vecSceneInstances;
+  std::unique_ptr< CImageLoader > m_pImageLoader;          // decoding the textures until SetupTexturemaps uploads them
+  std::vector< ImageRequest_t > m_vecTextureRequests;
+  std::vector< GLuint * > m_vecTextureTargets;             // where each request's texture goes
 
   // DirectX related.
   ID3D11Device* d3d_device_;
@@ -271,14 +572,21 @@ void dprintf( const char *fmt, ... )
 CMainApplication::CMainApplication( int argc, char *argv[] )
   : m_pWindow(NULL)
   , m_pContext(NULL)
+  , m_pShaderContext(NULL)
   , m_nWindowWidth( 1280 )
   , m_nWindowHeight( 720 )
   , m_unSceneProgramID( 0 )
+  , m_unSceneSinglePassProgramID( 0 )
   , m_unLensProgramID( 0 )
   , m_unControllerTransformProgramID( 0 )
   , m_unRenderModelProgramID( 0 )
   , m_pHMD( NULL )
   , m_pRenderModels( NULL )
+  , m_eVRInitError( vr::VRInitError_None )
+  , m_bRenderModelsLoaded( false )
+  , m_unVRInitPhase( CStartupProfiler::k_unInvalidPhase )
+  , m_unSceneBuildPhase( CStartupProfiler::k_unInvalidPhase )
+  , m_unShaderCompilePhase( CStartupProfiler::k_unInvalidPhase )
   , m_bDebugOpenGL( false )
   , m_bVerbose( false )
   , m_bPerf( false )
@@ -287,14 +595,18 @@ CMainApplication::CMainApplication( int argc, char *argv[] )
 #else
   , m_bVblank( true )
 #endif
-  , m_bGlFinishHack( true )
-  , m_glControllerVertBuffer( 0 )
+  , m_bGlFinishHack( false )
+  , m_unTraceBackends( UINT32_MAX )
   , m_unControllerVAO( 0 )
   , m_unLensVAO( 0 )
   , m_unSceneVAO( 0 )
-  , m_nSceneMatrixLocation( -1 )
-  , m_nControllerMatrixLocation( -1 )
-  , m_nRenderModelMatrixLocation( -1 )
+  , m_nSceneEyeLocation( -1 )
+  , m_nControllerEyeLocation( -1 )
+  , m_nRenderModelEyeLocation( -1 )
+  , m_nRenderModelDeviceLocation( -1 )
+  , m_unConnectedPoses( 0 )
+  , m_unMatrixBlockDevices( 0 )
+  , m_nUniformBufferAlignment( 256 )
   , m_iTrackedControllerCount( 0 )
   , m_iTrackedControllerCount_Last( -1 )
   , m_iValidPoseCount( 0 )
@@ -302,7 +614,36 @@ CMainApplication::CMainApplication( int argc, char *argv[] )
   , m_iSceneVolumeInit( 20 )
   , m_strPoseClasses("")
   , m_bShowCubes( true )
+  , m_bInstancedCubes( false )
+  , m_bCullScene( false )
+  , m_bSinglePassStereo( false )
+  , m_unDrawCalls( 0 )
+  , m_ulSceneDrawCalls( 0 )
+  , m_flStereoCpuMs( 0.0 )
+  , m_unStereoStatsFrames( 0 )
+  , m_unCullStatsFrames( 0 )
+  , m_uiInstanceCount( 0 )
+  , m_glSceneVertBuffer( 0 )
+  , m_glSceneInstanceBuffer( 0 )
+  , m_glSceneIndirectBuffer( 0 )
   , cur_frame_buffer_(0)
+  , m_bJustInTimeFrameStart( false )
+  , m_flFrameWorkStart( 0.0 )
+  , m_flLastGpuRenderMs( 0.0 )
+  , m_flLastCompositorGpuMs( 0.0 )
+  , m_flFrameDuration( 1.0f / 90.0f )
+  , m_flVsyncToPhotons( 0.0f )
+  , m_bDynamicResolution( false )
+  , m_bLatencyTrace( false )
+  , m_unLatencyFrameIndex( 0 )
+  , m_unBenchmarkFrames( 0 )
+  , m_unBenchmarkFrame( 0 )
+  , m_flBenchmarkLastFrameEnd( 0.0 )
+  , m_ulBenchmarkStartDrawCalls( 0 )
+  , m_ulBenchmarkStartAllocations( 0 )
+  , m_unShaderPrograms( 0 )
+  , m_unCachedPrograms( 0 )
+  , m_flShaderStartTime( 0.0 )
   , d3d_device_(nullptr)
   , d3d_context_(nullptr)
   , d3d_handle_(NULL)
@@ -326,18 +667,92 @@ CMainApplication::CMainApplication( int argc, char *argv[] )
     {
       m_bGlFinishHack = false;
     }
+    else if( !stricmp( argv[i], "-glfinishhack" ) )
+    {
+      m_bGlFinishHack = true;
+    }
     else if( !stricmp( argv[i], "-noprintf" ) )
     {
       g_bPrintf = false;
     }
+    else if( !stricmp( argv[i], "-trace" ) && ( argc > i + 1 ) && ( *argv[ i + 1 ] != '-' ) )
+    {
+      if( !Trace_ParseBackends( argv[ i + 1 ], &m_unTraceBackends ) )
+      {
+        dprintf( "Unknown -trace backend in \"%s\", expected a list of nvtx, ring, usdt or none\n", argv[ i + 1 ] );
+      }
+      i++;
+    }
     else if ( !stricmp( argv[i], "-cubevolume" ) && ( argc > i + 1 ) && ( *argv[ i + 1 ] != '-' ) )
     {
       m_iSceneVolumeInit = atoi( argv[ i + 1 ] );
       i++;
     }
+    else if( !stricmp( argv[i], "-instanced" ) )
+    {
+      m_bInstancedCubes = true;
+    }
+    else if( !stricmp( argv[i], "-cull" ) )
+    {
+      m_bCullScene = true;
+    }
+    else if( !stricmp( argv[i], "-singlepass" ) )
+    {
+      m_bSinglePassStereo = true;
+    }
+    else if( !stricmp( argv[i], "-jitframestart" ) )
+    {
+      m_bJustInTimeFrameStart = true;
+    }
+    else if( !stricmp( argv[i], "-dynres" ) )
+    {
+      m_bDynamicResolution = true;
+    }
+    else if( !stricmp( argv[i], "-latencytrace" ) )
+    {
+      m_bLatencyTrace = true;
+    }
+    else if( !stricmp( argv[i], "-benchmark" ) && ( argc > i + 1 ) && ( *argv[ i + 1 ] != '-' ) )
+    {
+      m_unBenchmarkFrames = (uint32_t)std::max( 0, atoi( argv[ i + 1 ] ) );
+      i++;
+    }
+  }
+  if( m_bCullScene && !m_bInstancedCubes )
+  {
+    dprintf( "-cull needs -instanced, not culling\n" );
+    m_bCullScene = false;
+  }
+
+  if( m_unBenchmarkFrames )
+  {
+    // nothing to hand frames to, and nothing to wait on but the GPU
+    m_bVblank = false;
+    m_bJustInTimeFrameStart = false;
+  }
+
+#ifdef USE_DIRECTX_TEXTURE
+  if( m_bSinglePassStereo )
+  {
+    dprintf( "-singlepass only submits GL textures, rendering each eye separately\n" );
+    m_bSinglePassStereo = false;
   }
+  if( m_bDynamicResolution )
+  {
+    dprintf( "-dynres only submits GL textures, rendering at a fixed resolution\n" );
+    m_bDynamicResolution = false;
+  }
+#endif
+
   // other initialization tasks are done in BInit
-  memset(m_rDevClassChar, 0, sizeof(m_rDevClassChar));
+  memset(leftEyeDesc, 0, sizeof(leftEyeDesc));
+  memset(rightEyeDesc, 0, sizeof(rightEyeDesc));
+  memset(stereoDesc, 0, sizeof(stereoDesc));
+  memset(m_rFrameFence, 0, sizeof(m_rFrameFence));
+  memset(m_rGpuTimerQuery, 0, sizeof(m_rGpuTimerQuery));
+  memset(m_rbGpuTimerPending, 0, sizeof(m_rbGpuTimerPending));
+  memset(&m_pipelineStats, 0, sizeof(m_pipelineStats));
+  memset(&m_cullStatsTotal, 0, sizeof(m_cullStatsTotal));
 
   // DirectX related.
   d3d_tex_[0] = d3d_tex_[1] = nullptr;
@@ -375,49 +790,95 @@ std::string GetTrackedDeviceString( vr::IVRSystem *pHmd, vr::TrackedDeviceIndex_
 
 
 //-----------------------------------------------------------------------------
-// Purpose:
+// Purpose: Startup runs as phases timed by m_startupProfiler. VR_Init, the
+//          scene build and texture decodes only need the command line, so
+//          they start on other threads first and are joined where their
+//          results are used.
 //-----------------------------------------------------------------------------
 bool CMainApplication::BInit()
 {
+  m_startupProfiler.Start();
+
+#ifdef USE_NVTX
+  Trace_SetNvtxHooks( NvtxPushHook, NvtxPopHook );
+#endif
+  Trace_SetBackends( m_unTraceBackends );
+  if( m_unTraceBackends != UINT32_MAX && Trace_GetBackends() != m_unTraceBackends )
+  {
+    dprintf( "Some -trace backends aren't built in, tracing to%s%s%s\n",
+      ( Trace_GetBackends() & TraceBackend_Nvtx ) ? " nvtx" : "",
+      ( Trace_GetBackends() & TraceBackend_Ring ) ? " ring" : "",
+      ( Trace_GetBackends() & TraceBackend_Usdt ) ? " usdt" : "" );
+  }
+
+  const uint32_t unSDLInitPhase = m_startupProfiler.BeginPhase( "SDL_Init" );
   if ( SDL_Init( SDL_INIT_VIDEO | SDL_INIT_TIMER ) < 0 )
   {
     printf("%s - SDL could not initialize! SDL Error: %s\n", __FUNCTION__, SDL_GetError());
     return false;
   }
+  m_startupProfiler.EndPhase( unSDLInitPhase );
 
 #ifdef USE_OPENVR
-  // Loading the SteamVR Runtime
-  vr::EVRInitError eError = vr::VRInitError_None;
-  m_pHMD = vr::VR_Init( &eError, vr::VRApplication_Scene );
-
-  if ( eError != vr::VRInitError_None )
+  // -benchmark runs without the runtime, leaving m_pHMD NULL. Nothing else
+  // touches m_pHMD or m_pRenderModels until BFinishVRInit joins this thread.
+  if ( m_unBenchmarkFrames == 0 )
   {
-    m_pHMD = NULL;
-    char buf[1024];
-    sprintf_s( buf, sizeof( buf ), "Unable to init VR runtime: %s", vr::VR_GetVRInitErrorAsEnglishDescription( eError ) );
-    SDL_ShowSimpleMessageBox( SDL_MESSAGEBOX_ERROR, "VR_Init Failed", buf, NULL );
-    return false;
-  }
-
+    m_vrInitThread = std::thread( [this, unSDLInitPhase]
+    {
+      CStartupPhaseScope phase( m_startupProfiler, "VR_Init", unSDLInitPhase );
+      m_unVRInitPhase = phase.GetPhase();
 
-  m_pRenderModels = (vr::IVRRenderModels *)vr::VR_GetGenericInterface( vr::IVRRenderModels_Version, &eError );
-  if( !m_pRenderModels )
-  {
-    m_pHMD = NULL;
-    vr::VR_Shutdown();
+      // Loading the SteamVR Runtime
+      m_pHMD = vr::VR_Init( &m_eVRInitError, vr::VRApplication_Scene );
+      if ( m_eVRInitError != vr::VRInitError_None )
+      {
+        m_pHMD = NULL;
+        return;
+      }
 
-    char buf[1024];
-    sprintf_s( buf, sizeof( buf ), "Unable to get render model interface: %s", vr::VR_GetVRInitErrorAsEnglishDescription( eError ) );
-    SDL_ShowSimpleMessageBox( SDL_MESSAGEBOX_ERROR, "VR_Init Failed", buf, NULL );
-    return false;
+      m_pRenderModels = (vr::IVRRenderModels *)vr::VR_GetGenericInterface( vr::IVRRenderModels_Version, &m_eVRInitError );
+    } );
   }
 #endif
 
+  // cube array
+  m_iSceneVolumeWidth = m_iSceneVolumeInit;
+  m_iSceneVolumeHeight = m_iSceneVolumeInit;
+  m_iSceneVolumeDepth = m_iSceneVolumeInit;
+    
+  m_fScale = 0.3f;
+  m_fScaleSpacing = 4.0f;
+ 
+  m_fNearClip = 0.1f;
+  m_fFarClip = 30.0f;
+ 
+  m_iTexture = 0;
+  m_uiVertcount = 0;
+ 
+// 		m_MillisecondsTimer.start(1, this);
+// 		m_SecondsTimer.start(1000, this);
+
+  // the CPU halves of SetupScene and SetupTexturemaps
+  m_sceneBuildThread = std::thread( [this, unSDLInitPhase]
+  {
+    CStartupPhaseScope phase( m_startupProfiler, "BuildScene", unSDLInitPhase );
+    m_unSceneBuildPhase = phase.GetPhase();
+    BuildScene();
+  } );
+  StartTexturemapLoads();
+
   int nWindowPosX = 700;
   int nWindowPosY = 100;
   m_nWindowWidth = 1280;
   m_nWindowHeight = 720;
   Uint32 unWindowFlags = SDL_WINDOW_OPENGL | SDL_WINDOW_SHOWN;
+  if ( m_unBenchmarkFrames )
+  {
+    // everything renders to the eye framebuffers, so the window only has to
+    // own the context. This runs on software GL such as Mesa's llvmpipe.
+    unWindowFlags = SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN;
+  }
 
   SDL_GL_SetAttribute( SDL_GL_CONTEXT_MAJOR_VERSION, 4 );
   SDL_GL_SetAttribute( SDL_GL_CONTEXT_MINOR_VERSION, 5 );
@@ -429,6 +890,7 @@ bool CMainApplication::BInit()
   if( m_bDebugOpenGL )
     SDL_GL_SetAttribute( SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG );
 
+  const uint32_t unWindowPhase = m_startupProfiler.BeginPhase( "CreateWindow" );
   m_pWindow = SDL_CreateWindow( "hellovr_sdl", nWindowPosX, nWindowPosY, m_nWindowWidth, m_nWindowHeight, unWindowFlags );
   if (m_pWindow == NULL)
   {
@@ -443,6 +905,17 @@ bool CMainApplication::BInit()
     return false;
   }
 
+  // Creating a context makes it current, so switch back afterwards. Without
+  // it shaders are just compiled on the main thread.
+  SDL_GL_SetAttribute( SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1 );
+  m_pShaderContext = SDL_GL_CreateContext( m_pWindow );
+  SDL_GL_SetAttribute( SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0 );
+  SDL_GL_MakeCurrent( m_pWindow, m_pContext );
+  if ( m_pShaderContext == NULL )
+  {
+    dprintf( "%s - Shared OpenGL context could not be created, compiling shaders on the main thread. SDL Error: %s\n", __FUNCTION__, SDL_GetError() );
+  }
+
   glewExperimental = GL_TRUE;
   GLenum nGlewError = glewInit();
   if (nGlewError != GLEW_OK)
@@ -457,36 +930,30 @@ bool CMainApplication::BInit()
     printf( "%s - Warning: Unable to set VSync! SDL Error: %s\n", __FUNCTION__, SDL_GetError() );
     return false;
   }
+  m_startupProfiler.EndPhase( unWindowPhase );
 
+  if ( !BFinishVRInit() )
+    return false;
 
   m_strDriver = "No Driver";
   m_strDisplay = "No Display";
 
 #ifdef USE_OPENVR
-  m_strDriver = GetTrackedDeviceString( m_pHMD, vr::k_unTrackedDeviceIndex_Hmd, vr::Prop_TrackingSystemName_String );
-  m_strDisplay = GetTrackedDeviceString( m_pHMD, vr::k_unTrackedDeviceIndex_Hmd, vr::Prop_SerialNumber_String );
+  if ( m_pHMD )
+  {
+    m_strDriver = GetTrackedDeviceString( m_pHMD, vr::k_unTrackedDeviceIndex_Hmd, vr::Prop_TrackingSystemName_String );
+    m_strDisplay = GetTrackedDeviceString( m_pHMD, vr::k_unTrackedDeviceIndex_Hmd, vr::Prop_SerialNumber_String );
+
+    const float flDisplayFrequency = m_pHMD->GetFloatTrackedDeviceProperty( vr::k_unTrackedDeviceIndex_Hmd, vr::Prop_DisplayFrequency_Float );
+    if ( flDisplayFrequency > 0.0f )
+      m_flFrameDuration = 1.0f / flDisplayFrequency;
+    m_flVsyncToPhotons = m_pHMD->GetFloatTrackedDeviceProperty( vr::k_unTrackedDeviceIndex_Hmd, vr::Prop_SecondsFromVsyncToPhotons_Float );
+  }
 #endif
 
   std::string strWindowTitle = "hellovr_sdl - " + m_strDriver + " " + m_strDisplay;
   SDL_SetWindowTitle( m_pWindow, strWindowTitle.c_str() );
   
-  // cube array
-  m_iSceneVolumeWidth = m_iSceneVolumeInit;
-  m_iSceneVolumeHeight = m_iSceneVolumeInit;
-  m_iSceneVolumeDepth = m_iSceneVolumeInit;
-    
-  m_fScale = 0.3f;
-  m_fScaleSpacing = 4.0f;
- 
-  m_fNearClip = 0.1f;
-  m_fFarClip = 30.0f;
- 
-  m_iTexture = 0;
-  m_uiVertcount = 0;
- 
-// 		m_MillisecondsTimer.start(1, this);
-// 		m_SecondsTimer.start(1000, this);
-  
   if (!BInitGL())
   {
     printf("%s - Unable to initialize OpenGL!\n", __FUNCTION__);
@@ -494,18 +961,114 @@ bool CMainApplication::BInit()
   }
 
 #ifdef USE_OPENVR
-  if (!BInitCompositor())
+  const uint32_t unCompositorPhase = m_startupProfiler.BeginPhase( "VRCompositor" );
+  if (m_pHMD && !BInitCompositor())
   {
     printf("%s - Failed to initialize VR Compositor!\n", __FUNCTION__);
     return false;
   }
+  m_startupProfiler.EndPhase( unCompositorPhase );
 #endif
 
   // This needs to be called last since it uses other member variables.
-  if (!InitDX()) {
+  // The interop it sets up only matters for submitting to the compositor.
+  const uint32_t unDXPhase = m_startupProfiler.BeginPhase( "InitDX" );
+  if (m_pHMD && !InitDX()) {
     dprintf("Failed to initialize DirectX.\n");
     return false;
   }
+  m_startupProfiler.EndPhase( unDXPhase );
+
+  if ( m_unBenchmarkFrames )
+  {
+    m_vecBenchmarkFrameMs.reserve( m_unBenchmarkFrames );
+    m_vecBenchmarkCpuMs.reserve( m_unBenchmarkFrames );
+    m_vecBenchmarkGpuMs.reserve( m_unBenchmarkFrames + k_unBenchmarkWarmupFrames );
+    dprintf( "Benchmark: %u frames after %u warmup frames on %s\n", m_unBenchmarkFrames, k_unBenchmarkWarmupFrames, (const char *)glGetString( GL_RENDERER ) );
+  }
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Logs every startup phase with its thread, when it ran and what it
+//          waited for, then the chain of phases that set the time to the
+//          first frame. Shortening anything off that chain doesn't help.
+//-----------------------------------------------------------------------------
+void CMainApplication::ReportStartupProfile()
+{
+  const std::vector< StartupPhase_t > vecPhases = m_startupProfiler.GetPhases();
+  dprintf( "Startup: first frame after %.1f ms\n", m_startupProfiler.GetElapsedMs() );
+
+  for ( size_t i = 0; i < vecPhases.size(); i++ )
+  {
+    const StartupPhase_t &phase = vecPhases[i];
+    std::string sAfter;
+    for ( size_t j = 0; j < vecPhases.size(); j++ )
+    {
+      if ( phase.ulDependencies & ( 1ull << j ) )
+      {
+        sAfter += sAfter.empty() ? " after " : ", ";
+        sAfter += vecPhases[j].pchName;
+      }
+    }
+
+    if ( phase.flEndMs < 0.0 )
+    {
+      dprintf( "  %-16s thread %u %8.1f ms -  still running%s\n", phase.pchName, phase.unThread, phase.flStartMs, sAfter.c_str() );
+    }
+    else
+    {
+      dprintf( "  %-16s thread %u %8.1f ms - %8.1f ms %8.1f ms%s\n", phase.pchName, phase.unThread, phase.flStartMs, phase.flEndMs,
+        phase.flEndMs - phase.flStartMs, sAfter.c_str() );
+    }
+  }
+
+  std::string sCriticalPath;
+  const std::vector< uint32_t > vecCriticalPath = m_startupProfiler.GetCriticalPath();
+  for ( size_t i = 0; i < vecCriticalPath.size(); i++ )
+  {
+    const StartupPhase_t &phase = vecPhases[ vecCriticalPath[i] ];
+    char rchPhase[ 128 ];
+    sprintf_s( rchPhase, sizeof( rchPhase ), "%s%s %.1f ms", i ? " > " : "", phase.pchName, phase.flEndMs - phase.flStartMs );
+    sCriticalPath += rchPhase;
+  }
+  dprintf( "Startup critical path: %s\n", sCriticalPath.c_str() );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Waits for the VR_Init BInit started and reports how it went
+//-----------------------------------------------------------------------------
+bool CMainApplication::BFinishVRInit()
+{
+  if ( !m_vrInitThread.joinable() )
+    return true;
+
+  const uint32_t unWaitPhase = m_startupProfiler.BeginPhase( "WaitForVRInit" );
+  m_vrInitThread.join();
+  m_startupProfiler.AddDependency( unWaitPhase, m_unVRInitPhase );
+  m_startupProfiler.EndPhase( unWaitPhase );
+
+  if ( m_pHMD == NULL )
+  {
+    char buf[1024];
+    sprintf_s( buf, sizeof( buf ), "Unable to init VR runtime: %s", vr::VR_GetVRInitErrorAsEnglishDescription( m_eVRInitError ) );
+    SDL_ShowSimpleMessageBox( SDL_MESSAGEBOX_ERROR, "VR_Init Failed", buf, NULL );
+    return false;
+  }
+
+  if( !m_pRenderModels )
+  {
+    m_pHMD = NULL;
+    vr::VR_Shutdown();
+
+    char buf[1024];
+    sprintf_s( buf, sizeof( buf ), "Unable to get render model interface: %s", vr::VR_GetVRInitErrorAsEnglishDescription( m_eVRInitError ) );
+    SDL_ShowSimpleMessageBox( SDL_MESSAGEBOX_ERROR, "VR_Init Failed", buf, NULL );
+    return false;
+  }
 
   return true;
 }
@@ -532,15 +1095,34 @@ bool CMainApplication::BInitGL()
     glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
   }
 
-  if( !CreateAllShaders() )
-    return false;
+  // cache misses compile on another thread while the textures and scene load
+  CreateAllShaders();
 
   SetupTexturemaps();
   SetupScene();
+
+  if( !BFinishCreateAllShaders() )
+    return false;
+
+  const uint32_t unTargetsPhase = m_startupProfiler.BeginPhase( "RenderTargets" );
+  memset( &m_matrixBlock, 0, sizeof( m_matrixBlock ) );
+  glGetIntegerv( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &m_nUniformBufferAlignment );
+  if( !m_streamingBuffer.BInit( 64 * 1024, kNumBuffers ) )
+  {
+    dprintf( "Unable to create the streaming buffer\n" );
+    return false;
+  }
+
   SetupCameras();
   SetupStereoRenderTargets();
+  glGenQueries( kNumBuffers, m_rGpuTimerQuery );
+  m_startupProfiler.EndPhase( unTargetsPhase );
+
+  const uint32_t unDistortionPhase = m_startupProfiler.BeginPhase( "SetupDistortion" );
   SetupDistortion();
+  m_startupProfiler.EndPhase( unDistortionPhase );
 
+  SetupTrackedDevices();
   SetupRenderModels();
 
   return true;
@@ -569,6 +1151,34 @@ bool CMainApplication::BInitCompositor()
 //-----------------------------------------------------------------------------
 void CMainApplication::Shutdown()
 {
+  // BInit may have failed with any of these still running
+  if( m_vrInitThread.joinable() )
+  {
+    m_vrInitThread.join();
+  }
+  if( m_sceneBuildThread.joinable() )
+  {
+    m_sceneBuildThread.join();
+  }
+  if( m_shaderCompileThread.joinable() )
+  {
+    m_shaderCompileThread.join();
+  }
+  if( m_renderModelThread.joinable() )
+  {
+    m_renderModelThread.join();
+  }
+  for( size_t i = 0; i < m_vecLoadedRenderModels.size(); i++ )
+  {
+    if( m_vecLoadedRenderModels[i].pModel )
+    {
+      m_pRenderModels->FreeRenderModel( m_vecLoadedRenderModels[i].pModel );
+      m_pRenderModels->FreeTexture( m_vecLoadedRenderModels[i].pTexture );
+    }
+  }
+  m_vecLoadedRenderModels.clear();
+  m_pImageLoader.reset();
+
   if( m_pHMD )
   {
     vr::VR_Shutdown();
@@ -586,13 +1196,20 @@ void CMainApplication::Shutdown()
     glDebugMessageControl( GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_FALSE );
     glDebugMessageCallback(nullptr, nullptr);
     glDeleteBuffers(1, &m_glSceneVertBuffer);
+    glDeleteBuffers(1, &m_glSceneInstanceBuffer);
+    glDeleteBuffers(1, &m_glSceneIndirectBuffer);
     glDeleteBuffers(1, &m_glIDVertBuffer);
     glDeleteBuffers(1, &m_glIDIndexBuffer);
+    m_streamingBuffer.Cleanup();
 
     if ( m_unSceneProgramID )
     {
       glDeleteProgram( m_unSceneProgramID );
     }
+    if ( m_unSceneSinglePassProgramID )
+    {
+      glDeleteProgram( m_unSceneSinglePassProgramID );
+    }
     if ( m_unControllerTransformProgramID )
     {
       glDeleteProgram( m_unControllerTransformProgramID );
@@ -623,8 +1240,23 @@ void CMainApplication::Shutdown()
       glDeleteTextures( 1, &rightEyeDesc[i].m_nRenderTextureId );
 #endif
       glDeleteFramebuffers( 1, &rightEyeDesc[i].m_nRenderFramebufferId );
+
+      glDeleteRenderbuffers( 1, &stereoDesc[i].m_nDepthBufferId );
+#ifdef USE_RENDERBUFFER
+      glDeleteRenderbuffers( 1, &stereoDesc[i].m_nRenderTextureId );
+#else
+      glDeleteTextures( 1, &stereoDesc[i].m_nRenderTextureId );
+#endif
+      glDeleteFramebuffers( 1, &stereoDesc[i].m_nRenderFramebufferId );
+
+      if( m_rFrameFence[i] )
+      {
+        glDeleteSync( m_rFrameFence[i] );
+      }
     }
 
+    glDeleteQueries( kNumBuffers, m_rGpuTimerQuery );
+
     if( m_unLensVAO != 0 )
     {
       glDeleteVertexArrays( 1, &m_unLensVAO );
@@ -639,23 +1271,37 @@ void CMainApplication::Shutdown()
     }
   }
 
+  if( m_pShaderContext )
+  {
+    SDL_GL_DeleteContext( m_pShaderContext );
+    m_pShaderContext = NULL;
+  }
+
   if( m_pWindow )
   {
     SDL_DestroyWindow(m_pWindow);
     m_pWindow = NULL;
   }
 
-  // Print trace messages.
-  FILE* fp;
-  fopen_s(&fp, "submit0.csv", "w");
-  fprintf(fp, "%s", submit0_buffer_.c_str());
-  fclose(fp);
-  fopen_s(&fp, "submit1.csv", "w");
-  fprintf(fp, "%s", submit1_buffer_.c_str());
-  fclose(fp);
-  fopen_s(&fp, "present.csv", "w");
-  fprintf(fp, "%s", present_buffer_.c_str());
-  fclose(fp);
+  if( m_bLatencyTrace )
+  {
+    FILE *f;
+    if( fopen_s( &f, "hellovr_latency.txt", "w" ) == 0 )
+    {
+      m_latencyTracer.WriteReport( f, true );
+      fclose( f );
+    }
+    else
+    {
+      dprintf( "Unable to write hellovr_latency.txt\n" );
+    }
+  }
+
+  // Write out the trace; open it in chrome://tracing or ui.perfetto.dev.
+  if( ( Trace_GetBackends() & TraceBackend_Ring ) && !Trace_WriteChromeJson( "hellovr_trace.json" ) )
+  {
+    dprintf( "Unable to write hellovr_trace.json\n" );
+  }
 
   SDL_Quit();
 
@@ -691,20 +1337,23 @@ bool CMainApplication::HandleInput()
   }
 
 #ifdef USE_OPENVR
+  FinishRenderModelLoads();
+
   // Process SteamVR events
   vr::VREvent_t event;
-  while( m_pHMD->PollNextEvent( &event ) )
+  while( m_pHMD && m_pHMD->PollNextEvent( &event ) )
   {
     ProcessVREvent( event );
   }
 
   // Process SteamVR controller state
-  for( vr::TrackedDeviceIndex_t unDevice = 0; unDevice < vr::k_unMaxTrackedDeviceCount; unDevice++ )
+  for( uint32_t unConnected = 0; m_pHMD && unConnected < m_trackedDevices.GetConnectedCount(); unConnected++ )
   {
+    const vr::TrackedDeviceIndex_t unDevice = m_trackedDevices.GetConnectedDevice( unConnected );
     vr::VRControllerState_t state;
     if( m_pHMD->GetControllerState( unDevice, &state ) )
     {
-      m_rbShowTrackedDevice[ unDevice ] = state.ulButtonPressed == 0;
+      m_vecShowTrackedDevice[ unDevice ] = state.ulButtonPressed == 0;
     }
   }
 #endif
@@ -722,13 +1371,31 @@ void CMainApplication::RunMainLoop()
   SDL_StartTextInput();
   SDL_ShowCursor( SDL_DISABLE );
 
+  const uint32_t unFirstFramePhase = m_startupProfiler.BeginPhase( "FirstFrame" );
+  bool bFirstFrame = true;
+
   while ( !bQuit )
   {
+    WaitForFrameStart();
+
     bQuit = HandleInput();
 
     RenderFrame();
+
+    if ( bFirstFrame )
+    {
+      m_startupProfiler.EndPhase( unFirstFramePhase );
+      ReportStartupProfile();
+      bFirstFrame = false;
+    }
+
+    if ( m_unBenchmarkFrames && RecordBenchmarkFrame() )
+      bQuit = true;
   }
 
+  if ( m_unBenchmarkFrames )
+    WriteBenchmarkReport();
+
   SDL_StopTextInput();
 }
 
@@ -742,12 +1409,14 @@ void CMainApplication::ProcessVREvent( const vr::VREvent_t & event )
   {
   case vr::VREvent_TrackedDeviceActivated:
     {
+      SetTrackedDeviceConnected( event.trackedDeviceIndex, true );
       SetupRenderModelForTrackedDevice( event.trackedDeviceIndex );
       dprintf( "Device %u attached. Setting up render model.\n", event.trackedDeviceIndex );
     }
     break;
   case vr::VREvent_TrackedDeviceDeactivated:
     {
+      SetTrackedDeviceConnected( event.trackedDeviceIndex, false );
       dprintf( "Device %u detached.\n", event.trackedDeviceIndex );
     }
     break;
@@ -772,38 +1441,27 @@ void SleepNMilliseconds(double n) {
   while (GetTimestampInSeconds() - start < n * 0.001);
 }
 
-static const double kAppStartTimeInSeconds = GetTimestampInSeconds();
-
-class ScopedTimer {
- public:
-  ScopedTimer(std::string& buffer, const char* name)
-    : start_time_(GetTimestampInSeconds()), buffer_(buffer), name_(name) {
-    NvtxRangePushColored(name, 0xFFcccc00);
-  }
-  ~ScopedTimer() {
-    const double now = GetTimestampInSeconds();
-    const double duration_in_ms = (now - start_time_) * 1000.0;
-    const double timestamp_in_ms = (now - kAppStartTimeInSeconds) * 1000.0;
-    buffer_ += std::to_string(timestamp_in_ms) + ", " + std::to_string(duration_in_ms) + "\n";
-    NvtxRangePop();
-  }
-
- private:
-  double start_time_;
-  std::string& buffer_;
-  std::string name_;
-};
-
 //-----------------------------------------------------------------------------
 // Purpose:
 //-----------------------------------------------------------------------------
 void CMainApplication::RenderFrame()
 {
   NvtxRangePushColored("RenderFrame", 0xFFAA0000);
+
+  // the buffers we are about to render into may still be in flight
+  WaitForFrameBuffer( cur_frame_buffer_ );
+  m_streamingBuffer.BeginFrame( cur_frame_buffer_ );
+  UploadMatrixBlock();
+
   // for now as fast as possible
-  //DrawControllers();
+  DrawControllers();
+  UpdateRenderScale();
+  glBeginQuery( GL_TIME_ELAPSED, m_rGpuTimerQuery[cur_frame_buffer_] );
+  CullScene();
   RenderStereoTargets();
   //RenderDistortion();
+  glEndQuery( GL_TIME_ELAPSED );
+  m_rbGpuTimerPending[cur_frame_buffer_] = true;
 
   // TODO: try sleep 3ms before submitting and see if Submit() still stalls.
   //SleepNMilliseconds(3.0);
@@ -820,7 +1478,7 @@ void CMainApplication::RenderFrame()
   //glFlush();
 
   /*{
-    ScopedTimer timer(present_buffer_, "Test");
+    TRACE_RANGE( "Test", 0xFFcccc00 );
     GLuint texs[2] = {
       leftEyeDesc[cur_frame_buffer_].m_nRenderTextureId,
       rightEyeDesc[cur_frame_buffer_].m_nRenderTextureId
@@ -840,27 +1498,48 @@ void CMainApplication::RenderFrame()
 #ifdef USE_DIRECTX_TEXTURE
   vr::Texture_t leftEyeTexture = {(void*)d3d_tex_[0], vr::API_DirectX, vr::ColorSpace_Gamma};
 #else
-  vr::Texture_t leftEyeTexture = {(void*)leftEyeDesc[cur_frame_buffer_].m_nRenderTextureId, vr::API_OpenGL, vr::ColorSpace_Gamma};
+  const FramebufferDesc &leftSubmitDesc = m_bSinglePassStereo ? stereoDesc[cur_frame_buffer_] : leftEyeDesc[cur_frame_buffer_];
+  vr::Texture_t leftEyeTexture = {(void*)leftSubmitDesc.m_nRenderTextureId, vr::API_OpenGL, vr::ColorSpace_Gamma};
 #endif
+  // Each eye's image sits in the bottom left of its texture, or of its half
+  // of the single pass texture, and covers the current viewport.
+  const float flBoundsU = (float)m_nViewportWidth / m_nRenderWidth;
+  const float flBoundsV = (float)m_nViewportHeight / m_nRenderHeight;
+  const float flBoundsScaleU = m_bSinglePassStereo ? 0.5f : 1.0f;
+  const vr::VRTextureBounds_t leftEyeBounds = { 0.0f, 0.0f, flBoundsU * flBoundsScaleU, flBoundsV };
+  const vr::VRTextureBounds_t rightEyeBounds = { m_bSinglePassStereo ? flBoundsU * 0.5f : 0.0f, 0.0f, flBoundsU, flBoundsV };
+  const bool bSubmitBounds = m_bSinglePassStereo || m_bDynamicResolution;
   {
-    ScopedTimer timer(submit0_buffer_, "Submit0");
+    TRACE_RANGE( "Submit0", 0xFFcccc00 );
     //glColor3b(100, 100, 0); // This is for gDEBugger
-    vr::VRCompositor()->Submit(vr::Eye_Left, &leftEyeTexture, nullptr, submit_flag);
+    if (m_pHMD)
+      vr::VRCompositor()->Submit(vr::Eye_Left, &leftEyeTexture, bSubmitBounds ? &leftEyeBounds : nullptr, submit_flag);
   }
 
   //dprintf("Submit right eye: %d\n", rightEyeDesc[cur_frame_buffer_].m_nResolveTextureId);
 #ifdef USE_DIRECTX_TEXTURE
   vr::Texture_t rightEyeTexture = {(void*)d3d_tex_[1], vr::API_DirectX, vr::ColorSpace_Gamma};
 #else
-  vr::Texture_t rightEyeTexture = {(void*)rightEyeDesc[cur_frame_buffer_].m_nRenderTextureId, vr::API_OpenGL, vr::ColorSpace_Gamma};
+  const FramebufferDesc &rightSubmitDesc = m_bSinglePassStereo ? stereoDesc[cur_frame_buffer_] : rightEyeDesc[cur_frame_buffer_];
+  vr::Texture_t rightEyeTexture = {(void*)rightSubmitDesc.m_nRenderTextureId, vr::API_OpenGL, vr::ColorSpace_Gamma};
 #endif
   {
-    ScopedTimer timer(submit1_buffer_, "Submit1");
+    TRACE_RANGE( "Submit1", 0xFFcccc00 );
     //glColor3b(100, 100, 1);
-    vr::VRCompositor()->Submit(vr::Eye_Right, &rightEyeTexture, nullptr, submit_flag);
+    if (m_pHMD)
+      vr::VRCompositor()->Submit(vr::Eye_Right, &rightEyeTexture, bSubmitBounds ? &rightEyeBounds : nullptr, submit_flag);
   }
+  if ( m_bLatencyTrace && m_pHMD )
+    m_latencyTracer.Submitted( m_unLatencyFrameIndex, Trace_GetTimestamp() );
 #endif
 
+  if ( m_bJustInTimeFrameStart )
+  {
+    // the GPU times lag a frame or two behind, which is fine for a running estimate
+    const double flCpuMs = ( GetTimestampInSeconds() - m_flFrameWorkStart ) * 1000.0;
+    m_frameScheduler.AddFrameCost( flCpuMs, std::max( m_flLastGpuRenderMs, m_flLastCompositorGpuMs ) );
+  }
+
   if ( m_bVblank && m_bGlFinishHack )
   {
     //$ HACKHACK. From gpuview profiling, it looks like there is a bug where two renders and a present
@@ -885,12 +1564,26 @@ void CMainApplication::RenderFrame()
     glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
   }
 
-  // Flush and wait for swap.
-  if ( m_bVblank )
+  // Flush and wait for swap. -glfinishhack only finishes with vblank on;
+  // every other frame gets a fence, or nothing would keep the CPU from
+  // overwriting buffers the GPU is still reading.
+  const bool bFinished = m_bVblank && m_bGlFinishHack;
+  m_pipelineStats.unFinishedFrames += bFinished ? 1 : 0;
+  m_streamingBuffer.EndFrame();
+  if ( bFinished )
   {
     glFlush();
     glFinish();
   }
+  else
+  {
+    // Let the GPU run behind. We only wait for this frame when its
+    // framebuffers come round again.
+    m_rFrameFence[cur_frame_buffer_] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+    glFlush();
+  }
+
+  ReportFramePipelineStats();
 
   // Spew out the controller and pose count whenever they change.
   if ( m_iTrackedControllerCount != m_iTrackedControllerCount_Last || m_iValidPoseCount != m_iValidPoseCount_Last )
@@ -909,6 +1602,366 @@ void CMainApplication::RenderFrame()
 }
 
 
+//-----------------------------------------------------------------------------
+// Purpose: Blocks until the GPU has finished the last frame that rendered into
+//          this set of framebuffers, then collects that frame's GPU time
+//-----------------------------------------------------------------------------
+void CMainApplication::WaitForFrameBuffer( int nBuffer )
+{
+  if( m_rFrameFence[nBuffer] )
+  {
+    NvtxRangePushColored( "WaitForFrameBuffer", 0xFF808080 );
+    const double flStartTime = GetTimestampInSeconds();
+
+    GLenum eResult;
+    do
+    {
+      eResult = glClientWaitSync( m_rFrameFence[nBuffer], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000 ); // 1ms
+    } while( eResult == GL_TIMEOUT_EXPIRED );
+
+    if( eResult == GL_WAIT_FAILED )
+    {
+      dprintf( "Frame fence wait failed for buffer %d\n", nBuffer );
+    }
+    glDeleteSync( m_rFrameFence[nBuffer] );
+    m_rFrameFence[nBuffer] = 0;
+
+    m_pipelineStats.flFenceWaitMs += ( GetTimestampInSeconds() - flStartTime ) * 1000.0;
+    NvtxRangePop();
+  }
+
+  // the fence (or glFinish) has passed, so this doesn't stall
+  if( m_rbGpuTimerPending[nBuffer] )
+  {
+    GLuint64 unElapsedNs = 0;
+    glGetQueryObjectui64v( m_rGpuTimerQuery[nBuffer], GL_QUERY_RESULT, &unElapsedNs );
+    m_flLastGpuRenderMs = unElapsedNs / 1000000.0;
+    m_pipelineStats.flGpuRenderMs += m_flLastGpuRenderMs;
+    if( m_unBenchmarkFrames && m_vecBenchmarkGpuMs.size() < m_vecBenchmarkGpuMs.capacity() )
+    {
+      m_vecBenchmarkGpuMs.push_back( m_flLastGpuRenderMs );
+    }
+    m_pipelineStats.unGpuSamples++;
+    m_rbGpuTimerPending[nBuffer] = false;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Every 90 frames, logs how long each frame took, how much of that
+//          the CPU spent blocked on the GPU and what the compositor measured.
+//          A fence wait well below the GPU time means CPU and GPU overlapped.
+//-----------------------------------------------------------------------------
+void CMainApplication::ReportFramePipelineStats()
+{
+  const double flNow = GetTimestampInSeconds();
+  if( m_pipelineStats.flLastFrameStart > 0.0 )
+  {
+    m_pipelineStats.flFrameMs += ( flNow - m_pipelineStats.flLastFrameStart ) * 1000.0;
+  }
+  m_pipelineStats.flLastFrameStart = flNow;
+
+#ifdef USE_OPENVR
+  vr::Compositor_FrameTiming timing;
+  timing.size = sizeof( vr::Compositor_FrameTiming );
+  if( m_pHMD && vr::VRCompositor()->GetFrameTiming( &timing, 0 ) )
+  {
+    m_pipelineStats.flCompositorIntervalMs += timing.m_flFrameIntervalMs;
+    m_pipelineStats.flCompositorSceneGpuMs += timing.m_flSceneRenderGpuMs;
+    m_flLastCompositorGpuMs = timing.m_flSceneRenderGpuMs;
+    m_pipelineStats.unDroppedFrames += timing.droppedFrames;
+    m_pipelineStats.unCompositorSamples++;
+  }
+
+  // A few frames back the compositor is done with a frame. frameStart is in
+  // seconds of the performance counter, the clock Trace_GetTimestamp reads.
+  if( m_bLatencyTrace && m_pHMD && vr::VRCompositor()->GetFrameTiming( &timing, 3 ) && timing.m_nPresents > 0 )
+  {
+    m_latencyTracer.Presented( timing.frameIndex, (uint64_t)( ( timing.frameStart + timing.frameVSync ) * Trace_GetTimestampFrequency() ) );
+  }
+#endif
+
+  if( ++m_pipelineStats.unFrames < 90 )
+    return;
+
+  const uint32_t unFrames = m_pipelineStats.unFrames;
+  const uint32_t unGpuSamples = std::max< uint32_t >( 1, m_pipelineStats.unGpuSamples );
+  const uint32_t unCompositorSamples = std::max< uint32_t >( 1, m_pipelineStats.unCompositorSamples );
+  const char *pchSync = m_pipelineStats.unFinishedFrames == 0 ? "fenced" : m_pipelineStats.unFinishedFrames == unFrames ? "glFinish" : "mixed";
+  dprintf( "Pipeline (%s): frame %.2f ms, fence wait %.2f ms, GPU render %.2f ms; compositor interval %.2f ms, scene GPU %.2f ms, %u dropped\n",
+    pchSync,
+    m_pipelineStats.flFrameMs / unFrames, m_pipelineStats.flFenceWaitMs / unFrames, m_pipelineStats.flGpuRenderMs / unGpuSamples,
+    m_pipelineStats.flCompositorIntervalMs / unCompositorSamples, m_pipelineStats.flCompositorSceneGpuMs / unCompositorSamples,
+    m_pipelineStats.unDroppedFrames );
+
+  const double flLastFrameStart = m_pipelineStats.flLastFrameStart;
+  memset( &m_pipelineStats, 0, sizeof( m_pipelineStats ) );
+  m_pipelineStats.flLastFrameStart = flLastFrameStart;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: With -jitframestart, waits out whatever part of the frame the
+//          scheduler doesn't expect to need, then predicts the poses again
+//          so input and poses are as fresh as the frame's cost allows
+//-----------------------------------------------------------------------------
+void CMainApplication::WaitForFrameStart()
+{
+  m_flFrameWorkStart = GetTimestampInSeconds();
+
+#ifdef USE_OPENVR
+  if ( !m_bJustInTimeFrameStart || !m_pHMD )
+    return;
+
+  const double flRemainingMs = vr::VRCompositor()->GetFrameTimeRemaining() * 1000.0;
+  const double flDelayMs = m_frameScheduler.GetStartDelayMs( flRemainingMs );
+  if ( flDelayMs > 0.0 )
+  {
+    NvtxRangePushColored( "WaitForFrameStart", 0xFF404040 );
+
+    // SDL_Delay can oversleep by a millisecond or more, so spin for the tail
+    const double flWakeTime = m_flFrameWorkStart + flDelayMs * 0.001;
+    if ( flDelayMs > 2.0 )
+      SDL_Delay( (Uint32)( flDelayMs - 2.0 ) );
+    SleepNMilliseconds( ( flWakeTime - GetTimestampInSeconds() ) * 1000.0 );
+
+    NvtxRangePop();
+
+    UpdateLateHMDMatrixPose();
+    m_flFrameWorkStart = GetTimestampInSeconds();
+  }
+
+  ReportFrameScheduleStats();
+#endif
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Every 90 frames, logs how often and by how much the frame start
+//          was delayed and how the predicted cost held up
+//-----------------------------------------------------------------------------
+void CMainApplication::ReportFrameScheduleStats()
+{
+  const FrameScheduleStats_t &stats = m_frameScheduler.GetStats();
+  if ( stats.unFrames < 90 )
+    return;
+
+  const uint32_t unDelayedFrames = std::max< uint32_t >( 1, stats.unDelayedFrames );
+  dprintf( "Frame start: %u/%u frames delayed by %.2f ms, predicted cost %.2f ms, measured %.2f ms, %u over budget\n",
+    stats.unDelayedFrames, stats.unFrames, stats.flDelayMs / unDelayedFrames,
+    stats.flPredictedMs / unDelayedFrames, stats.flMeasuredMs / unDelayedFrames, stats.unOverBudgetFrames );
+
+  m_frameScheduler.ResetStats();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: With -dynres, feeds the last scene GPU time to the resolution
+//          controller and sizes this frame's eye viewports from its scale
+//-----------------------------------------------------------------------------
+void CMainApplication::UpdateRenderScale()
+{
+  if ( !m_bDynamicResolution )
+    return;
+
+  // the compositor's measurement covers all of the scene's GPU work; without
+  // it fall back to the timer query around our own rendering
+  const double flGpuMs = m_flLastCompositorGpuMs > 0.0 ? m_flLastCompositorGpuMs : m_flLastGpuRenderMs;
+  if ( flGpuMs > 0.0 && m_dynamicResolution.Update( flGpuMs ) && m_pHMD )
+  {
+    m_pHMD->PerformanceTestReportFidelityLevelChange( m_dynamicResolution.GetLevel() );
+  }
+
+  const float flScale = m_dynamicResolution.GetScale();
+  m_nViewportWidth = std::min< uint32_t >( m_nRenderWidth, (uint32_t)( m_nRecommendedWidth * flScale + 0.5f ) );
+  m_nViewportHeight = std::min< uint32_t >( m_nRenderHeight, (uint32_t)( m_nRecommendedHeight * flScale + 0.5f ) );
+
+  const ResolutionStats_t &stats = m_dynamicResolution.GetStats();
+  if ( stats.unFrames < 90 )
+    return;
+
+  dprintf( "Resolution: %.2f scale average, now %.2f (%ux%u per eye); scene GPU %.2f ms of %.2f ms budget, %u levels down, %u up\n",
+    stats.flScale / stats.unFrames, flScale, m_nViewportWidth, m_nViewportHeight,
+    stats.flGpuMs / stats.unFrames, m_flFrameDuration * 1000.0 * k_flSceneGpuBudgetFraction,
+    stats.unLevelsDown, stats.unLevelsUp );
+  m_dynamicResolution.ResetStats();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Stands in for the HMD pose under -benchmark. The camera turns a
+//          full circle every 360 frames from the middle of the cube volume
+//          while nodding 20 degrees, so every run renders the same views.
+//-----------------------------------------------------------------------------
+void CMainApplication::SetBenchmarkCameraPose( uint32_t unFrame )
+{
+  const float flPi = 3.14159265f;
+  const float flYaw = ( unFrame % 360 ) * ( 2.0f * flPi / 360.0f );
+  const float flPitch = sinf( ( unFrame % 180 ) * ( 2.0f * flPi / 180.0f ) ) * ( 20.0f * flPi / 180.0f );
+  const float flCosYaw = cosf( flYaw ), flSinYaw = sinf( flYaw );
+  const float flCosPitch = cosf( flPitch ), flSinPitch = sinf( flPitch );
+
+  // head to tracking space: pitch about x, then yaw about y
+  const vr::HmdMatrix34_t matHeadToTracking = { {
+    { flCosYaw, flSinYaw * flSinPitch, flSinYaw * flCosPitch, 0.0f },
+    { 0.0f, flCosPitch, -flSinPitch, 0.0f },
+    { -flSinYaw, flCosYaw * flSinPitch, flCosYaw * flCosPitch, 0.0f } } };
+  m_xformHMDPose = RigidTransform<TrackingSpace, HeadSpace>::fromHmdMatrix34( matHeadToTracking ).inverse();
+
+  UpdateMatrixBlock();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Under -benchmark, records the frame that just finished. Returns
+//          true once every measured frame is in and its GPU time collected.
+//-----------------------------------------------------------------------------
+bool CMainApplication::RecordBenchmarkFrame()
+{
+  const double flNow = GetTimestampInSeconds();
+  if ( m_unBenchmarkFrame >= k_unBenchmarkWarmupFrames )
+  {
+    m_vecBenchmarkFrameMs.push_back( ( flNow - m_flBenchmarkLastFrameEnd ) * 1000.0 );
+    // input, culling, rendering and any frame fence wait, but not the GPU's work itself
+    m_vecBenchmarkCpuMs.push_back( ( flNow - m_flFrameWorkStart ) * 1000.0 );
+  }
+  m_flBenchmarkLastFrameEnd = flNow;
+
+  if ( ++m_unBenchmarkFrame == k_unBenchmarkWarmupFrames )
+  {
+    m_ulBenchmarkStartDrawCalls = m_ulSceneDrawCalls;
+    GetHeapAllocationCount( &m_ulBenchmarkStartAllocations );
+  }
+
+  if ( m_unBenchmarkFrame < k_unBenchmarkWarmupFrames + m_unBenchmarkFrames )
+    return false;
+
+  // the last frames' timer queries are still in flight; collect them oldest first
+  for ( int i = 0; i < kNumBuffers; i++ )
+  {
+    WaitForFrameBuffer( ( cur_frame_buffer_ + i ) % kNumBuffers );
+  }
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Writes one "name": { ... } member of the benchmark report
+//-----------------------------------------------------------------------------
+static void WriteBenchmarkMetric( FILE *f, const char *pchName, std::vector< double > vecSamples )
+{
+  if ( vecSamples.empty() )
+  {
+    fprintf( f, "  \"%s\": null,\n", pchName );
+    return;
+  }
+
+  std::sort( vecSamples.begin(), vecSamples.end() );
+  double flTotal = 0.0;
+  for ( size_t i = 0; i < vecSamples.size(); i++ )
+  {
+    flTotal += vecSamples[i];
+  }
+
+  // nearest rank
+  const auto Percentile = [&vecSamples]( double flFraction )
+  {
+    const size_t nRank = (size_t)ceil( flFraction * vecSamples.size() );
+    return vecSamples[ std::min( vecSamples.size() - 1, nRank > 0 ? nRank - 1 : 0 ) ];
+  };
+
+  fprintf( f, "  \"%s\": { \"mean\": %.4f, \"min\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f },\n",
+    pchName, flTotal / vecSamples.size(), vecSamples.front(), Percentile( 0.5 ), Percentile( 0.95 ), Percentile( 0.99 ), vecSamples.back() );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Writes hellovr_benchmark.json with the measured frames' timings,
+//          draw calls and heap allocations, and logs a one line summary
+//-----------------------------------------------------------------------------
+void CMainApplication::WriteBenchmarkReport()
+{
+  // before anything below allocates
+  uint64_t ulAllocations = 0;
+  const bool bCountedAllocations = GetHeapAllocationCount( &ulAllocations );
+  ulAllocations -= m_ulBenchmarkStartAllocations;
+  const uint64_t ulDrawCalls = m_ulSceneDrawCalls - m_ulBenchmarkStartDrawCalls;
+
+  const uint32_t unFrames = (uint32_t)m_vecBenchmarkFrameMs.size();
+  if ( unFrames == 0 )
+  {
+    dprintf( "Benchmark: stopped before any frames were measured\n" );
+    return;
+  }
+
+  std::vector< double > vecGpuMs( m_vecBenchmarkGpuMs );
+  vecGpuMs.erase( vecGpuMs.begin(), vecGpuMs.begin() + std::min< size_t >( vecGpuMs.size(), k_unBenchmarkWarmupFrames ) );
+
+  FILE *f = NULL;
+  if ( fopen_s( &f, "hellovr_benchmark.json", "w" ) != 0 || f == NULL )
+  {
+    dprintf( "Unable to write hellovr_benchmark.json\n" );
+    return;
+  }
+
+  // GL strings don't carry quotes or backslashes in practice; drop them if one does
+  std::string sRenderer = (const char *)glGetString( GL_RENDERER );
+  std::string sVersion = (const char *)glGetString( GL_VERSION );
+  for ( std::string *pString : { &sRenderer, &sVersion } )
+  {
+    pString->erase( std::remove_if( pString->begin(), pString->end(), []( char ch ) { return ch == '"' || ch == '\\'; } ), pString->end() );
+  }
+
+  fprintf( f, "{\n" );
+  fprintf( f, "  \"renderer\": \"%s\",\n", sRenderer.c_str() );
+  fprintf( f, "  \"version\": \"%s\",\n", sVersion.c_str() );
+  fprintf( f, "  \"frames\": %u,\n", unFrames );
+  fprintf( f, "  \"warmup_frames\": %u,\n", k_unBenchmarkWarmupFrames );
+  fprintf( f, "  \"cube_volume\": %d,\n", m_iSceneVolumeInit );
+  fprintf( f, "  \"eye_width\": %u,\n", m_nViewportWidth );
+  fprintf( f, "  \"eye_height\": %u,\n", m_nViewportHeight );
+  fprintf( f, "  \"instanced\": %s,\n", m_bInstancedCubes ? "true" : "false" );
+  fprintf( f, "  \"cull\": %s,\n", m_bCullScene ? "true" : "false" );
+  fprintf( f, "  \"singlepass\": %s,\n", m_bSinglePassStereo ? "true" : "false" );
+  fprintf( f, "  \"dynres\": %s,\n", m_bDynamicResolution ? "true" : "false" );
+  fprintf( f, "  \"glfinishhack\": %s,\n", m_bGlFinishHack ? "true" : "false" );
+  WriteBenchmarkMetric( f, "frame_ms", m_vecBenchmarkFrameMs );
+  WriteBenchmarkMetric( f, "cpu_ms", m_vecBenchmarkCpuMs );
+  WriteBenchmarkMetric( f, "gpu_ms", vecGpuMs );
+  fprintf( f, "  \"draw_calls\": %llu,\n", (unsigned long long)ulDrawCalls );
+  fprintf( f, "  \"draw_calls_per_frame\": %.2f,\n", (double)ulDrawCalls / unFrames );
+  if ( bCountedAllocations )
+  {
+    fprintf( f, "  \"allocations\": %llu,\n", (unsigned long long)ulAllocations );
+    fprintf( f, "  \"allocations_per_frame\": %.2f\n", (double)ulAllocations / unFrames );
+  }
+  else
+  {
+    // not a Benchmark configuration build
+    fprintf( f, "  \"allocations\": null,\n" );
+    fprintf( f, "  \"allocations_per_frame\": null\n" );
+  }
+  fprintf( f, "}\n" );
+  fclose( f );
+
+  double flFrameMs = 0.0;
+  for ( size_t i = 0; i < m_vecBenchmarkFrameMs.size(); i++ )
+  {
+    flFrameMs += m_vecBenchmarkFrameMs[i];
+  }
+  if ( bCountedAllocations )
+  {
+    dprintf( "Benchmark: %u frames, %.2f ms per frame, %.2f draw calls and %.2f allocations per frame; wrote hellovr_benchmark.json\n",
+      unFrames, flFrameMs / unFrames, (double)ulDrawCalls / unFrames, (double)ulAllocations / unFrames );
+  }
+  else
+  {
+    dprintf( "Benchmark: %u frames, %.2f ms per frame, %.2f draw calls per frame, allocations not counted; wrote hellovr_benchmark.json\n",
+      unFrames, flFrameMs / unFrames, (double)ulDrawCalls / unFrames );
+  }
+}
+
+
 //-----------------------------------------------------------------------------
 // Purpose: Compiles a GL shader program and returns the handle. Returns 0 if
 //			the shader couldn't be compiled for some reason.
@@ -950,6 +2003,7 @@ GLuint CMainApplication::CompileGLShader( const char *pchShaderName, const char
   glAttachShader( unProgramID, nSceneFragmentShader );
   glDeleteShader( nSceneFragmentShader ); // the program hangs onto this once it's attached
 
+  glProgramParameteri( unProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
   glLinkProgram( unProgramID );
 
   GLint programSuccess = GL_TRUE;
@@ -969,24 +2023,77 @@ GLuint CMainApplication::CompileGLShader( const char *pchShaderName, const char
 
 
 //-----------------------------------------------------------------------------
-// Purpose: Creates all the shaders used by HelloVR SDL
+// Purpose: Creates all the shaders used by HelloVR SDL. Programs come from
+//          the program cache when they can; the rest are compiled on
+//          m_shaderCompileThread, see BFinishCreateAllShaders.
 //-----------------------------------------------------------------------------
-bool CMainApplication::CreateAllShaders()
+void CMainApplication::CreateAllShaders()
 {
-  m_unSceneProgramID = CompileGLShader( 
+  CStartupPhaseScope createPhase( m_startupProfiler, "CreateShaders" );
+  m_flShaderStartTime = GetTimestampInSeconds();
+  if( !m_programCache.BInit( Path_Join( Path_StripFilename( Path_GetExecutablePath() ), "shadercache" ) ) )
+  {
+    dprintf( "Program cache unavailable, compiling every shader\n" );
+  }
+
+  AddShaderProgram( &m_unSceneProgramID, 
     "Scene",
 
     // Vertex Shader
     "#version 410\n"
-    "uniform mat4 matrix;\n"
+    "layout(std140) uniform MatrixBlock\n"
+    "{\n"
+    "	mat4 viewProjection[2];\n"
+    "	mat4 deviceToTracking[" MATRIX_BLOCK_STRING( MATRIX_BLOCK_DEVICE_COUNT ) "];\n"
+    "};\n"
+    "uniform int eyeIndex;\n"
     "layout(location = 0) in vec4 position;\n"
     "layout(location = 1) in vec2 v2UVcoordsIn;\n"
     "layout(location = 2) in vec3 v3NormalIn;\n"
+    "layout(location = 3) in vec4 v4InstanceIn;\n"	// xyz offset, w scale
     "out vec2 v2UVcoords;\n"
     "void main()\n"
     "{\n"
     "	v2UVcoords = v2UVcoordsIn;\n"
-    "	gl_Position = matrix * position;\n"
+    "	gl_Position = viewProjection[eyeIndex] * vec4(v4InstanceIn.w * position.xyz + v4InstanceIn.xyz, 1);\n"
+    "}\n",
+
+    // Fragment Shader
+    "#version 410 core\n"
+    "uniform sampler2D mytexture;\n"
+    "in vec2 v2UVcoords;\n"
+    "out vec4 outputColor;\n"
+    "void main()\n"
+    "{\n"
+    "   outputColor = texture(mytexture, v2UVcoords);\n"
+    "}\n"
+    );
+
+  // Draws every instance twice, even instances for the left eye and odd for
+  // the right, and squeezes each eye into its half of a side by side target
+  AddShaderProgram( &m_unSceneSinglePassProgramID, 
+    "SceneSinglePass",
+
+    // Vertex Shader
+    "#version 410\n"
+    "layout(std140) uniform MatrixBlock\n"
+    "{\n"
+    "	mat4 viewProjection[2];\n"
+    "	mat4 deviceToTracking[" MATRIX_BLOCK_STRING( MATRIX_BLOCK_DEVICE_COUNT ) "];\n"
+    "};\n"
+    "layout(location = 0) in vec4 position;\n"
+    "layout(location = 1) in vec2 v2UVcoordsIn;\n"
+    "layout(location = 2) in vec3 v3NormalIn;\n"
+    "layout(location = 3) in vec4 v4InstanceIn;\n"	// xyz offset, w scale
+    "out vec2 v2UVcoords;\n"
+    "void main()\n"
+    "{\n"
+    "	int eye = gl_InstanceID & 1;\n"
+    "	v2UVcoords = v2UVcoordsIn;\n"
+    "	vec4 clip = viewProjection[eye] * vec4(v4InstanceIn.w * position.xyz + v4InstanceIn.xyz, 1);\n"
+    "	gl_ClipDistance[0] = eye == 0 ? clip.w - clip.x : clip.w + clip.x;\n"
+    "	clip.x = clip.x * 0.5 + (float(eye) - 0.5) * clip.w;\n"
+    "	gl_Position = clip;\n"
     "}\n",
 
     // Fragment Shader
@@ -999,26 +2106,25 @@ bool CMainApplication::CreateAllShaders()
     "   outputColor = texture(mytexture, v2UVcoords);\n"
     "}\n"
     );
-  m_nSceneMatrixLocation = glGetUniformLocation( m_unSceneProgramID, "matrix" );
-  if( m_nSceneMatrixLocation == -1 )
-  {
-    dprintf( "Unable to find matrix uniform in scene shader\n" );
-    return false;
-  }
 
-  m_unControllerTransformProgramID = CompileGLShader(
+  AddShaderProgram( &m_unControllerTransformProgramID,
     "Controller",
 
     // vertex shader
     "#version 410\n"
-    "uniform mat4 matrix;\n"
+    "layout(std140) uniform MatrixBlock\n"
+    "{\n"
+    "	mat4 viewProjection[2];\n"
+    "	mat4 deviceToTracking[" MATRIX_BLOCK_STRING( MATRIX_BLOCK_DEVICE_COUNT ) "];\n"
+    "};\n"
+    "uniform int eyeIndex;\n"
     "layout(location = 0) in vec4 position;\n"
     "layout(location = 1) in vec3 v3ColorIn;\n"
     "out vec4 v4Color;\n"
     "void main()\n"
     "{\n"
     "	v4Color.xyz = v3ColorIn; v4Color.a = 1.0;\n"
-    "	gl_Position = matrix * position;\n"
+    "	gl_Position = viewProjection[eyeIndex] * position;\n"
     "}\n",
 
     // fragment shader
@@ -1030,19 +2136,19 @@ bool CMainApplication::CreateAllShaders()
     "   outputColor = v4Color;\n"
     "}\n"
     );
-  m_nControllerMatrixLocation = glGetUniformLocation( m_unControllerTransformProgramID, "matrix" );
-  if( m_nControllerMatrixLocation == -1 )
-  {
-    dprintf( "Unable to find matrix uniform in controller shader\n" );
-    return false;
-  }
 
-  m_unRenderModelProgramID = CompileGLShader( 
+  AddShaderProgram( &m_unRenderModelProgramID, 
     "render model",
 
     // vertex shader
     "#version 410\n"
-    "uniform mat4 matrix;\n"
+    "layout(std140) uniform MatrixBlock\n"
+    "{\n"
+    "	mat4 viewProjection[2];\n"
+    "	mat4 deviceToTracking[" MATRIX_BLOCK_STRING( MATRIX_BLOCK_DEVICE_COUNT ) "];\n"
+    "};\n"
+    "uniform int eyeIndex;\n"
+    "uniform int deviceIndex;\n"
     "layout(location = 0) in vec4 position;\n"
     "layout(location = 1) in vec3 v3NormalIn;\n"
     "layout(location = 2) in vec2 v2TexCoordsIn;\n"
@@ -1050,7 +2156,7 @@ bool CMainApplication::CreateAllShaders()
     "void main()\n"
     "{\n"
     "	v2TexCoord = v2TexCoordsIn;\n"
-    "	gl_Position = matrix * vec4(position.xyz, 1);\n"
+    "	gl_Position = viewProjection[eyeIndex] * deviceToTracking[deviceIndex] * vec4(position.xyz, 1);\n"
     "}\n",
 
     //fragment shader
@@ -1064,14 +2170,8 @@ bool CMainApplication::CreateAllShaders()
     "}\n"
 
     );
-  m_nRenderModelMatrixLocation = glGetUniformLocation( m_unRenderModelProgramID, "matrix" );
-  if( m_nRenderModelMatrixLocation == -1 )
-  {
-    dprintf( "Unable to find matrix uniform in render model shader\n" );
-    return false;
-  }
 
-  m_unLensProgramID = CompileGLShader(
+  AddShaderProgram( &m_unLensProgramID,
     "Distortion",
 
     // vertex shader
@@ -1115,92 +2215,307 @@ bool CMainApplication::CreateAllShaders()
     "}\n"
     );
 
+  if( m_vecUncompiledPrograms.empty() )
+    return;
+
+  if( !m_pShaderContext )
+  {
+    CStartupPhaseScope phase( m_startupProfiler, "CompileShaders" );
+    CompileShaderPrograms();
+    return;
+  }
+
+  const uint32_t unCreatePhase = createPhase.GetPhase();
+  m_shaderCompileThread = std::thread( [this, unCreatePhase]
+  {
+    CStartupPhaseScope phase( m_startupProfiler, "CompileShaders", unCreatePhase );
+    m_unShaderCompilePhase = phase.GetPhase();
+    SDL_GL_MakeCurrent( m_pWindow, m_pShaderContext );
+    CompileShaderPrograms();
 
-  return m_unSceneProgramID != 0 
-    && m_unControllerTransformProgramID != 0
-    && m_unRenderModelProgramID != 0
-    && m_unLensProgramID != 0;
+    // the main context uses the programs as soon as this thread is joined
+    glFinish();
+    SDL_GL_MakeCurrent( m_pWindow, NULL );
+  } );
 }
 
 
 //-----------------------------------------------------------------------------
-// Purpose:
+// Purpose: Looks the program up in the cache, or queues it to be compiled
 //-----------------------------------------------------------------------------
-bool CMainApplication::SetupTexturemaps()
+void CMainApplication::AddShaderProgram( GLuint *punProgramID, const char *pchShaderName, const char *pchVertexShader, const char *pchFragmentShader )
 {
-  std::string sExecutableDirectory = Path_StripFilename( Path_GetExecutablePath() );
-  std::string strFullPath = Path_MakeAbsolute( "../cube_texture.png", sExecutableDirectory );
-  
-  std::vector<unsigned char> imageRGBA;
-  unsigned nImageWidth, nImageHeight;
-  unsigned nError = lodepng::decode( imageRGBA, nImageWidth, nImageHeight, strFullPath.c_str() );
-  
-  if ( nError != 0 )
-    return false;
-
-  glGenTextures(1, &m_iTexture );
-  glBindTexture( GL_TEXTURE_2D, m_iTexture );
-
-  glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, nImageWidth, nImageHeight,
-    0, GL_RGBA, GL_UNSIGNED_BYTE, &imageRGBA[0] );
-
-  glGenerateMipmap(GL_TEXTURE_2D);
+  m_unShaderPrograms++;
+  *punProgramID = m_programCache.LoadProgram( pchVertexShader, pchFragmentShader );
+  if( *punProgramID )
+  {
+    m_unCachedPrograms++;
+    return;
+  }
 
-  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
-  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
-  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
-  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
+  ShaderProgramSource_t program = { punProgramID, pchShaderName, pchVertexShader, pchFragmentShader };
+  m_vecUncompiledPrograms.push_back( program );
+}
 
-  GLfloat fLargest;
-  glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &fLargest);
-  glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, fLargest);
-    
-  glBindTexture( GL_TEXTURE_2D, 0 );
 
-  return ( m_iTexture != 0 );
+//-----------------------------------------------------------------------------
+// Purpose: Compiles the programs the cache missed and stores them in it
+//-----------------------------------------------------------------------------
+void CMainApplication::CompileShaderPrograms()
+{
+  for( size_t i = 0; i < m_vecUncompiledPrograms.size(); i++ )
+  {
+    const ShaderProgramSource_t &program = m_vecUncompiledPrograms[i];
+    *program.punProgramID = CompileGLShader( program.pchShaderName, program.pchVertexShader, program.pchFragmentShader );
+    m_programCache.StoreProgram( program.pchVertexShader, program.pchFragmentShader, *program.punProgramID );
+  }
+  m_vecUncompiledPrograms.clear();
 }
 
 
 //-----------------------------------------------------------------------------
-// Purpose: create a sea of cubes
+// Purpose: Waits for any compiles CreateAllShaders started, then looks up
+//          the uniforms. Uniform block bindings aren't part of a program
+//          binary, so they are set here for cached programs too.
 //-----------------------------------------------------------------------------
-void CMainApplication::SetupScene()
+bool CMainApplication::BFinishCreateAllShaders()
 {
-  std::vector<float> vertdataarray;
+  if( m_shaderCompileThread.joinable() )
+  {
+    NvtxRangePushColored( "WaitForShaderCompiles", 0xFF808080 );
+    const uint32_t unWaitPhase = m_startupProfiler.BeginPhase( "WaitForShaders" );
+    m_shaderCompileThread.join();
+    m_startupProfiler.AddDependency( unWaitPhase, m_unShaderCompilePhase );
+    m_startupProfiler.EndPhase( unWaitPhase );
+    NvtxRangePop();
+  }
 
-  Matrix4 matScale;
-  matScale.scale( m_fScale, m_fScale, m_fScale );
-  Matrix4 matTransform;
-  matTransform.translate(
-    -( (float)m_iSceneVolumeWidth * m_fScaleSpacing ) / 2.f,
-    -( (float)m_iSceneVolumeHeight * m_fScaleSpacing ) / 2.f,
-    -( (float)m_iSceneVolumeDepth * m_fScaleSpacing ) / 2.f);
-  
-  Matrix4 mat = matScale * matTransform;
+  if( m_unSceneProgramID == 0
+    || m_unSceneSinglePassProgramID == 0
+    || m_unControllerTransformProgramID == 0
+    || m_unRenderModelProgramID == 0
+    || m_unLensProgramID == 0 )
+    return false;
 
-  for( int z = 0; z< m_iSceneVolumeDepth; z++ )
+  m_nSceneEyeLocation = glGetUniformLocation( m_unSceneProgramID, "eyeIndex" );
+  GLuint unSceneBlockIndex = glGetUniformBlockIndex( m_unSceneProgramID, "MatrixBlock" );
+  if( m_nSceneEyeLocation == -1 || unSceneBlockIndex == GL_INVALID_INDEX )
   {
-    for( int y = 0; y< m_iSceneVolumeHeight; y++ )
+    dprintf( "Unable to find matrix uniforms in scene shader\n" );
+    return false;
+  }
+  glUniformBlockBinding( m_unSceneProgramID, unSceneBlockIndex, k_unMatrixBlockBinding );
+
+  GLuint unSceneMatrixBlockIndex = glGetUniformBlockIndex( m_unSceneSinglePassProgramID, "MatrixBlock" );
+  if( unSceneMatrixBlockIndex == GL_INVALID_INDEX )
+  {
+    dprintf( "Unable to find matrix block in single pass scene shader\n" );
+    return false;
+  }
+  glUniformBlockBinding( m_unSceneSinglePassProgramID, unSceneMatrixBlockIndex, k_unMatrixBlockBinding );
+
+  m_nControllerEyeLocation = glGetUniformLocation( m_unControllerTransformProgramID, "eyeIndex" );
+  GLuint unControllerBlockIndex = glGetUniformBlockIndex( m_unControllerTransformProgramID, "MatrixBlock" );
+  if( m_nControllerEyeLocation == -1 || unControllerBlockIndex == GL_INVALID_INDEX )
+  {
+    dprintf( "Unable to find matrix uniforms in controller shader\n" );
+    return false;
+  }
+  glUniformBlockBinding( m_unControllerTransformProgramID, unControllerBlockIndex, k_unMatrixBlockBinding );
+
+  m_nRenderModelEyeLocation = glGetUniformLocation( m_unRenderModelProgramID, "eyeIndex" );
+  m_nRenderModelDeviceLocation = glGetUniformLocation( m_unRenderModelProgramID, "deviceIndex" );
+  GLuint unMatrixBlockIndex = glGetUniformBlockIndex( m_unRenderModelProgramID, "MatrixBlock" );
+  if( m_nRenderModelEyeLocation == -1 || m_nRenderModelDeviceLocation == -1 || unMatrixBlockIndex == GL_INVALID_INDEX )
+  {
+    dprintf( "Unable to find matrix uniforms in render model shader\n" );
+    return false;
+  }
+  glUniformBlockBinding( m_unRenderModelProgramID, unMatrixBlockIndex, k_unMatrixBlockBinding );
+
+  dprintf( "Shaders: %u of %u programs from the cache, ready after %.1f ms\n",
+    m_unCachedPrograms, m_unShaderPrograms, ( GetTimestampInSeconds() - m_flShaderStartTime ) * 1000.0 );
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CMainApplication::StartTexturemapLoads()
+{
+  std::string sExecutableDirectory = Path_StripFilename( Path_GetExecutablePath() );
+
+  struct TextureFile_t
+  {
+    const char *pchFilename;
+    GLuint *pTexture;
+    int nPriority;
+  };
+  TextureFile_t rTextureFiles[] =
+  {
+    { "../cube_texture.png", &m_iTexture, 0 },
+  };
+  const size_t nTextureFiles = sizeof( rTextureFiles ) / sizeof( rTextureFiles[0] );
+
+  // Decode everything on the loader's threads while the window and context
+  // are created. SetupTexturemaps uploads on the GL thread as images
+  // complete, most important first.
+  for ( size_t i = 0; i < nTextureFiles; i++ )
+  {
+    m_vecTextureRequests.push_back( ImageRequest_t( Path_MakeAbsolute( rTextureFiles[i].pchFilename, sExecutableDirectory ), rTextureFiles[i].nPriority ) );
+    m_vecTextureRequests.back().unUserData = i;
+    m_vecTextureTargets.push_back( rTextureFiles[i].pTexture );
+  }
+
+  m_pImageLoader.reset( new CImageLoader( (unsigned)std::min< size_t >( nTextureFiles, std::thread::hardware_concurrency() ) ) );
+  m_pImageLoader->LoadBatch( m_vecTextureRequests );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Uploads the textures StartTexturemapLoads is decoding
+//-----------------------------------------------------------------------------
+bool CMainApplication::SetupTexturemaps()
+{
+  CStartupPhaseScope phase( m_startupProfiler, "UploadTextures" );
+
+  bool bSuccess = true;
+  while ( ImageHandle_t pImage = m_pImageLoader->WaitForCompleted() )
+  {
+    const size_t nIndex = (size_t)pImage->unUserData;
+    if ( nIndex >= m_vecTextureTargets.size() )
     {
-      for( int x = 0; x< m_iSceneVolumeWidth; x++ )
+      dprintf( "Texture %s doesn't match a request\n", pImage->sName.c_str() );
+      bSuccess = false;
+      continue;
+    }
+
+    if ( pImage->nError != 0 )
+    {
+      dprintf( "Unable to load texture %s: %s\n", pImage->sName.c_str(), lodepng_error_text( pImage->nError ) );
+      bSuccess = false;
+      continue;
+    }
+
+    GLuint *pTexture = m_vecTextureTargets[nIndex];
+    glGenTextures(1, pTexture );
+    glBindTexture( GL_TEXTURE_2D, *pTexture );
+
+    glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, pImage->nWidth, pImage->nHeight,
+      0, GL_RGBA, GL_UNSIGNED_BYTE, &pImage->pixels[0] );
+
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
+
+    GLfloat fLargest;
+    glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &fLargest);
+    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, fLargest);
+
+    glBindTexture( GL_TEXTURE_2D, 0 );
+
+    bSuccess = bSuccess && ( *pTexture != 0 );
+  }
+
+  m_pImageLoader.reset();
+  m_vecTextureRequests.clear();
+  m_vecTextureTargets.clear();
+  return bSuccess;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: create a sea of cubes. By default every cube is baked into one
+//          vertex array; with -instanced a single cube is drawn once per
+//          cube with its offset and scale from a per-instance buffer.
+//          Runs on m_sceneBuildThread and doesn't touch GL; SetupScene
+//          uploads the result.
+//-----------------------------------------------------------------------------
+void CMainApplication::BuildScene()
+{
+  const double flStartTime = GetTimestampInSeconds();
+
+  std::vector<float> &vertdataarray = m_vecSceneVertices;
+  std::vector<float> &instancedataarray = m_vecSceneInstances;
+  const size_t nCubes = (size_t)m_iSceneVolumeWidth * m_iSceneVolumeHeight * m_iSceneVolumeDepth;
+
+  if( m_bInstancedCubes )
+  {
+    AddCubeToScene( Matrix4(), vertdataarray );
+
+    // same placement as the baked path: scale * ( vertex + corner + index * spacing )
+    const Vector3 vCorner(
+      -( (float)m_iSceneVolumeWidth * m_fScaleSpacing ) / 2.f,
+      -( (float)m_iSceneVolumeHeight * m_fScaleSpacing ) / 2.f,
+      -( (float)m_iSceneVolumeDepth * m_fScaleSpacing ) / 2.f );
+
+    instancedataarray.reserve( nCubes * 4 );
+    for( int z = 0; z < m_iSceneVolumeDepth; z++ )
+    {
+      for( int y = 0; y < m_iSceneVolumeHeight; y++ )
       {
-        AddCubeToScene( mat, vertdataarray );
-        mat = mat * Matrix4().translate( m_fScaleSpacing, 0, 0 );
+        for( int x = 0; x < m_iSceneVolumeWidth; x++ )
+        {
+          instancedataarray.push_back( m_fScale * ( vCorner.x + x * m_fScaleSpacing ) );
+          instancedataarray.push_back( m_fScale * ( vCorner.y + y * m_fScaleSpacing ) );
+          instancedataarray.push_back( m_fScale * ( vCorner.z + z * m_fScaleSpacing ) );
+          instancedataarray.push_back( m_fScale );
+        }
       }
-      mat = mat * Matrix4().translate( -((float)m_iSceneVolumeWidth) * m_fScaleSpacing, m_fScaleSpacing, 0 );
     }
-    mat = mat * Matrix4().translate( 0, -((float)m_iSceneVolumeHeight) * m_fScaleSpacing, m_fScaleSpacing );
+  }
+  else
+  {
+    vertdataarray.reserve( nCubes * 36 * 5 );
+    SetupSceneVertices( vertdataarray );
+
+    // a single identity instance so both paths share the shader and draw call
+    instancedataarray.push_back( 0.f );
+    instancedataarray.push_back( 0.f );
+    instancedataarray.push_back( 0.f );
+    instancedataarray.push_back( 1.f );
   }
   m_uiVertcount = vertdataarray.size()/5;
-  
+  m_uiInstanceCount = instancedataarray.size()/4;
+
+  if( m_bCullScene )
+  {
+    m_sceneCuller.SetInstances( &instancedataarray[0], m_uiInstanceCount );
+  }
+
+  dprintf( "Scene: %u cubes (%s) built in %.1f ms, %.1f MB of vertex data\n",
+    (unsigned)nCubes, m_bInstancedCubes ? "instanced" : "baked",
+    ( GetTimestampInSeconds() - flStartTime ) * 1000.0,
+    sizeof(float) * ( vertdataarray.size() + instancedataarray.size() ) / ( 1024.0 * 1024.0 ) );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Waits for BuildScene and uploads the cubes it built
+//-----------------------------------------------------------------------------
+void CMainApplication::SetupScene()
+{
+  CStartupPhaseScope phase( m_startupProfiler, "UploadScene" );
+  if( m_sceneBuildThread.joinable() )
+  {
+    m_sceneBuildThread.join();
+    m_startupProfiler.AddDependency( phase.GetPhase(), m_unSceneBuildPhase );
+  }
+
+  const std::vector<float> &vertdataarray = m_vecSceneVertices;
+  const std::vector<float> &instancedataarray = m_vecSceneInstances;
+
   glGenVertexArrays( 1, &m_unSceneVAO );
   glBindVertexArray( m_unSceneVAO );
 
   glGenBuffers( 1, &m_glSceneVertBuffer );
   glBindBuffer( GL_ARRAY_BUFFER, m_glSceneVertBuffer );
-  glBufferData( GL_ARRAY_BUFFER, sizeof(float) * vertdataarray.size(), &vertdataarray[0], GL_STATIC_DRAW);
-
-  glBindBuffer( GL_ARRAY_BUFFER, m_glSceneVertBuffer );
+  glBufferData( GL_ARRAY_BUFFER, sizeof(float) * vertdataarray.size(), vertdataarray.empty() ? NULL : &vertdataarray[0], GL_STATIC_DRAW);
 
   GLsizei stride = sizeof(VertexDataScene);
   uintptr_t offset = 0;
@@ -1212,11 +2527,113 @@ void CMainApplication::SetupScene()
   glEnableVertexAttribArray( 1 );
   glVertexAttribPointer( 1, 2, GL_FLOAT, GL_FALSE, stride, (const void *)offset);
 
+  // when culling, the instance buffer is refilled with the visible cubes every frame
+  glGenBuffers( 1, &m_glSceneInstanceBuffer );
+  glBindBuffer( GL_ARRAY_BUFFER, m_glSceneInstanceBuffer );
+  glBufferData( GL_ARRAY_BUFFER, sizeof(float) * instancedataarray.size(), &instancedataarray[0], m_bCullScene ? GL_STREAM_DRAW : GL_STATIC_DRAW );
+
+  glEnableVertexAttribArray( 3 );
+  glVertexAttribPointer( 3, 4, GL_FLOAT, GL_FALSE, sizeof(Vector4), (const void *)0 );
+  // the single pass shader draws each instance once per eye
+  glVertexAttribDivisor( 3, m_bSinglePassStereo ? 2 : 1 );
+
   glBindVertexArray( 0 );
-  // TODO: do we need these?
-  //glDisableVertexAttribArray(0);
-  //glDisableVertexAttribArray(1);
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+  if( m_bCullScene )
+  {
+    // count, instanceCount, first, reserved. CullScene rewrites instanceCount.
+    const GLuint rIndirect[ 4 ] = { m_uiVertcount, m_bSinglePassStereo ? m_uiInstanceCount * 2 : m_uiInstanceCount, 0, 0 };
+    glGenBuffers( 1, &m_glSceneIndirectBuffer );
+    glBindBuffer( GL_DRAW_INDIRECT_BUFFER, m_glSceneIndirectBuffer );
+    glBufferData( GL_DRAW_INDIRECT_BUFFER, sizeof( rIndirect ), rIndirect, GL_DYNAMIC_DRAW );
+    glBindBuffer( GL_DRAW_INDIRECT_BUFFER, 0 );
+  }
+
+  // the buffers have their own copies, and the culler keeps the instances
+  std::vector<float>().swap( m_vecSceneVertices );
+  std::vector<float>().swap( m_vecSceneInstances );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Culls the instanced cubes once for both eyes, streams the visible
+//          ones into the instance buffer and updates the indirect draw count
+//-----------------------------------------------------------------------------
+void CMainApplication::CullScene()
+{
+  if( !m_bCullScene || !m_bShowCubes )
+    return;
+
+  NvtxRangePushColored( "CullScene", 0xFF0000AA );
+
+  GLuint unVisible = 0;
+  glBindBuffer( GL_ARRAY_BUFFER, m_glSceneInstanceBuffer );
+  float *pflVisible = (float *)glMapBufferRange( GL_ARRAY_BUFFER, 0, sizeof(float) * 4 * m_uiInstanceCount, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT );
+  if( pflVisible )
+  {
+    unVisible = m_sceneCuller.Cull( m_xformHMDPose.inverse().toMatrix4(), pflVisible );
+    if( !glUnmapBuffer( GL_ARRAY_BUFFER ) )
+      unVisible = 0;
+  }
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+  GLuint unInstanceCount = m_bSinglePassStereo ? unVisible * 2 : unVisible;
+  glBindBuffer( GL_DRAW_INDIRECT_BUFFER, m_glSceneIndirectBuffer );
+  glBufferSubData( GL_DRAW_INDIRECT_BUFFER, sizeof(GLuint), sizeof(GLuint), &unInstanceCount );
+  glBindBuffer( GL_DRAW_INDIRECT_BUFFER, 0 );
+
+  NvtxRangePop();
+
+  // report the average every 90 frames
+  const CullStats_t &stats = m_sceneCuller.GetStats();
+  m_cullStatsTotal.unInstances += stats.unInstances;
+  m_cullStatsTotal.unVisible += unVisible;
+  m_cullStatsTotal.unCells += stats.unCells;
+  m_cullStatsTotal.unCellsRejected += stats.unCellsRejected;
+  m_cullStatsTotal.unCellsAccepted += stats.unCellsAccepted;
+  m_cullStatsTotal.flMilliseconds += stats.flMilliseconds;
+  if( ++m_unCullStatsFrames == 90 )
+  {
+    dprintf( "Cull: %.1f%% of cubes culled, %.1f%% of cells rejected and %.1f%% accepted whole, %.3f ms/frame\n",
+      100.0 * ( m_cullStatsTotal.unInstances - m_cullStatsTotal.unVisible ) / std::max< uint32_t >( 1, m_cullStatsTotal.unInstances ),
+      100.0 * m_cullStatsTotal.unCellsRejected / std::max< uint32_t >( 1, m_cullStatsTotal.unCells ),
+      100.0 * m_cullStatsTotal.unCellsAccepted / std::max< uint32_t >( 1, m_cullStatsTotal.unCells ),
+      m_cullStatsTotal.flMilliseconds / m_unCullStatsFrames );
+    memset( &m_cullStatsTotal, 0, sizeof( m_cullStatsTotal ) );
+    m_unCullStatsFrames = 0;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: bakes every cube of the volume into one vertex array
+//-----------------------------------------------------------------------------
+void CMainApplication::SetupSceneVertices( std::vector<float> &vertdataarray )
+{
+  Matrix4 matScale;
+  matScale.scale( m_fScale, m_fScale, m_fScale );
+  Matrix4 matTransform;
+  matTransform.translate(
+    -( (float)m_iSceneVolumeWidth * m_fScaleSpacing ) / 2.f,
+    -( (float)m_iSceneVolumeHeight * m_fScaleSpacing ) / 2.f,
+    -( (float)m_iSceneVolumeDepth * m_fScaleSpacing ) / 2.f);
+  
+  Matrix4 mat = matScale * matTransform;
 
+  for( int z = 0; z< m_iSceneVolumeDepth; z++ )
+  {
+    for( int y = 0; y< m_iSceneVolumeHeight; y++ )
+    {
+      for( int x = 0; x< m_iSceneVolumeWidth; x++ )
+      {
+        AddCubeToScene( mat, vertdataarray );
+        mat = mat * Matrix4().translate( m_fScaleSpacing, 0, 0 );
+      }
+      mat = mat * Matrix4().translate( -((float)m_iSceneVolumeWidth) * m_fScaleSpacing, m_fScaleSpacing, 0 );
+    }
+    mat = mat * Matrix4().translate( 0, -((float)m_iSceneVolumeHeight) * m_fScaleSpacing, m_fScaleSpacing );
+  }
 }
 
 
@@ -1294,6 +2711,21 @@ void CMainApplication::AddCubeToScene( Matrix4 mat, std::vector<float> &vertdata
 }
 
 
+//-----------------------------------------------------------------------------
+// Purpose: Writes one position + color line vertex and returns the next slot
+//-----------------------------------------------------------------------------
+static float *WriteLineVertex( float *pVert, const Vector4 &position, const Vector3 &color )
+{
+  pVert[0] = position.x;
+  pVert[1] = position.y;
+  pVert[2] = position.z;
+  pVert[3] = color.x;
+  pVert[4] = color.y;
+  pVert[5] = color.z;
+  return pVert + 6;
+}
+
+
 //-----------------------------------------------------------------------------
 // Purpose: Draw all of the controllers as X/Y/Z lines
 //-----------------------------------------------------------------------------
@@ -1301,28 +2733,29 @@ void CMainApplication::DrawControllers()
 {
 #ifdef USE_OPENVR
   // don't draw controllers if somebody else has input focus
-  if( m_pHMD->IsInputFocusCapturedByAnotherProcess() )
+  if( !m_pHMD || m_pHMD->IsInputFocusCapturedByAnotherProcess() )
     return;
 
-  std::vector<float> vertdataarray;
+  // three axis lines and a pointing ray for every controller with a matrix
+  const GLsizei stride = 2 * 3 * sizeof( float );
+  const uint32_t unMaxVertcount = std::max( m_unMatrixBlockDevices, 1u ) * 8;
+  GLintptr nOffset = 0;
+  float *pVert = (float *)m_streamingBuffer.Alloc( unMaxVertcount * stride, sizeof( float ), &nOffset );
 
   m_uiControllerVertcount = 0;
   m_iTrackedControllerCount = 0;
 
-  for ( vr::TrackedDeviceIndex_t unTrackedDevice = vr::k_unTrackedDeviceIndex_Hmd + 1; unTrackedDevice < vr::k_unMaxTrackedDeviceCount; ++unTrackedDevice )
+  for ( uint32_t unConnected = 0; unConnected < m_unConnectedPoses; ++unConnected )
   {
-    if ( !m_pHMD->IsTrackedDeviceConnected( unTrackedDevice ) )
-      continue;
-
-    if( m_pHMD->GetTrackedDeviceClass( unTrackedDevice ) != vr::TrackedDeviceClass_Controller )
+    if( m_trackedDevices.GetDeviceClass( m_vecConnectedDevices[ unConnected ] ) != vr::TrackedDeviceClass_Controller )
       continue;
 
     m_iTrackedControllerCount += 1;
 
-    if( !m_rTrackedDevicePose[ unTrackedDevice ].bPoseIsValid )
+    if( unConnected >= m_unMatrixBlockDevices || !m_vecConnectedPoses[ unConnected ].bPoseIsValid || !pVert )
       continue;
 
-    const Matrix4 & mat = m_rmat4DevicePose[unTrackedDevice];
+    const Matrix4 mat( m_matrixBlock.rmat4DeviceToTracking[ unConnected ] );
 
     Vector4 center = mat * Vector4( 0, 0, 0, 1 );
 
@@ -1333,22 +2766,8 @@ void CMainApplication::DrawControllers()
       point[i] += 0.05f;  // offset in X, Y, Z
       color[i] = 1.0;  // R, G, B
       point = mat * point;
-      vertdataarray.push_back( center.x );
-      vertdataarray.push_back( center.y );
-      vertdataarray.push_back( center.z );
-
-      vertdataarray.push_back( color.x );
-      vertdataarray.push_back( color.y );
-      vertdataarray.push_back( color.z );
-    
-      vertdataarray.push_back( point.x );
-      vertdataarray.push_back( point.y );
-      vertdataarray.push_back( point.z );
-    
-      vertdataarray.push_back( color.x );
-      vertdataarray.push_back( color.y );
-      vertdataarray.push_back( color.z );
-    
+      pVert = WriteLineVertex( pVert, center, color );
+      pVert = WriteLineVertex( pVert, point, color );
       m_uiControllerVertcount += 2;
     }
 
@@ -1356,44 +2775,32 @@ void CMainApplication::DrawControllers()
     Vector4 end = mat * Vector4( 0, 0, -39.f, 1 );
     Vector3 color( .92f, .92f, .71f );
 
-    vertdataarray.push_back( start.x );vertdataarray.push_back( start.y );vertdataarray.push_back( start.z );
-    vertdataarray.push_back( color.x );vertdataarray.push_back( color.y );vertdataarray.push_back( color.z );
-
-    vertdataarray.push_back( end.x );vertdataarray.push_back( end.y );vertdataarray.push_back( end.z );
-    vertdataarray.push_back( color.x );vertdataarray.push_back( color.y );vertdataarray.push_back( color.z );
+    pVert = WriteLineVertex( pVert, start, color );
+    pVert = WriteLineVertex( pVert, end, color );
     m_uiControllerVertcount += 2;
   }
 
-  // Setup the VAO the first time through.
+  // Setup the VAO the first time through. The vertex buffer is bound each
+  // frame since the data moves around the streaming buffer.
   if ( m_unControllerVAO == 0 )
   {
     glGenVertexArrays( 1, &m_unControllerVAO );
     glBindVertexArray( m_unControllerVAO );
 
-    glGenBuffers( 1, &m_glControllerVertBuffer );
-    glBindBuffer( GL_ARRAY_BUFFER, m_glControllerVertBuffer );
-
-    GLuint stride = 2 * 3 * sizeof( float );
-    GLuint offset = 0;
-
     glEnableVertexAttribArray( 0 );
-    glVertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE, stride, (const void *)offset);
+    glVertexAttribFormat( 0, 3, GL_FLOAT, GL_FALSE, 0 );
+    glVertexAttribBinding( 0, 0 );
 
-    offset += sizeof( Vector3 );
     glEnableVertexAttribArray( 1 );
-    glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, stride, (const void *)offset);
+    glVertexAttribFormat( 1, 3, GL_FLOAT, GL_FALSE, sizeof( Vector3 ) );
+    glVertexAttribBinding( 1, 0 );
 
     glBindVertexArray( 0 );
   }
 
-  glBindBuffer( GL_ARRAY_BUFFER, m_glControllerVertBuffer );
-
-  // set vertex data if we have some
-  if( vertdataarray.size() > 0 )
-  {
-    //$ TODO: Use glBufferSubData for this...
-    glBufferData( GL_ARRAY_BUFFER, sizeof(float) * vertdataarray.size(), &vertdataarray[0], GL_STREAM_DRAW );
-  }
+  glBindVertexArray( m_unControllerVAO );
+  glBindVertexBuffer( 0, m_streamingBuffer.GetBuffer(), nOffset, stride );
+  glBindVertexArray( 0 );
 #endif
 }
 
@@ -1404,29 +2811,49 @@ void CMainApplication::DrawControllers()
 void CMainApplication::SetupCameras()
 {
 #ifdef USE_OPENVR
-  m_mat4ProjectionLeft = GetHMDMatrixProjectionEye( vr::Eye_Left );
-  m_mat4ProjectionRight = GetHMDMatrixProjectionEye( vr::Eye_Right );
-  m_mat4eyePosLeft = GetHMDMatrixPoseEye( vr::Eye_Left );
-  m_mat4eyePosRight = GetHMDMatrixPoseEye( vr::Eye_Right );
-#else
-  // Column major.
-  m_mat4ProjectionLeft.set(
-    1.35799515f, 0.f, 0.f, 0.f,
-    0.f, 2.41421342f, 0.f, 0.f,
-    0.f, 0.f, -1.00200200f, -1.f,
-    0.f, 0.f, -2.00200200f, 0.f);
-  m_mat4ProjectionRight = m_mat4ProjectionLeft;
-  m_mat4eyePosLeft.set(
-    1.f, 0.f, 0.f, 0.f,
-    0.f, 1.f, 0.f, 0.f,
-    0.f, 0.f, 1.f, 0.f,
-    -0.05f, 0.f, 0.f, 1.f);
-  m_mat4eyePosRight.set(
-    1.f, 0.f, 0.f, 0.f,
-    0.f, 1.f, 0.f, 0.f,
-    0.f, 0.f, 1.f, 0.f,
-    0.05f, 0.f, 0.f, 1.f);
+  if( m_pHMD )
+  {
+    m_mat4ProjectionLeft = GetHMDMatrixProjectionEye( vr::Eye_Left );
+    m_mat4ProjectionRight = GetHMDMatrixProjectionEye( vr::Eye_Right );
+    m_xformEyePosLeft = GetHMDMatrixPoseEye( vr::Eye_Left );
+    m_xformEyePosRight = GetHMDMatrixPoseEye( vr::Eye_Right );
+  }
+  else
+#endif
+  {
+    // Column major.
+    m_mat4ProjectionLeft.set(
+      1.35799515f, 0.f, 0.f, 0.f,
+      0.f, 2.41421342f, 0.f, 0.f,
+      0.f, 0.f, -1.00200200f, -1.f,
+      0.f, 0.f, -2.00200200f, 0.f);
+    m_mat4ProjectionRight = m_mat4ProjectionLeft;
+    m_xformEyePosLeft = RigidTransform<EyeSpace, HeadSpace>( Vector3( -0.05f, 0.f, 0.f ) );
+    m_xformEyePosRight = RigidTransform<EyeSpace, HeadSpace>( Vector3( 0.05f, 0.f, 0.f ) );
+  }
+
+  EyeFrustum_t eyeLeft, eyeRight;
+#ifdef USE_OPENVR
+  if( m_pHMD )
+  {
+    m_pHMD->GetProjectionRaw( vr::Eye_Left, &eyeLeft.flLeft, &eyeLeft.flRight, &eyeLeft.flTop, &eyeLeft.flBottom );
+    m_pHMD->GetProjectionRaw( vr::Eye_Right, &eyeRight.flLeft, &eyeRight.flRight, &eyeRight.flTop, &eyeRight.flBottom );
+  }
+  else
 #endif
+  {
+    // tangents of the symmetric projection above
+    eyeLeft.flRight = 1.f / m_mat4ProjectionLeft[0];
+    eyeLeft.flBottom = 1.f / m_mat4ProjectionLeft[5];
+    eyeLeft.flLeft = -eyeLeft.flRight;
+    eyeLeft.flTop = -eyeLeft.flBottom;
+    eyeRight = eyeLeft;
+  }
+  eyeLeft.matEyeToHead = m_xformEyePosLeft.inverse().toMatrix4();
+  eyeRight.matEyeToHead = m_xformEyePosRight.inverse().toMatrix4();
+  m_sceneCuller.SetStereoFrustum( eyeLeft, eyeRight, m_fNearClip, m_fFarClip );
+
+  UpdateMatrixBlock();
 }
 
 
@@ -1479,10 +2906,36 @@ bool CMainApplication::CreateFrameBuffer( int nWidth, int nHeight, FramebufferDe
 bool CMainApplication::SetupStereoRenderTargets()
 {
   if (m_pHMD) {
-    m_pHMD->GetRecommendedRenderTargetSize( &m_nRenderWidth, &m_nRenderHeight );
+    m_pHMD->GetRecommendedRenderTargetSize( &m_nRecommendedWidth, &m_nRecommendedHeight );
   } else {
-    m_nRenderWidth = 500;
-    m_nRenderHeight = 500;
+    m_nRecommendedWidth = 500;
+    m_nRecommendedHeight = 500;
+  }
+
+  m_nRenderWidth = m_nRecommendedWidth;
+  m_nRenderHeight = m_nRecommendedHeight;
+  if ( m_bDynamicResolution )
+  {
+    // allocate once at the largest scale and only ever change the viewport
+    m_nRenderWidth = (uint32_t)( m_nRecommendedWidth * k_flMaxRenderScale + 0.5f );
+    m_nRenderHeight = (uint32_t)( m_nRecommendedHeight * k_flMaxRenderScale + 0.5f );
+    m_dynamicResolution.Init( k_flMinRenderScale, k_flMaxRenderScale, k_unRenderScaleLevels,
+      m_flFrameDuration * 1000.0 * k_flSceneGpuBudgetFraction );
+    dprintf( "Dynamic resolution: %ux%u per eye allocated, starting at %.2f scale\n", m_nRenderWidth, m_nRenderHeight, m_dynamicResolution.GetScale() );
+  }
+  m_nViewportWidth = m_nRenderWidth;
+  m_nViewportHeight = m_nRenderHeight;
+  UpdateRenderScale();
+
+  if ( m_bSinglePassStereo )
+  {
+    dprintf("Create side by side stereo frame buffer ...\n");
+    for (int i = 0; i < kNumBuffers; ++i)
+    {
+      if ( !CreateFrameBuffer( m_nRenderWidth * 2, m_nRenderHeight, stereoDesc[i] ) )
+        return false;
+    }
+    return true;
   }
 
   dprintf("Create left eye frame buffer ...\n");
@@ -1649,19 +3102,84 @@ void CMainApplication::SetupDistortion()
 //-----------------------------------------------------------------------------
 void CMainApplication::RenderStereoTargets()
 {
+  const double flStartTime = GetTimestampInSeconds();
+
   glClearColor( 0.15f, 0.15f, 0.18f, 1.0f ); // nice background color, but not black
 
-  // Left Eye
-  glBindFramebuffer( GL_FRAMEBUFFER, leftEyeDesc[cur_frame_buffer_].m_nRenderFramebufferId );
-  glViewport(0, 0, m_nRenderWidth, m_nRenderHeight );
-  RenderScene( vr::Eye_Left );
-  glBindFramebuffer( GL_FRAMEBUFFER, 0 );
+  if( m_bSinglePassStereo )
+  {
+    glBindFramebuffer( GL_FRAMEBUFFER, stereoDesc[cur_frame_buffer_].m_nRenderFramebufferId );
+    glViewport(0, 0, m_nViewportWidth * 2, m_nViewportHeight );
+    RenderSceneSinglePass();
+    glBindFramebuffer( GL_FRAMEBUFFER, 0 );
+  }
+  else
+  {
+    // Left Eye
+    glBindFramebuffer( GL_FRAMEBUFFER, leftEyeDesc[cur_frame_buffer_].m_nRenderFramebufferId );
+    glViewport(0, 0, m_nViewportWidth, m_nViewportHeight );
+    RenderScene( vr::Eye_Left );
+    glBindFramebuffer( GL_FRAMEBUFFER, 0 );
+
+    // Right Eye
+    glBindFramebuffer( GL_FRAMEBUFFER, rightEyeDesc[cur_frame_buffer_].m_nRenderFramebufferId );
+    glViewport(0, 0, m_nViewportWidth, m_nViewportHeight );
+    RenderScene( vr::Eye_Right );
+    glBindFramebuffer( GL_FRAMEBUFFER, 0 );
+  }
 
-  // Right Eye
-  glBindFramebuffer( GL_FRAMEBUFFER, rightEyeDesc[cur_frame_buffer_].m_nRenderFramebufferId );
-  glViewport(0, 0, m_nRenderWidth, m_nRenderHeight );
-  RenderScene( vr::Eye_Right );
-  glBindFramebuffer( GL_FRAMEBUFFER, 0 );
+  // report the average every 90 frames. This is the CPU cost of issuing the
+  // commands, the GPU work happens later.
+  m_flStereoCpuMs += ( GetTimestampInSeconds() - flStartTime ) * 1000.0;
+  if( ++m_unStereoStatsFrames == 90 )
+  {
+    dprintf( "Stereo (%s): %.1f scene draw calls, %.3f ms CPU per frame\n", m_bSinglePassStereo ? "single pass" : "two pass",
+      (double)m_unDrawCalls / m_unStereoStatsFrames, m_flStereoCpuMs / m_unStereoStatsFrames );
+    m_unDrawCalls = 0;
+    m_flStereoCpuMs = 0.0;
+    m_unStereoStatsFrames = 0;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Renders the cubes for both eyes with one draw call
+//-----------------------------------------------------------------------------
+void CMainApplication::RenderSceneSinglePass()
+{
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  glEnable(GL_DEPTH_TEST);
+
+  if( m_bShowCubes )
+  {
+    glEnable( GL_CLIP_DISTANCE0 );
+    glUseProgram( m_unSceneSinglePassProgramID );
+    DrawSceneCubes();
+    glDisable( GL_CLIP_DISTANCE0 );
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Issues the cube draw for whichever scene program is bound
+//-----------------------------------------------------------------------------
+void CMainApplication::DrawSceneCubes()
+{
+  glBindVertexArray( m_unSceneVAO );
+  glBindTexture( GL_TEXTURE_2D, m_iTexture );
+  if( m_bCullScene )
+  {
+    glBindBuffer( GL_DRAW_INDIRECT_BUFFER, m_glSceneIndirectBuffer );
+    glDrawArraysIndirect( GL_TRIANGLES, 0 );
+    glBindBuffer( GL_DRAW_INDIRECT_BUFFER, 0 );
+  }
+  else
+  {
+    glDrawArraysInstanced( GL_TRIANGLES, 0, m_uiVertcount, m_bSinglePassStereo ? m_uiInstanceCount * 2 : m_uiInstanceCount );
+  }
+  glBindVertexArray( 0 );
+  m_unDrawCalls++;
+  m_ulSceneDrawCalls++;
 }
 
 
@@ -1676,50 +3194,48 @@ void CMainApplication::RenderScene( vr::Hmd_Eye nEye )
   if( m_bShowCubes )
   {
     glUseProgram( m_unSceneProgramID );
-    glUniformMatrix4fv( m_nSceneMatrixLocation, 1, GL_FALSE, GetCurrentViewProjectionMatrix( nEye ).get() );
-    glBindVertexArray( m_unSceneVAO );
-    glBindTexture( GL_TEXTURE_2D, m_iTexture );
-    glDrawArrays( GL_TRIANGLES, 0, m_uiVertcount );
-    glBindVertexArray( 0 );
+    glUniform1i( m_nSceneEyeLocation, nEye );
+    DrawSceneCubes();
   }
 
-  /*if (m_pHMD) {
+  if( m_pHMD )
+  {
     bool bIsInputCapturedByAnotherProcess = m_pHMD->IsInputFocusCapturedByAnotherProcess();
 
     if( !bIsInputCapturedByAnotherProcess )
     {
       // draw the controller axis lines
       glUseProgram( m_unControllerTransformProgramID );
-      glUniformMatrix4fv( m_nControllerMatrixLocation, 1, GL_FALSE, GetCurrentViewProjectionMatrix( nEye ).get() );
+      glUniform1i( m_nControllerEyeLocation, nEye );
       glBindVertexArray( m_unControllerVAO );
       glDrawArrays( GL_LINES, 0, m_uiControllerVertcount );
       glBindVertexArray( 0 );
     }
 
     // ----- Render Model rendering -----
+    // the matrices come from the uniform block, so only the indices change per draw
     glUseProgram( m_unRenderModelProgramID );
+    glUniform1i( m_nRenderModelEyeLocation, nEye );
 
-    for( uint32_t unTrackedDevice = 0; unTrackedDevice < vr::k_unMaxTrackedDeviceCount; unTrackedDevice++ )
+    for( uint32_t unConnected = 0; unConnected < m_unMatrixBlockDevices; unConnected++ )
     {
-      if( !m_rTrackedDeviceToRenderModel[ unTrackedDevice ] || !m_rbShowTrackedDevice[ unTrackedDevice ] )
+      const vr::TrackedDeviceIndex_t unTrackedDevice = m_vecConnectedDevices[ unConnected ];
+      if( !m_vecTrackedDeviceToRenderModel[ unTrackedDevice ] || !m_vecShowTrackedDevice[ unTrackedDevice ] )
         continue;
 
-      const vr::TrackedDevicePose_t & pose = m_rTrackedDevicePose[ unTrackedDevice ];
-      if( !pose.bPoseIsValid )
+      if( !m_vecConnectedPoses[ unConnected ].bPoseIsValid )
         continue;
 
-      if( bIsInputCapturedByAnotherProcess && m_pHMD->GetTrackedDeviceClass( unTrackedDevice ) == vr::TrackedDeviceClass_Controller )
+      if( bIsInputCapturedByAnotherProcess && m_trackedDevices.GetDeviceClass( unTrackedDevice ) == vr::TrackedDeviceClass_Controller )
         continue;
 
-      const Matrix4 & matDeviceToTracking = m_rmat4DevicePose[ unTrackedDevice ];
-      Matrix4 matMVP = GetCurrentViewProjectionMatrix( nEye ) * matDeviceToTracking;
-      glUniformMatrix4fv( m_nRenderModelMatrixLocation, 1, GL_FALSE, matMVP.get() );
+      glUniform1i( m_nRenderModelDeviceLocation, unConnected );
 
-      m_rTrackedDeviceToRenderModel[ unTrackedDevice ]->Draw();
+      m_vecTrackedDeviceToRenderModel[ unTrackedDevice ]->Draw();
     }
 
     glUseProgram( 0 );
-  }*/
+  }
 }
 
 
@@ -1781,20 +3297,13 @@ Matrix4 CMainApplication::GetHMDMatrixProjectionEye( vr::Hmd_Eye nEye )
 //-----------------------------------------------------------------------------
 // Purpose:
 //-----------------------------------------------------------------------------
-Matrix4 CMainApplication::GetHMDMatrixPoseEye( vr::Hmd_Eye nEye )
+RigidTransform<EyeSpace, HeadSpace> CMainApplication::GetHMDMatrixPoseEye( vr::Hmd_Eye nEye )
 {
   if ( !m_pHMD )
-    return Matrix4();
+    return RigidTransform<EyeSpace, HeadSpace>();
 
   vr::HmdMatrix34_t matEyeRight = m_pHMD->GetEyeToHeadTransform( nEye );
-  Matrix4 matrixObj(
-    matEyeRight.m[0][0], matEyeRight.m[1][0], matEyeRight.m[2][0], 0.0, 
-    matEyeRight.m[0][1], matEyeRight.m[1][1], matEyeRight.m[2][1], 0.0,
-    matEyeRight.m[0][2], matEyeRight.m[1][2], matEyeRight.m[2][2], 0.0,
-    matEyeRight.m[0][3], matEyeRight.m[1][3], matEyeRight.m[2][3], 1.0f
-    );
-
-  return matrixObj.invert();
+  return RigidTransform<HeadSpace, EyeSpace>::fromHmdMatrix34( matEyeRight ).inverse();
 }
 
 
@@ -1806,11 +3315,11 @@ Matrix4 CMainApplication::GetCurrentViewProjectionMatrix( vr::Hmd_Eye nEye )
   Matrix4 matMVP;
   if( nEye == vr::Eye_Left )
   {
-    matMVP = m_mat4ProjectionLeft * m_mat4eyePosLeft * m_mat4HMDPose;
+    matMVP = m_mat4ProjectionLeft * ( m_xformEyePosLeft * m_xformHMDPose );
   }
   else if( nEye == vr::Eye_Right )
   {
-    matMVP = m_mat4ProjectionRight * m_mat4eyePosRight *  m_mat4HMDPose;
+    matMVP = m_mat4ProjectionRight * ( m_xformEyePosRight * m_xformHMDPose );
   }
 
   return matMVP;
@@ -1822,58 +3331,145 @@ Matrix4 CMainApplication::GetCurrentViewProjectionMatrix( vr::Hmd_Eye nEye )
 //-----------------------------------------------------------------------------
 void CMainApplication::UpdateHMDMatrixPose()
 {
+  if ( m_unBenchmarkFrames )
+  {
+    // RecordBenchmarkFrame hasn't counted the frame just rendered yet
+    SetBenchmarkCameraPose( m_unBenchmarkFrame + 1 );
+    return;
+  }
+
   if ( !m_pHMD )
     return;
 
   NvtxRangePushColored("WaitGetPoses", 0xFF000000);
-  vr::VRCompositor()->WaitGetPoses(m_rTrackedDevicePose, vr::k_unMaxTrackedDeviceCount, NULL, 0 );
+  vr::VRCompositor()->WaitGetPoses( &m_vecTrackedDevicePose[0], (uint32_t)m_vecTrackedDevicePose.size(), NULL, 0 );
   NvtxRangePop();
 
-  m_iValidPoseCount = 0;
-  m_strPoseClasses = "";
-  for ( int nDevice = 0; nDevice < vr::k_unMaxTrackedDeviceCount; ++nDevice )
+  if ( m_bLatencyTrace )
   {
-    if ( m_rTrackedDevicePose[nDevice].bPoseIsValid )
+    // The runtime doesn't say which driver sample the poses came from, so the
+    // trace of a real runtime starts here; motion_to_photon_sim covers the rest.
+    vr::Compositor_FrameTiming timing;
+    timing.size = sizeof( vr::Compositor_FrameTiming );
+    if ( vr::VRCompositor()->GetFrameTiming( &timing, 0 ) )
     {
-      m_iValidPoseCount++;
-      m_rmat4DevicePose[nDevice] = ConvertSteamVRMatrixToMatrix4( m_rTrackedDevicePose[nDevice].mDeviceToAbsoluteTracking );
-      if (m_rDevClassChar[nDevice]==0)
-      {
-        switch (m_pHMD->GetTrackedDeviceClass(nDevice))
-        {
-        case vr::TrackedDeviceClass_Controller:        m_rDevClassChar[nDevice] = 'C'; break;
-        case vr::TrackedDeviceClass_HMD:               m_rDevClassChar[nDevice] = 'H'; break;
-        case vr::TrackedDeviceClass_Invalid:           m_rDevClassChar[nDevice] = 'I'; break;
-        case vr::TrackedDeviceClass_Other:             m_rDevClassChar[nDevice] = 'O'; break;
-        case vr::TrackedDeviceClass_TrackingReference: m_rDevClassChar[nDevice] = 'T'; break;
-        default:                                       m_rDevClassChar[nDevice] = '?'; break;
-        }
-      }
-      m_strPoseClasses += m_rDevClassChar[nDevice];
+      m_unLatencyFrameIndex = timing.frameIndex;
+      m_latencyTracer.PosesReturned( timing.frameIndex, 0, Trace_GetTimestamp() );
     }
   }
 
-  if ( m_rTrackedDevicePose[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid )
+  ApplyTrackedDevicePoses();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Replaces the poses WaitGetPoses returned with ones predicted from
+//          now to when this frame reaches the display
+//-----------------------------------------------------------------------------
+void CMainApplication::UpdateLateHMDMatrixPose()
+{
+  float flSecondsSinceLastVsync = 0.0f;
+  m_pHMD->GetTimeSinceLastVsync( &flSecondsSinceLastVsync, NULL );
+
+  const float flPredictedSecondsFromNow = m_flFrameDuration - flSecondsSinceLastVsync + m_flVsyncToPhotons;
+  m_pHMD->GetDeviceToAbsoluteTrackingPose( vr::VRCompositor()->GetTrackingSpace(), flPredictedSecondsFromNow,
+    &m_vecTrackedDevicePose[0], (uint32_t)m_vecTrackedDevicePose.size() );
+
+  ApplyTrackedDevicePoses();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Updates the device table, matrices, pose counts and HMD pose from
+//          m_vecTrackedDevicePose. Only connected devices are looked at.
+//-----------------------------------------------------------------------------
+void CMainApplication::ApplyTrackedDevicePoses()
+{
+  m_trackedDevices.UpdatePoses( &m_vecTrackedDevicePose[0], (uint32_t)m_vecTrackedDevicePose.size() );
+  m_unConnectedPoses = std::min( (uint32_t)m_vecConnectedPoses.size(),
+    m_trackedDevices.GetPoseSnapshot( &m_vecConnectedPoses[0], &m_vecConnectedDevices[0], (uint32_t)m_vecConnectedPoses.size() ) );
+  m_unMatrixBlockDevices = std::min( m_unConnectedPoses, (uint32_t)MATRIX_BLOCK_DEVICE_COUNT );
+  ConvertSteamVRPosesToMatrices( &m_vecConnectedPoses[0], m_unMatrixBlockDevices, m_matrixBlock.rmat4DeviceToTracking );
+
+  m_iValidPoseCount = (int)m_trackedDevices.GetValidPoseCount();
+  m_strPoseClasses = "";
+  for ( uint32_t unConnected = 0; unConnected < m_unConnectedPoses; ++unConnected )
   {
-    m_mat4HMDPose = m_rmat4DevicePose[vr::k_unTrackedDeviceIndex_Hmd].invert();
+    if ( !m_vecConnectedPoses[ unConnected ].bPoseIsValid )
+      continue;
+
+    switch ( m_trackedDevices.GetDeviceClass( m_vecConnectedDevices[ unConnected ] ) )
+    {
+    case vr::TrackedDeviceClass_Controller:        m_strPoseClasses += 'C'; break;
+    case vr::TrackedDeviceClass_HMD:               m_strPoseClasses += 'H'; break;
+    case vr::TrackedDeviceClass_Invalid:           m_strPoseClasses += 'I'; break;
+    case vr::TrackedDeviceClass_Other:             m_strPoseClasses += 'O'; break;
+    case vr::TrackedDeviceClass_TrackingReference: m_strPoseClasses += 'T'; break;
+    default:                                       m_strPoseClasses += '?'; break;
+    }
   }
+
+  if ( m_trackedDevices.IsPoseValid( vr::k_unTrackedDeviceIndex_Hmd ) )
+  {
+    // tracking poses are rigid, so skip the general 4x4 inverse
+    m_xformHMDPose = RigidTransform<TrackingSpace, HeadSpace>::fromHmdMatrix34( m_trackedDevices.GetDeviceToAbsoluteTracking( vr::k_unTrackedDeviceIndex_Hmd ) ).inverse();
+  }
+
+  UpdateMatrixBlock();
 }
 
 
 //-----------------------------------------------------------------------------
-// Purpose: Finds a render model we've already loaded or loads a new one
+// Purpose: Refreshes both eye view-projections in the matrix block
 //-----------------------------------------------------------------------------
-CGLRenderModel *CMainApplication::FindOrLoadRenderModel( const char *pchRenderModelName )
+void CMainApplication::UpdateMatrixBlock()
+{
+  Matrix4 matLeft = GetCurrentViewProjectionMatrix( vr::Eye_Left );
+  Matrix4 matRight = GetCurrentViewProjectionMatrix( vr::Eye_Right );
+  memcpy( m_matrixBlock.rmat4ViewProjection[ vr::Eye_Left ], matLeft.get(), sizeof( float ) * 16 );
+  memcpy( m_matrixBlock.rmat4ViewProjection[ vr::Eye_Right ], matRight.get(), sizeof( float ) * 16 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Copies the matrix block into this frame's streaming region and
+//          binds it for the shaders
+//-----------------------------------------------------------------------------
+void CMainApplication::UploadMatrixBlock()
+{
+  GLintptr nOffset = 0;
+  void *pBlock = m_streamingBuffer.Alloc( sizeof( m_matrixBlock ), m_nUniformBufferAlignment, &nOffset );
+  if( !pBlock )
+    return;
+
+  // the whole block is bound, but only the matrices of connected devices are read
+  memcpy( pBlock, &m_matrixBlock, sizeof( m_matrixBlock.rmat4ViewProjection ) + m_unMatrixBlockDevices * sizeof( m_matrixBlock.rmat4DeviceToTracking[0] ) );
+  glBindBufferRange( GL_UNIFORM_BUFFER, k_unMatrixBlockBinding, m_streamingBuffer.GetBuffer(), nOffset, sizeof( m_matrixBlock ) );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Finds a render model we've already loaded
+//-----------------------------------------------------------------------------
+CGLRenderModel *CMainApplication::FindRenderModel( const char *pchRenderModelName )
 {
-  CGLRenderModel *pRenderModel = NULL;
   for( std::vector< CGLRenderModel * >::iterator i = m_vecRenderModels.begin(); i != m_vecRenderModels.end(); i++ )
   {
     if( !stricmp( (*i)->GetName().c_str(), pchRenderModelName ) )
     {
-      pRenderModel = *i;
-      break;
+      return *i;
     }
   }
+  return NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Finds a render model we've already loaded or loads a new one
+//-----------------------------------------------------------------------------
+CGLRenderModel *CMainApplication::FindOrLoadRenderModel( const char *pchRenderModelName )
+{
+  CGLRenderModel *pRenderModel = FindRenderModel( pchRenderModelName );
 
   // load the model if we didn't find one
   if( !pRenderModel )
@@ -1893,30 +3489,41 @@ CGLRenderModel *CMainApplication::FindOrLoadRenderModel( const char *pchRenderMo
       return NULL; // move on to the next tracked device
     }
 
-    pRenderModel = new CGLRenderModel( pchRenderModelName );
-    if ( !pRenderModel->BInit( *pModel, *pTexture ) )
-    {
-      dprintf( "Unable to create GL model from render model %s\n", pchRenderModelName );
-      delete pRenderModel;
-      pRenderModel = NULL;
-    }
-    else
-    {
-      m_vecRenderModels.push_back( pRenderModel );
-    }
-    vr::VRRenderModels()->FreeRenderModel( pModel );
-    vr::VRRenderModels()->FreeTexture( pTexture );
+    pRenderModel = CreateRenderModel( pchRenderModelName, pModel, pTexture );
   }
   return pRenderModel;
 }
 
 
+//-----------------------------------------------------------------------------
+// Purpose: Makes a GL model from a loaded render model and its texture, then
+//          frees both
+//-----------------------------------------------------------------------------
+CGLRenderModel *CMainApplication::CreateRenderModel( const char *pchRenderModelName, vr::RenderModel_t *pModel, vr::RenderModel_TextureMap_t *pTexture )
+{
+  CGLRenderModel *pRenderModel = new CGLRenderModel( pchRenderModelName );
+  if ( !pRenderModel->BInit( *pModel, *pTexture ) )
+  {
+    dprintf( "Unable to create GL model from render model %s\n", pchRenderModelName );
+    delete pRenderModel;
+    pRenderModel = NULL;
+  }
+  else
+  {
+    m_vecRenderModels.push_back( pRenderModel );
+  }
+  vr::VRRenderModels()->FreeRenderModel( pModel );
+  vr::VRRenderModels()->FreeTexture( pTexture );
+  return pRenderModel;
+}
+
+
 //-----------------------------------------------------------------------------
 // Purpose: Create/destroy GL a Render Model for a single tracked device
 //-----------------------------------------------------------------------------
 void CMainApplication::SetupRenderModelForTrackedDevice( vr::TrackedDeviceIndex_t unTrackedDeviceIndex )
 {
-  if( unTrackedDeviceIndex >= vr::k_unMaxTrackedDeviceCount )
+  if( unTrackedDeviceIndex >= m_vecTrackedDeviceToRenderModel.size() )
     return;
 
   // try to find a model we've already set up
@@ -1929,45 +3536,201 @@ void CMainApplication::SetupRenderModelForTrackedDevice( vr::TrackedDeviceIndex_
   }
   else
   {
-    m_rTrackedDeviceToRenderModel[ unTrackedDeviceIndex ] = pRenderModel;
-    m_rbShowTrackedDevice[ unTrackedDeviceIndex ] = true;
+    m_vecTrackedDeviceToRenderModel[ unTrackedDeviceIndex ] = pRenderModel;
+    m_vecShowTrackedDevice[ unTrackedDeviceIndex ] = true;
   }
 }
 
 
+//-----------------------------------------------------------------------------
+// Purpose: Fills the device table with the devices connected at startup.
+//          Later ones arrive as VREvent_TrackedDeviceActivated.
+//-----------------------------------------------------------------------------
+void CMainApplication::SetupTrackedDevices()
+{
+  GrowTrackedDeviceArrays();
+  if( !m_pHMD )
+    return;
+
+  // these are the indices the runtime's startup queries cover
+  for( uint32_t unTrackedDevice = 0; unTrackedDevice < vr::k_unMaxTrackedDeviceCount; unTrackedDevice++ )
+  {
+    if( m_pHMD->IsTrackedDeviceConnected( unTrackedDevice ) )
+      SetTrackedDeviceConnected( unTrackedDevice, true );
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CMainApplication::SetTrackedDeviceConnected( vr::TrackedDeviceIndex_t unDevice, bool bConnected )
+{
+  if( bConnected && m_pHMD )
+    m_trackedDevices.SetDeviceConnected( unDevice, m_pHMD->GetTrackedDeviceClass( unDevice ) );
+  else
+    m_trackedDevices.SetDeviceDisconnected( unDevice );
+
+  GrowTrackedDeviceArrays();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Keeps every array indexed by device as large as the device table,
+//          which grows when a device past its end connects
+//-----------------------------------------------------------------------------
+void CMainApplication::GrowTrackedDeviceArrays()
+{
+  const uint32_t unCapacity = m_trackedDevices.GetCapacity();
+  if( m_vecTrackedDevicePose.size() >= unCapacity )
+    return;
+
+  vr::TrackedDevicePose_t invalidPose;
+  memset( &invalidPose, 0, sizeof( invalidPose ) );
+  m_vecTrackedDevicePose.resize( unCapacity, invalidPose );
+  m_vecConnectedPoses.resize( unCapacity, invalidPose );
+  m_vecConnectedDevices.resize( unCapacity, vr::k_unTrackedDeviceIndexInvalid );
+  m_vecShowTrackedDevice.resize( unCapacity, false );
+  m_vecTrackedDeviceToRenderModel.resize( unCapacity, NULL );
+}
+
+
 //-----------------------------------------------------------------------------
 // Purpose: Create/destroy GL Render Models
 //-----------------------------------------------------------------------------
 void CMainApplication::SetupRenderModels()
 {
-  memset( m_rTrackedDeviceToRenderModel, 0, sizeof( m_rTrackedDeviceToRenderModel ) );
-
   if( !m_pHMD )
     return;
 
-  for( uint32_t unTrackedDevice = vr::k_unTrackedDeviceIndex_Hmd + 1; unTrackedDevice < vr::k_unMaxTrackedDeviceCount; unTrackedDevice++ )
+  for( uint32_t unConnected = 0; unConnected < m_trackedDevices.GetConnectedCount(); unConnected++ )
   {
-    if( !m_pHMD->IsTrackedDeviceConnected( unTrackedDevice ) )
+    const vr::TrackedDeviceIndex_t unTrackedDevice = m_trackedDevices.GetConnectedDevice( unConnected );
+    if( unTrackedDevice == vr::k_unTrackedDeviceIndex_Hmd )
       continue;
 
-    SetupRenderModelForTrackedDevice( unTrackedDevice );
+    LoadedRenderModel_t model = { unTrackedDevice, GetTrackedDeviceString( m_pHMD, unTrackedDevice, vr::Prop_RenderModelName_String ), NULL, NULL };
+    m_vecLoadedRenderModels.push_back( model );
   }
+  if( m_vecLoadedRenderModels.empty() )
+    return;
 
+  // Reading the models can take a while and the first frames don't need
+  // them. FinishRenderModelLoads creates the GL models once they're in.
+  m_renderModelThread = std::thread( [this]
+  {
+    CStartupPhaseScope phase( m_startupProfiler, "LoadRenderModels" );
+    for( size_t i = 0; i < m_vecLoadedRenderModels.size(); i++ )
+    {
+      LoadedRenderModel_t &model = m_vecLoadedRenderModels[i];
+
+      // two devices often share a model
+      bool bLoadedAlready = false;
+      for( size_t j = 0; j < i; j++ )
+      {
+        bLoadedAlready = bLoadedAlready || m_vecLoadedRenderModels[j].sName == model.sName;
+      }
+      if( bLoadedAlready )
+        continue;
+
+      if( !m_pRenderModels->LoadRenderModel( model.sName.c_str(), &model.pModel ) || model.pModel == NULL )
+      {
+        model.pModel = NULL;
+        continue;
+      }
+      if( !m_pRenderModels->LoadTexture( model.pModel->diffuseTextureId, &model.pTexture ) || model.pTexture == NULL )
+      {
+        m_pRenderModels->FreeRenderModel( model.pModel );
+        model.pModel = NULL;
+        model.pTexture = NULL;
+      }
+    }
+    m_bRenderModelsLoaded = true;
+  } );
 }
 
 
 //-----------------------------------------------------------------------------
-// Purpose: Converts a SteamVR matrix to our local matrix class
+// Purpose: Once the render model thread is done, makes GL models from what
+//          it loaded and assigns them to their devices. Cheap to call every
+//          frame until then.
 //-----------------------------------------------------------------------------
-Matrix4 CMainApplication::ConvertSteamVRMatrixToMatrix4( const vr::HmdMatrix34_t &matPose )
+void CMainApplication::FinishRenderModelLoads()
 {
-  Matrix4 matrixObj(
-    matPose.m[0][0], matPose.m[1][0], matPose.m[2][0], 0.0,
-    matPose.m[0][1], matPose.m[1][1], matPose.m[2][1], 0.0,
-    matPose.m[0][2], matPose.m[1][2], matPose.m[2][2], 0.0,
-    matPose.m[0][3], matPose.m[1][3], matPose.m[2][3], 1.0f
-    );
-  return matrixObj;
+  if( !m_bRenderModelsLoaded )
+    return;
+
+  m_renderModelThread.join();
+  m_bRenderModelsLoaded = false;
+
+  for( size_t i = 0; i < m_vecLoadedRenderModels.size(); i++ )
+  {
+    LoadedRenderModel_t &model = m_vecLoadedRenderModels[i];
+
+    // shared by an earlier device, or set up by an activation event meanwhile
+    CGLRenderModel *pRenderModel = FindRenderModel( model.sName.c_str() );
+    if( pRenderModel && model.pModel )
+    {
+      m_pRenderModels->FreeRenderModel( model.pModel );
+      m_pRenderModels->FreeTexture( model.pTexture );
+    }
+    else if( !pRenderModel && model.pModel )
+    {
+      pRenderModel = CreateRenderModel( model.sName.c_str(), model.pModel, model.pTexture );
+    }
+
+    if( !pRenderModel )
+    {
+      dprintf( "Unable to load render model for tracked device %d (%s)\n", model.unTrackedDevice, model.sName.c_str() );
+      continue;
+    }
+    m_vecTrackedDeviceToRenderModel[ model.unTrackedDevice ] = pRenderModel;
+    m_vecShowTrackedDevice[ model.unTrackedDevice ] = true;
+  }
+  m_vecLoadedRenderModels.clear();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Converts the row major 3x4 SteamVR poses to column major 4x4
+//          matrices in one pass. Invalid poses are converted too; callers
+//          check bPoseIsValid before using them.
+//-----------------------------------------------------------------------------
+void CMainApplication::ConvertSteamVRPosesToMatrices( const vr::TrackedDevicePose_t *pPoses, uint32_t unCount, float (*prmat4Out)[16] )
+{
+  for( uint32_t i = 0; i < unCount; i++ )
+  {
+    const float *pRows = &pPoses[i].mDeviceToAbsoluteTracking.m[0][0];
+    float *pOut = prmat4Out[i];
+#if defined( MATRICES_SSE )
+    __m128 r0 = _mm_loadu_ps( pRows );
+    __m128 r1 = _mm_loadu_ps( pRows + 4 );
+    __m128 r2 = _mm_loadu_ps( pRows + 8 );
+    __m128 r3 = _mm_setr_ps( 0.0f, 0.0f, 0.0f, 1.0f );
+    _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+    _mm_storeu_ps( pOut, r0 );
+    _mm_storeu_ps( pOut + 4, r1 );
+    _mm_storeu_ps( pOut + 8, r2 );
+    _mm_storeu_ps( pOut + 12, r3 );
+#elif defined( MATRICES_NEON )
+    // vst4q interleaves the four rows, which writes out the columns
+    static const float rflLastRow[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    float32x4x4_t rows;
+    rows.val[0] = vld1q_f32( pRows );
+    rows.val[1] = vld1q_f32( pRows + 4 );
+    rows.val[2] = vld1q_f32( pRows + 8 );
+    rows.val[3] = vld1q_f32( rflLastRow );
+    vst4q_f32( pOut, rows );
+#else
+    for( int nCol = 0; nCol < 4; nCol++ )
+    {
+      pOut[ nCol * 4 + 0 ] = pRows[ nCol ];
+      pOut[ nCol * 4 + 1 ] = pRows[ 4 + nCol ];
+      pOut[ nCol * 4 + 2 ] = pRows[ 8 + nCol ];
+      pOut[ nCol * 4 + 3 ] = nCol == 3 ? 1.0f : 0.0f;
+    }
+#endif
+  }
 }
 
 
@@ -2079,6 +3842,271 @@ void CGLRenderModel::Draw()
 }
 
 
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CGLStreamingBuffer::CGLStreamingBuffer()
+  : m_glBuffer( 0 )
+  , m_pMapped( NULL )
+  , m_nBytesPerFrame( 0 )
+  , m_nFrameEnd( 0 )
+  , m_nHead( 0 )
+  , m_nFrame( 0 )
+{
+}
+
+
+CGLStreamingBuffer::~CGLStreamingBuffer()
+{
+  Cleanup();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Allocates and maps the buffer for its whole lifetime
+//-----------------------------------------------------------------------------
+bool CGLStreamingBuffer::BInit( GLsizeiptr nBytesPerFrame, int nFrames )
+{
+  // keep every region start aligned for any uniform buffer offset alignment
+  m_nBytesPerFrame = ( nBytesPerFrame + 4095 ) & ~(GLsizeiptr)4095;
+
+  const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+  glGenBuffers( 1, &m_glBuffer );
+  glBindBuffer( GL_ARRAY_BUFFER, m_glBuffer );
+  glBufferStorage( GL_ARRAY_BUFFER, m_nBytesPerFrame * nFrames, NULL, flags );
+  m_pMapped = (unsigned char *)glMapBufferRange( GL_ARRAY_BUFFER, 0, m_nBytesPerFrame * nFrames, flags );
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+  if( !m_pMapped )
+  {
+    Cleanup();
+    return false;
+  }
+
+  m_vecRegionFence.assign( nFrames, (GLsync)0 );
+  BeginFrame( 0 );
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CGLStreamingBuffer::Cleanup()
+{
+  for( size_t i = 0; i < m_vecRegionFence.size(); i++ )
+  {
+    if( m_vecRegionFence[i] )
+      glDeleteSync( m_vecRegionFence[i] );
+  }
+  m_vecRegionFence.clear();
+
+  if( m_glBuffer )
+  {
+    if( m_pMapped )
+    {
+      glBindBuffer( GL_ARRAY_BUFFER, m_glBuffer );
+      glUnmapBuffer( GL_ARRAY_BUFFER );
+      glBindBuffer( GL_ARRAY_BUFFER, 0 );
+    }
+    glDeleteBuffers( 1, &m_glBuffer );
+    m_glBuffer = 0;
+    m_pMapped = NULL;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CGLStreamingBuffer::BeginFrame( int nFrame )
+{
+  if( nFrame < (int)m_vecRegionFence.size() && m_vecRegionFence[ nFrame ] )
+  {
+    GLenum eResult;
+    do
+    {
+      eResult = glClientWaitSync( m_vecRegionFence[ nFrame ], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000 ); // 1ms
+    } while( eResult == GL_TIMEOUT_EXPIRED );
+
+    glDeleteSync( m_vecRegionFence[ nFrame ] );
+    m_vecRegionFence[ nFrame ] = 0;
+  }
+
+  m_nFrame = nFrame;
+  m_nHead = m_nBytesPerFrame * nFrame;
+  m_nFrameEnd = m_nHead + m_nBytesPerFrame;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CGLStreamingBuffer::EndFrame()
+{
+  if( m_nFrame >= (int)m_vecRegionFence.size() )
+    return;
+
+  if( m_vecRegionFence[ m_nFrame ] )
+    glDeleteSync( m_vecRegionFence[ m_nFrame ] );
+  m_vecRegionFence[ m_nFrame ] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void *CGLStreamingBuffer::Alloc( GLsizeiptr nBytes, GLsizeiptr nAlignment, GLintptr *pnOffset )
+{
+  GLintptr nOffset = ( m_nHead + nAlignment - 1 ) / nAlignment * nAlignment;
+  if( !m_pMapped || nOffset + nBytes > m_nFrameEnd )
+    return NULL;
+
+  m_nHead = nOffset + nBytes;
+  *pnOffset = nOffset;
+  return m_pMapped + nOffset;
+}
+
+
+// On disk a cached program is this header followed by the binary
+struct ProgramCacheHeader_t
+{
+  uint32_t unMagic;
+  uint32_t unVersion;
+  uint64_t ulKey;                                          // checked against the key that named the file
+  uint32_t unFormat;
+  uint32_t unBinaryBytes;
+};
+static const uint32_t k_unProgramCacheMagic = 0x42505648; // 'HVPB'
+static const uint32_t k_unProgramCacheVersion = 1;
+
+//-----------------------------------------------------------------------------
+// Purpose: 64 bit FNV-1a, chained through ulHash
+//-----------------------------------------------------------------------------
+static uint64_t HashString( const char *pchString, uint64_t ulHash = 14695981039346656037ULL )
+{
+  for( const unsigned char *pch = (const unsigned char *)pchString; pch && *pch; pch++ )
+  {
+    ulHash = ( ulHash ^ *pch ) * 1099511628211ULL;
+  }
+  return ulHash;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CGLProgramCache::CGLProgramCache()
+  : m_bEnabled( false )
+  , m_ulContextHash( 0 )
+{
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool CGLProgramCache::BInit( const std::string &sDirectory )
+{
+  GLint nFormats = 0;
+  glGetIntegerv( GL_NUM_PROGRAM_BINARY_FORMATS, &nFormats );
+  if( nFormats <= 0 )
+    return false;
+
+  if( !Path_CreateDirectory( sDirectory ) )
+    return false;
+
+  m_sDirectory = sDirectory;
+  m_ulContextHash = HashString( (const char *)glGetString( GL_VERSION ), HashString( (const char *)glGetString( GL_RENDERER ) ) );
+  m_bEnabled = true;
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+std::string CGLProgramCache::GetFilename( const char *pchVertexShader, const char *pchFragmentShader, uint64_t *pulKey ) const
+{
+  *pulKey = HashString( pchFragmentShader, HashString( pchVertexShader, m_ulContextHash ) );
+
+  char rchFilename[ 32 ];
+  sprintf_s( rchFilename, sizeof( rchFilename ), "%016llx.glprogram", (unsigned long long)*pulKey );
+  return Path_Join( m_sDirectory, rchFilename );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+GLuint CGLProgramCache::LoadProgram( const char *pchVertexShader, const char *pchFragmentShader ) const
+{
+  if( !m_bEnabled )
+    return 0;
+
+  uint64_t ulKey;
+  CMappedFile file( GetFilename( pchVertexShader, pchFragmentShader, &ulKey ) );
+  if( !file.IsValid() || file.Size() < sizeof( ProgramCacheHeader_t ) )
+    return 0;
+
+  ProgramCacheHeader_t header;
+  memcpy( &header, file.Data(), sizeof( header ) );
+  if( header.unMagic != k_unProgramCacheMagic || header.unVersion != k_unProgramCacheVersion || header.ulKey != ulKey
+    || file.Size() != sizeof( header ) + header.unBinaryBytes )
+    return 0;
+
+  GLuint unProgram = glCreateProgram();
+  glProgramBinary( unProgram, header.unFormat, file.Data() + sizeof( header ), header.unBinaryBytes );
+
+  // drivers may reject binaries they wrote themselves, e.g. after an update
+  // that kept the version string
+  GLint nLinked = GL_FALSE;
+  glGetProgramiv( unProgram, GL_LINK_STATUS, &nLinked );
+  if( nLinked != GL_TRUE )
+  {
+    glDeleteProgram( unProgram );
+    return 0;
+  }
+
+  return unProgram;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CGLProgramCache::StoreProgram( const char *pchVertexShader, const char *pchFragmentShader, GLuint unProgram ) const
+{
+  if( !m_bEnabled || !unProgram )
+    return;
+
+  GLint nLength = 0;
+  glGetProgramiv( unProgram, GL_PROGRAM_BINARY_LENGTH, &nLength );
+  if( nLength <= 0 )
+    return;
+
+  std::vector< unsigned char > vecFile( sizeof( ProgramCacheHeader_t ) + nLength );
+  GLsizei nWritten = 0;
+  GLenum eFormat = 0;
+  glGetProgramBinary( unProgram, nLength, &nWritten, &eFormat, &vecFile[ sizeof( ProgramCacheHeader_t ) ] );
+  if( nWritten <= 0 )
+    return;
+
+  ProgramCacheHeader_t header;
+  header.unMagic = k_unProgramCacheMagic;
+  header.unVersion = k_unProgramCacheVersion;
+  header.unFormat = eFormat;
+  header.unBinaryBytes = nWritten;
+  const std::string sFilename = GetFilename( pchVertexShader, pchFragmentShader, &header.ulKey );
+  memcpy( &vecFile[0], &header, sizeof( header ) );
+
+  if( !Path_WriteBinaryFile( sFilename, &vecFile[0], sizeof( header ) + nWritten ) )
+  {
+    dprintf( "Unable to write program cache entry %s\n", sFilename.c_str() );
+  }
+}
+
+
 //-----------------------------------------------------------------------------
 // Purpose:
 //-----------------------------------------------------------------------------
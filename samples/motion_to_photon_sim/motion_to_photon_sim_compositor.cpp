@@ -0,0 +1,187 @@
+//========= Copyright Valve Corporation ============//
+//
+// The compositor half of the simulation: frame pacing with running start, and a present
+// at every vsync of the newest frame submitted in time, reported through Compositor_FrameTiming.
+//
+#include "motion_to_photon_sim_compositor.h"
+
+#include <algorithm>
+#include <string.h>
+
+#include "motion_to_photon_sim_driver.h"
+#include "shared/RigidTransform.h"
+#include "shared/tracebuffer.h"
+
+// frame timings kept for GetFrameTiming, as the runtime keeps a few seconds' worth
+static const uint32_t k_unFrameTimings = 128;
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CSimulatedCompositor::CSimulatedCompositor( const SimulatedCompositorSettings_t &settings )
+	: m_settings( settings )
+	, m_ulStartTicks( 0 )
+	, m_ulFrameTicks( (uint64_t)( Trace_GetTimestampFrequency() / std::max( 1.0, settings.flRefreshHz ) ) )
+	, m_ulLastFrameVsync( 0 )
+	, m_vecTimings( k_unFrameTimings )
+	, m_unFrameIndex( 0 )
+	, m_unSubmittedFrame( 0 )
+	, m_bRunning( false )
+{
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CSimulatedCompositor::~CSimulatedCompositor()
+{
+	Stop();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Vsync 0 is when Start was called
+//-----------------------------------------------------------------------------
+uint64_t CSimulatedCompositor::GetVsyncTicks( uint64_t ulVsync ) const
+{
+	return m_ulStartTicks + ulVsync * m_ulFrameTicks;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CSimulatedCompositor::Start()
+{
+	if ( m_bRunning.load() )
+		return;
+
+	m_ulStartTicks = Trace_GetTimestamp();
+	m_bRunning.store( true );
+	m_thread = std::thread( &CSimulatedCompositor::CompositorThread, this );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CSimulatedCompositor::Stop()
+{
+	if ( !m_bRunning.exchange( false ) )
+		return;
+
+	m_thread.join();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Like the runtime, returns flRunningStartMs before a vsync so the
+//			GPU can start on the frame as that vsync passes. A frame that ran
+//			long has missed its slot and waits for the one after.
+//-----------------------------------------------------------------------------
+void CSimulatedCompositor::WaitGetPoses( vr::TrackedDevicePose_t *pRenderPose, uint32_t *punPoseId )
+{
+	const uint64_t ulRunningStartTicks = (uint64_t)( m_settings.flRunningStartMs * Trace_GetTimestampFrequency() / 1000.0 );
+	const uint64_t ulNow = Trace_GetTimestamp();
+	uint64_t ulVsync = std::max< uint64_t >( m_ulLastFrameVsync + 1, ( ulNow + ulRunningStartTicks - m_ulStartTicks ) / m_ulFrameTicks + 1 );
+	m_ulLastFrameVsync = ulVsync;
+	Sim_SleepUntil( GetVsyncTicks( ulVsync ) - ulRunningStartTicks );
+
+	SimulatedPose_t pose;
+	const bool bHasPose = SimDriver_GetLatestPose( &pose );
+	*punPoseId = bHasPose ? pose.unPoseId : 0;
+
+	memset( pRenderPose, 0, sizeof( *pRenderPose ) );
+	pRenderPose->bDeviceIsConnected = bHasPose;
+	pRenderPose->bPoseIsValid = bHasPose;
+	pRenderPose->eTrackingResult = bHasPose ? vr::TrackingResult_Running_OK : vr::TrackingResult_Uninitialized;
+	if ( bHasPose )
+	{
+		// RigidTransform's rotation is column major, HmdMatrix34_t is row major
+		const RigidTransform<> transform = RigidTransform<>::fromQuaternion( pose.rflRotation[0], pose.rflRotation[1], pose.rflRotation[2], pose.rflRotation[3],
+			pose.rflPosition[0], pose.rflPosition[1], pose.rflPosition[2] );
+		const float *pflRotation = transform.getRotation();
+		for ( int nRow = 0; nRow < 3; nRow++ )
+		{
+			for ( int nColumn = 0; nColumn < 3; nColumn++ )
+				pRenderPose->mDeviceToAbsoluteTracking.m[ nRow ][ nColumn ] = pflRotation[ nColumn * 3 + nRow ];
+		}
+		pRenderPose->mDeviceToAbsoluteTracking.m[0][3] = transform.getTranslation().x;
+		pRenderPose->mDeviceToAbsoluteTracking.m[1][3] = transform.getTranslation().y;
+		pRenderPose->mDeviceToAbsoluteTracking.m[2][3] = transform.getTranslation().z;
+	}
+
+	std::lock_guard< std::mutex > lock( m_mutex );
+	vr::Compositor_FrameTiming &timing = m_vecTimings[ ++m_unFrameIndex % k_unFrameTimings ];
+	memset( &timing, 0, sizeof( timing ) );
+	timing.size = sizeof( timing );
+	timing.frameIndex = m_unFrameIndex;
+	timing.frameStart = (double)Trace_GetTimestamp() / Trace_GetTimestampFrequency();
+	timing.pose = *pRenderPose;
+	timing.m_flRunningStartMs = (float)m_settings.flRunningStartMs;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CSimulatedCompositor::Submit()
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	vr::Compositor_FrameTiming &timing = m_vecTimings[ m_unFrameIndex % k_unFrameTimings ];
+	timing.m_flSceneRenderCpuMs = (float)( ( (double)Trace_GetTimestamp() / Trace_GetTimestampFrequency() - timing.frameStart ) * 1000.0 );
+	m_unSubmittedFrame.store( m_unFrameIndex, std::memory_order_release );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool CSimulatedCompositor::GetFrameTiming( vr::Compositor_FrameTiming *pTiming, uint32_t unFramesAgo )
+{
+	if ( pTiming->size != sizeof( vr::Compositor_FrameTiming ) )
+		return false;
+
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( unFramesAgo >= k_unFrameTimings || unFramesAgo >= m_unFrameIndex )
+		return false;
+
+	*pTiming = m_vecTimings[ ( m_unFrameIndex - unFramesAgo ) % k_unFrameTimings ];
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Before each vsync takes the newest submitted frame, spends
+//			flCompositorMs on it and presents it at the vsync. With nothing
+//			new the last frame is presented again, as reprojection would.
+//-----------------------------------------------------------------------------
+void CSimulatedCompositor::CompositorThread()
+{
+	const uint64_t ulCompositorTicks = (uint64_t)( m_settings.flCompositorMs * Trace_GetTimestampFrequency() / 1000.0 );
+	const double flFrameMs = 1000.0 / std::max( 1.0, m_settings.flRefreshHz );
+
+	for ( uint64_t ulVsync = 1; m_bRunning.load( std::memory_order_relaxed ); ulVsync++ )
+	{
+		const uint64_t ulVsyncTicks = GetVsyncTicks( ulVsync );
+		Sim_SleepUntil( ulVsyncTicks > ulCompositorTicks ? ulVsyncTicks - ulCompositorTicks : 0 );
+		const uint32_t unFrame = m_unSubmittedFrame.load( std::memory_order_acquire );
+		Sim_SleepUntil( ulVsyncTicks );
+		if ( unFrame == 0 )
+			continue;
+
+		std::lock_guard< std::mutex > lock( m_mutex );
+		vr::Compositor_FrameTiming &timing = m_vecTimings[ unFrame % k_unFrameTimings ];
+		if ( timing.frameIndex != unFrame )
+			continue;
+
+		if ( timing.m_nPresents++ == 0 )
+		{
+			timing.frameVSync = (float)( (double)ulVsyncTicks / Trace_GetTimestampFrequency() - timing.frameStart );
+			timing.m_flFrameIntervalMs = (float)flFrameMs;
+			timing.m_flCompositorRenderCpuMs = (float)m_settings.flCompositorMs;
+		}
+	}
+}
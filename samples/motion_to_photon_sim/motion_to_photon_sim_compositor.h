@@ -0,0 +1,63 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <openvr.h>
+
+struct SimulatedCompositorSettings_t
+{
+	double flRefreshHz;
+	double flRunningStartMs;	// how long before vsync WaitGetPoses returns
+	double flCompositorMs;		// how long before vsync the compositor takes the newest submitted frame
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Stands in for the compositor's frame pacing. WaitGetPoses returns
+//			at running start with the driver's newest pose, and a thread wakes
+//			before every vsync to present the newest submitted frame, keeping
+//			a Compositor_FrameTiming per frame the way IVRCompositor does.
+//-----------------------------------------------------------------------------
+class CSimulatedCompositor
+{
+public:
+	explicit CSimulatedCompositor( const SimulatedCompositorSettings_t &settings );
+	~CSimulatedCompositor();
+
+	void Start();
+	void Stop();
+
+	/** Blocks until the next frame's running start, then starts that frame with the HMD pose.
+	* punPoseId gets the tracer id of the sample the pose came from. */
+	void WaitGetPoses( vr::TrackedDevicePose_t *pRenderPose, uint32_t *punPoseId );
+
+	/** Hands the frame WaitGetPoses last started to the compositor */
+	void Submit();
+
+	/** As IVRCompositor::GetFrameTiming. frameStart is in seconds of Trace_GetTimestamp(). */
+	bool GetFrameTiming( vr::Compositor_FrameTiming *pTiming, uint32_t unFramesAgo );
+
+private:
+	CSimulatedCompositor( const CSimulatedCompositor & );
+	CSimulatedCompositor & operator=( const CSimulatedCompositor & );
+
+	void CompositorThread();
+	uint64_t GetVsyncTicks( uint64_t ulVsync ) const;
+
+	SimulatedCompositorSettings_t m_settings;
+	uint64_t m_ulStartTicks;
+	uint64_t m_ulFrameTicks;
+	uint64_t m_ulLastFrameVsync;	// the vsync WaitGetPoses last waited for
+
+	std::mutex m_mutex;
+	std::vector< vr::Compositor_FrameTiming > m_vecTimings;	// ring, indexed by frame index
+	uint32_t m_unFrameIndex;	// the frame WaitGetPoses last started
+	std::atomic< uint32_t > m_unSubmittedFrame;	// 0 until the first Submit
+
+	std::thread m_thread;
+	std::atomic< bool > m_bRunning;
+};
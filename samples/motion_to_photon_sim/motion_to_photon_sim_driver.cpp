@@ -0,0 +1,273 @@
+//========= Copyright Valve Corporation ============//
+//
+// The driver half of the simulation: an HMD and two controllers reporting poses to an
+// IServerDriverHost that stands in for vrserver, tags every sample for the latency tracer
+// and can log the poses for pose_prediction_benchmark.
+//
+#include "motion_to_photon_sim_driver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <math.h>
+#include <string.h>
+
+#include <openvr_driver.h>
+
+#include "shared/driverposelog.h"
+#include "shared/tracebuffer.h"
+
+// within this much of the target time Sim_SleepUntil spins instead of sleeping, since sleeps are coarse
+static const uint64_t k_ulSpinMicroseconds = 2000;
+
+/** How one simulated device moves: it swings about the vertical axis and sways sideways
+* and up and down, each as a sine, so its velocity and acceleration are known exactly */
+struct SimulatedMotion_t
+{
+	vr::ETrackedDeviceClass eClass;
+	double rflOrigin[ 3 ];
+	double flYawRadians;	// amplitude
+	double flYawRate;		// radians per second of the sine
+	double flSwayMeters;
+	double flSwayRate;
+};
+
+static const SimulatedMotion_t k_rSimulatedDevices[] =
+{
+	{ vr::TrackedDeviceClass_HMD, { 0.0, 1.7, 0.0 }, 0.6, 1.5, 0.05, 2.0 },
+	{ vr::TrackedDeviceClass_Controller, { -0.25, 1.1, -0.3 }, 1.2, 4.0, 0.3, 5.0 },
+	{ vr::TrackedDeviceClass_Controller, { 0.25, 1.1, -0.3 }, 1.0, 3.3, 0.25, 6.0 },
+};
+static const uint32_t k_unSimulatedDevices = sizeof( k_rSimulatedDevices ) / sizeof( k_rSimulatedDevices[0] );
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void Sim_SleepUntil( uint64_t ulTicks )
+{
+	const uint64_t ulSpinTicks = k_ulSpinMicroseconds * Trace_GetTimestampFrequency() / 1000000;
+	for ( ;; )
+	{
+		const uint64_t ulNow = Trace_GetTimestamp();
+		if ( ulNow >= ulTicks )
+			return;
+
+		if ( ulTicks - ulNow > ulSpinTicks )
+			std::this_thread::sleep_for( std::chrono::microseconds( ( ulTicks - ulNow - ulSpinTicks ) * 1000000 / Trace_GetTimestampFrequency() ) );
+		else
+			std::this_thread::yield();
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Only pose updates matter here; everything else is accepted and dropped
+//-----------------------------------------------------------------------------
+class CSimulatedServerDriverHost final : public vr::IServerDriverHost
+{
+public:
+	CSimulatedServerDriverHost( CLatencyTracer *pTracer, const char *pchPoseLog );
+
+	virtual bool TrackedDeviceAdded( const vr::TrackedDeviceDriverInfo_t &info );
+	virtual void TrackedDeviceInfoUpdated( uint32_t, const vr::TrackedDeviceDriverInfo_t & ) {}
+	virtual void TrackedDevicePoseUpdated( uint32_t unWhichDevice, const vr::DriverPose_t &newPose );
+	virtual void TrackedDevicePropertiesChanged( uint32_t ) {}
+	virtual void VsyncEvent( double ) {}
+	virtual void TrackedDeviceButtonPressed( uint32_t, vr::EVRButtonId, double ) {}
+	virtual void TrackedDeviceButtonUnpressed( uint32_t, vr::EVRButtonId, double ) {}
+	virtual void TrackedDeviceButtonTouched( uint32_t, vr::EVRButtonId, double ) {}
+	virtual void TrackedDeviceButtonUntouched( uint32_t, vr::EVRButtonId, double ) {}
+	virtual void TrackedDeviceAxisUpdated( uint32_t, uint32_t, const vr::VRControllerAxis_t & ) {}
+	virtual void MCImageUpdated() {}
+	virtual vr::IVRSettings *GetSettings() { return NULL; }
+	virtual void PhysicalIpdSet( uint32_t, float ) {}
+	virtual void ProximitySensorState( uint32_t, bool ) {}
+	virtual void VendorSpecificEvent( uint32_t, vr::EVREventType, const vr::VREvent_Data_t &, double ) {}
+
+	bool GetLatestPose( SimulatedPose_t *pPose );
+
+private:
+	CLatencyTracer *m_pTracer;
+	CDriverPoseLogWriter m_poseLog;
+	std::atomic< uint32_t > m_unDevices;
+	std::mutex m_mutex;
+	SimulatedPose_t m_latestPose;
+	bool m_bHasPose;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CSimulatedServerDriverHost::CSimulatedServerDriverHost( CLatencyTracer *pTracer, const char *pchPoseLog )
+	: m_pTracer( pTracer )
+	, m_unDevices( 0 )
+	, m_bHasPose( false )
+{
+	memset( &m_latestPose, 0, sizeof( m_latestPose ) );
+	if ( pchPoseLog && !m_poseLog.Open( pchPoseLog ) )
+		fprintf( stderr, "Unable to write the pose log %s\n", pchPoseLog );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Devices get indices in the order they are added, as with vrserver
+//-----------------------------------------------------------------------------
+bool CSimulatedServerDriverHost::TrackedDeviceAdded( const vr::TrackedDeviceDriverInfo_t &info )
+{
+	m_poseLog.WriteDevice( m_unDevices.fetch_add( 1 ), info.eClass );
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: The tag is taken as the pose arrives, which is where the runtime's
+//			view of its age starts
+//-----------------------------------------------------------------------------
+void CSimulatedServerDriverHost::TrackedDevicePoseUpdated( uint32_t unWhichDevice, const vr::DriverPose_t &newPose )
+{
+	const uint64_t ulTicks = Trace_GetTimestamp();
+	const uint32_t unPoseId = m_pTracer->PoseUpdated( unWhichDevice, ulTicks );
+	m_poseLog.WritePose( unWhichDevice, (double)ulTicks / Trace_GetTimestampFrequency(), newPose );
+	if ( unWhichDevice != vr::k_unTrackedDeviceIndex_Hmd || !newPose.poseIsValid )
+		return;
+
+	std::lock_guard< std::mutex > lock( m_mutex );
+	m_latestPose.unPoseId = unPoseId;
+	for ( uint32_t i = 0; i < 3; i++ )
+		m_latestPose.rflPosition[i] = newPose.vecPosition[i];
+	m_latestPose.rflRotation[0] = newPose.qRotation.w;
+	m_latestPose.rflRotation[1] = newPose.qRotation.x;
+	m_latestPose.rflRotation[2] = newPose.qRotation.y;
+	m_latestPose.rflRotation[3] = newPose.qRotation.z;
+	m_bHasPose = true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool CSimulatedServerDriverHost::GetLatestPose( SimulatedPose_t *pPose )
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	*pPose = m_latestPose;
+	return m_bHasPose;
+}
+
+
+static CSimulatedServerDriverHost *s_pHost = NULL;
+static std::thread s_driverThread;
+static std::atomic< bool > s_bDriverRunning( false );
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Where a simulated device is flSeconds in, with the derivatives a
+//			driver reports alongside
+//-----------------------------------------------------------------------------
+static void GetSimulatedPose( const SimulatedMotion_t &motion, double flSeconds, vr::DriverPose_t &pose )
+{
+	const double flYawPhase = motion.flYawRate * flSeconds;
+	const double flYaw = motion.flYawRadians * sin( flYawPhase );
+	pose.qRotation.w = cos( flYaw * 0.5 );
+	pose.qRotation.x = 0.0;
+	pose.qRotation.y = sin( flYaw * 0.5 );
+	pose.qRotation.z = 0.0;
+	pose.vecAngularVelocity[1] = motion.flYawRadians * motion.flYawRate * cos( flYawPhase );
+	pose.vecAngularAcceleration[1] = -motion.flYawRadians * motion.flYawRate * motion.flYawRate * sin( flYawPhase );
+
+	// sideways at the sway rate, up and down a little faster and half as far
+	const double rflRate[ 2 ] = { motion.flSwayRate, motion.flSwayRate * 1.3 };
+	const double rflAmplitude[ 2 ] = { motion.flSwayMeters, motion.flSwayMeters * 0.5 };
+	for ( uint32_t i = 0; i < 2; i++ )
+	{
+		const double flPhase = rflRate[i] * flSeconds;
+		pose.vecPosition[i] = motion.rflOrigin[i] + rflAmplitude[i] * sin( flPhase );
+		pose.vecVelocity[i] = rflAmplitude[i] * rflRate[i] * cos( flPhase );
+		pose.vecAcceleration[i] = -rflAmplitude[i] * rflRate[i] * rflRate[i] * sin( flPhase );
+	}
+	pose.vecPosition[2] = motion.rflOrigin[2];
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Reports every device's pose at a fixed rate, as a tracked device
+//			driver's IMU thread would
+//-----------------------------------------------------------------------------
+static void DriverThread( double flPoseRateHz )
+{
+	const uint64_t ulFrequency = Trace_GetTimestampFrequency();
+	const uint64_t ulIntervalTicks = std::max< uint64_t >( 1, (uint64_t)( ulFrequency / flPoseRateHz ) );
+	const uint64_t ulStartTicks = Trace_GetTimestamp();
+
+	vr::DriverPose_t pose;
+	memset( &pose, 0, sizeof( pose ) );
+	pose.qWorldFromDriverRotation.w = 1.0;
+	pose.qDriverFromHeadRotation.w = 1.0;
+	pose.result = vr::TrackingResult_Running_OK;
+	pose.poseIsValid = true;
+
+	for ( uint64_t ulSample = 0; s_bDriverRunning.load( std::memory_order_relaxed ); ulSample++ )
+	{
+		const uint64_t ulSampleTicks = ulStartTicks + ulSample * ulIntervalTicks;
+		Sim_SleepUntil( ulSampleTicks );
+
+		const double flSeconds = (double)( ulSampleTicks - ulStartTicks ) / ulFrequency;
+		for ( uint32_t unDevice = 0; unDevice < k_unSimulatedDevices; unDevice++ )
+		{
+			GetSimulatedPose( k_rSimulatedDevices[ unDevice ], flSeconds, pose );
+
+			// a late wakeup reports an older sample, and says so
+			pose.poseTimeOffset = -(double)( Trace_GetTimestamp() - ulSampleTicks ) / ulFrequency;
+			s_pHost->TrackedDevicePoseUpdated( unDevice, pose );
+		}
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void SimDriver_Start( CLatencyTracer *pTracer, double flPoseRateHz, const char *pchPoseLog )
+{
+	if ( s_pHost )
+		return;
+
+	s_pHost = new CSimulatedServerDriverHost( pTracer, pchPoseLog );
+	for ( uint32_t unDevice = 0; unDevice < k_unSimulatedDevices; unDevice++ )
+	{
+		vr::TrackedDeviceDriverInfo_t info;
+		memset( &info, 0, sizeof( info ) );
+		info.eClass = k_rSimulatedDevices[ unDevice ].eClass;
+		info.bDeviceIsConnected = true;
+		s_pHost->TrackedDeviceAdded( info );
+	}
+	s_bDriverRunning.store( true );
+	s_driverThread = std::thread( DriverThread, flPoseRateHz );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void SimDriver_Stop()
+{
+	if ( !s_pHost )
+		return;
+
+	s_bDriverRunning.store( false );
+	s_driverThread.join();
+	delete s_pHost;
+	s_pHost = NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool SimDriver_GetLatestPose( SimulatedPose_t *pPose )
+{
+	return s_pHost && s_pHost->GetLatestPose( pPose );
+}
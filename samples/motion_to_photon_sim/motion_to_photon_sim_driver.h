@@ -0,0 +1,28 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <cstdint>
+
+#include "shared/latencytracer.h"
+
+// openvr.h and openvr_driver.h can't share a translation unit, so nothing here uses either
+
+/** The newest pose the simulated driver reported, and the id the tracer tagged it with */
+struct SimulatedPose_t
+{
+	uint32_t unPoseId;
+	double rflPosition[ 3 ];
+	double rflRotation[ 4 ];	// w, x, y, z
+};
+
+/** Sleeps, then spins for the last stretch, until Trace_GetTimestamp() reaches ulTicks */
+void Sim_SleepUntil( uint64_t ulTicks );
+
+/** Starts a thread that plays the driver of an HMD and two controllers, reporting their poses
+* flPoseRateHz times a second through a simulated IServerDriverHost that tags each sample with
+* pTracer and, unless pchPoseLog is NULL, logs it there */
+void SimDriver_Start( CLatencyTracer *pTracer, double flPoseRateHz, const char *pchPoseLog );
+void SimDriver_Stop();
+
+/** False until the first pose has been reported */
+bool SimDriver_GetLatestPose( SimulatedPose_t *pPose );
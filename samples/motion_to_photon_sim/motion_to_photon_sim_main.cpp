@@ -0,0 +1,171 @@
+//========= Copyright Valve Corporation ============//
+//
+// Runs a simulated driver, compositor and application without a headset or GPU and
+// traces every frame's pose from IServerDriverHost::TrackedDevicePoseUpdated through
+// WaitGetPoses and Submit to its present, as reported by Compositor_FrameTiming.
+// The application side is written against the same calls a real one makes, so the
+// CLatencyTracer calls here are the ones to put into an application.
+//
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "motion_to_photon_sim_compositor.h"
+#include "motion_to_photon_sim_driver.h"
+#include "shared/latencytracer.h"
+#include "shared/tracebuffer.h"
+
+// presented frames are read back from this many frames ago, when they are surely done
+static const uint32_t k_unPresentedFramesAgo = 3;
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static void PrintUsage()
+{
+	fprintf( stderr, "Usage: motion_to_photon_sim [options]\n" );
+	fprintf( stderr, "  -seconds <n>        how long to run (5)\n" );
+	fprintf( stderr, "  -refresh <hz>       display refresh rate (90)\n" );
+	fprintf( stderr, "  -poserate <hz>      driver pose updates per second (1000)\n" );
+	fprintf( stderr, "  -runningstart <ms>  how long before vsync WaitGetPoses returns (3)\n" );
+	fprintf( stderr, "  -render <ms>        application time from WaitGetPoses to Submit (5)\n" );
+	fprintf( stderr, "  -renderjitter <ms>  random extra application time, up to (1)\n" );
+	fprintf( stderr, "  -compositor <ms>    compositor time before vsync (1.5)\n" );
+	fprintf( stderr, "  -frames             list every frame, not just the summary\n" );
+	fprintf( stderr, "  -report <file>      write the report there instead of stdout\n" );
+	fprintf( stderr, "  -recordposes <file> log every driver pose, for pose_prediction_benchmark\n" );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+int main( int argc, char *argv[] )
+{
+	double flSeconds = 5.0;
+	double flPoseRateHz = 1000.0;
+	double flRenderMs = 5.0;
+	double flRenderJitterMs = 1.0;
+	bool bPerFrame = false;
+	const char *pchReport = NULL;
+	const char *pchPoseLog = NULL;
+
+	SimulatedCompositorSettings_t settings;
+	settings.flRefreshHz = 90.0;
+	settings.flRunningStartMs = 3.0;
+	settings.flCompositorMs = 1.5;
+
+	for ( int i = 1; i < argc; i++ )
+	{
+		const bool bHasValue = i + 1 < argc;
+		if ( !strcmp( argv[i], "-seconds" ) && bHasValue )
+			flSeconds = atof( argv[ ++i ] );
+		else if ( !strcmp( argv[i], "-refresh" ) && bHasValue )
+			settings.flRefreshHz = atof( argv[ ++i ] );
+		else if ( !strcmp( argv[i], "-poserate" ) && bHasValue )
+			flPoseRateHz = atof( argv[ ++i ] );
+		else if ( !strcmp( argv[i], "-runningstart" ) && bHasValue )
+			settings.flRunningStartMs = atof( argv[ ++i ] );
+		else if ( !strcmp( argv[i], "-render" ) && bHasValue )
+			flRenderMs = atof( argv[ ++i ] );
+		else if ( !strcmp( argv[i], "-renderjitter" ) && bHasValue )
+			flRenderJitterMs = atof( argv[ ++i ] );
+		else if ( !strcmp( argv[i], "-compositor" ) && bHasValue )
+			settings.flCompositorMs = atof( argv[ ++i ] );
+		else if ( !strcmp( argv[i], "-frames" ) )
+			bPerFrame = true;
+		else if ( !strcmp( argv[i], "-report" ) && bHasValue )
+			pchReport = argv[ ++i ];
+		else if ( !strcmp( argv[i], "-recordposes" ) && bHasValue )
+			pchPoseLog = argv[ ++i ];
+		else
+		{
+			PrintUsage();
+			return 2;
+		}
+	}
+	if ( flSeconds <= 0.0 || settings.flRefreshHz <= 0.0 || flPoseRateHz <= 0.0 )
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	const uint64_t ulFrequency = Trace_GetTimestampFrequency();
+	const uint32_t unFrames = (uint32_t)( flSeconds * settings.flRefreshHz );
+	CLatencyTracer tracer( unFrames + 16 );
+
+	SimDriver_Start( &tracer, flPoseRateHz, pchPoseLog );
+	CSimulatedCompositor compositor( settings );
+	compositor.Start();
+
+	std::mt19937 random( 1 );
+	std::uniform_real_distribution< double > jitter( 0.0, flRenderJitterMs );
+
+	const uint64_t ulEndTicks = Trace_GetTimestamp() + (uint64_t)( flSeconds * ulFrequency );
+	while ( Trace_GetTimestamp() < ulEndTicks )
+	{
+		vr::TrackedDevicePose_t hmdPose;
+		uint32_t unPoseId;
+		compositor.WaitGetPoses( &hmdPose, &unPoseId );
+
+		vr::Compositor_FrameTiming timing;
+		timing.size = sizeof( timing );
+		if ( !compositor.GetFrameTiming( &timing, 0 ) )
+			continue;
+		const uint32_t unFrameIndex = timing.frameIndex;
+		tracer.PosesReturned( unFrameIndex, unPoseId, Trace_GetTimestamp() );
+
+		// the application's frame
+		const double flWorkMs = flRenderMs + ( flRenderJitterMs > 0.0 ? jitter( random ) : 0.0 );
+		Sim_SleepUntil( Trace_GetTimestamp() + (uint64_t)( flWorkMs * ulFrequency / 1000.0 ) );
+
+		compositor.Submit();
+		tracer.Submitted( unFrameIndex, Trace_GetTimestamp() );
+
+		// photons leave at the vsync the frame was first presented at
+		if ( compositor.GetFrameTiming( &timing, k_unPresentedFramesAgo ) && timing.m_nPresents > 0 )
+			tracer.Presented( timing.frameIndex, (uint64_t)( ( timing.frameStart + timing.frameVSync ) * ulFrequency ) );
+	}
+
+	// let the last frames be presented, then collect them
+	std::this_thread::sleep_for( std::chrono::milliseconds( (int)( 1000.0 * ( k_unPresentedFramesAgo + 1 ) / settings.flRefreshHz ) + 1 ) );
+	for ( uint32_t unFramesAgo = 0; unFramesAgo <= k_unPresentedFramesAgo; unFramesAgo++ )
+	{
+		vr::Compositor_FrameTiming timing;
+		timing.size = sizeof( timing );
+		if ( compositor.GetFrameTiming( &timing, unFramesAgo ) && timing.m_nPresents > 0 )
+			tracer.Presented( timing.frameIndex, (uint64_t)( ( timing.frameStart + timing.frameVSync ) * ulFrequency ) );
+	}
+
+	compositor.Stop();
+	SimDriver_Stop();
+
+	FILE *f = stdout;
+	if ( pchReport )
+	{
+#if defined( _WIN32 )
+		if ( fopen_s( &f, pchReport, "w" ) != 0 )
+			f = NULL;
+#else
+		f = fopen( pchReport, "w" );
+#endif
+		if ( f == NULL )
+		{
+			fprintf( stderr, "Unable to write %s\n", pchReport );
+			return 1;
+		}
+	}
+
+	fprintf( f, "Simulated %.1f s at %.0f Hz: poses at %.0f Hz, running start %.1f ms, application %.1f-%.1f ms, compositor %.1f ms\n\n",
+		flSeconds, settings.flRefreshHz, flPoseRateHz, settings.flRunningStartMs, flRenderMs, flRenderMs + flRenderJitterMs, settings.flCompositorMs );
+	tracer.WriteReport( f, bPerFrame );
+
+	if ( f != stdout )
+		fclose( f );
+	return 0;
+}
@@ -0,0 +1,471 @@
+#!/usr/bin/env python
+#========= Copyright Valve Corporation ============#
+#
+# Generates, from headers/openvr_api.json:
+#
+#   openvr_api_profiler_wrappers.cpp  one class per interface that times each method,
+#                                     optionally captures it, and forwards it to the real
+#                                     interface
+#   ../openvr_api_replay/openvr_api_replay_calls.cpp
+#                                     re-issues each captured call against a runtime
+#
+# Rerun it whenever openvr_api.json changes:
+#
+#   python generate_wrappers.py [path/to/openvr_api.json]
+#
+# A call's capture payload is its arguments in order, then its return value and then,
+# in order, everything it wrote through pointers. Pointers to data are written as
+# arrays: one element, or the element count the JSON names with array_count or
+# out_array_count. Pointers the call only writes through are recorded as present or
+# NULL on the way in and their contents only after the call returns. Methods that take something a log can't carry, like a texture
+# or a void * buffer, are recorded with an empty payload and aren't replayed.
+#
+import json
+import os
+import sys
+
+HERE = os.path.dirname( os.path.abspath( __file__ ) )
+DEFAULT_JSON = os.path.join( HERE, '..', '..', 'headers', 'openvr_api.json' )
+WRAPPERS_OUTPUT = os.path.join( HERE, 'openvr_api_profiler_wrappers.cpp' )
+REPLAY_OUTPUT = os.path.join( HERE, '..', 'openvr_api_replay', 'openvr_api_replay_calls.cpp' )
+
+# values the runtime hands out, which differ between a capture and its replay
+HANDLE_TYPES = set( [ 'vr::VROverlayHandle_t', 'vr::VRNotificationId' ] )
+
+# arrays openvr.h doesn't annotate: ( interface, method, parameter ) -> count parameter
+EXTRA_ARRAY_COUNTS = {
+	( 'vr::IVRChaperone', 'GetBoundsColor', 'pOutputColorArray' ): 'nNumOutputColors',
+}
+
+
+def strip_type( paramtype ):
+	""" 'const struct vr::HmdMatrix34_t *' -> 'vr::HmdMatrix34_t' """
+	base = paramtype.replace( '*', '' ).strip()
+	for prefix in ( 'const ', 'struct ', 'union ' ):
+		if base.startswith( prefix ):
+			base = base[ len( prefix ): ]
+	return base.strip()
+
+
+class Api:
+	def __init__( self, api ):
+		self.typedefs = dict( ( t[ 'typedef' ], t[ 'type' ] ) for t in api[ 'typedefs' ] )
+		self.struct_fields = dict( ( s[ 'struct' ], s[ 'fields' ] ) for s in api[ 'structs' ] )
+		self.pointer_structs = {}
+
+	def resolve( self, typename ):
+		""" Follows typedefs; returns the underlying type string """
+		seen = set()
+		while typename in self.typedefs and typename not in seen:
+			seen.add( typename )
+			underlying = self.typedefs[ typename ]
+			if '*' in underlying:
+				return underlying
+			typename = strip_type( underlying )
+			if not typename.startswith( 'vr::' ) and ( 'vr::' + typename ) in self.struct_fields:
+				typename = 'vr::' + typename
+		return typename
+
+	def holds_pointer( self, typename ):
+		""" True for pointers, and structs that contain one anywhere """
+		resolved = self.resolve( typename )
+		if '*' in resolved or resolved == 'void':
+			return True
+		if resolved not in self.struct_fields:
+			return False
+		if resolved not in self.pointer_structs:
+			self.pointer_structs[ resolved ] = False
+			for field in self.struct_fields[ resolved ]:
+				fieldtype = field[ 'fieldtype' ]
+				if '*' in fieldtype or self.holds_pointer( strip_type( fieldtype.split( '[' )[ 0 ] ) ):
+					self.pointer_structs[ resolved ] = True
+					break
+		return self.pointer_structs[ resolved ]
+
+
+class Param:
+	""" How one parameter is captured and replayed """
+	def __init__( self, api, method, index ):
+		params = method.get( 'params', [] )
+		param = params[ index ]
+		self.name = param[ 'paramname' ]
+		self.type = param[ 'paramtype' ]
+		self.base = strip_type( self.type )
+		self.is_handle = self.base in HANDLE_TYPES
+		self.count = param.get( 'array_count' ) or EXTRA_ARRAY_COUNTS.get( ( method[ 'classname' ], method[ 'methodname' ], self.name ) )
+		self.count_pointer = param.get( 'out_array_count' )
+		self.size = None
+
+		pointers = self.type.count( '*' )
+		is_const = self.type.startswith( 'const ' )
+		if pointers == 0:
+			self.kind = 'opaque' if api.holds_pointer( self.base ) else 'value'
+		elif self.type == 'const char *':
+			self.kind = 'instring'
+		elif self.type == 'char *':
+			# the buffer's size is the integer that follows it
+			if index + 1 < len( params ) and params[ index + 1 ][ 'paramtype' ] in ( 'uint32_t', 'int32_t', 'int' ):
+				self.kind = 'outstring'
+				self.size = params[ index + 1 ][ 'paramname' ]
+			else:
+				self.kind = 'opaque'
+		elif pointers > 1 or api.holds_pointer( self.base ):
+			self.kind = 'opaque'
+		elif is_const or ( self.count and method[ 'methodname' ].startswith( 'Set' ) ):
+			self.kind = 'in'
+		elif self.count:
+			self.kind = 'outarray'
+		elif self.count_pointer:
+			self.kind = 'outcountarray'
+		elif any( p.get( 'out_array_count' ) == self.name for p in params ):
+			# a buffer's capacity on the way in, the count the call filled on the way out
+			self.kind = 'inout'
+		else:
+			self.kind = 'out'
+
+	def element_type( self ):
+		return self.type.replace( 'const ', '' ).rstrip( ' *' ).strip()
+
+	def storage_type( self ):
+		# std::vector< bool > has no data()
+		return 'uint8_t' if self.element_type() == 'bool' else self.element_type()
+
+	def argument( self ):
+		data = '%s_data.data()' % self.name
+		if self.storage_type() != self.element_type():
+			data = 'reinterpret_cast< %s * >( %s )' % ( self.element_type(), data )
+		return '%s_present ? %s : NULL' % ( self.name, data )
+
+	def capacity_name( self ):
+		return 'un%sCapacity' % ( self.name[ 1: ] if self.name.startswith( 'p' ) else self.name )
+
+
+class Method:
+	def __init__( self, api, method, index, interface_index ):
+		self.index = index
+		self.interface_index = interface_index
+		self.classname = method[ 'classname' ]
+		self.shortname = self.classname.split( '::' )[ -1 ]
+		self.name = method[ 'methodname' ]
+		self.returntype = method[ 'returntype' ]
+		self.params = [ Param( api, method, i ) for i in range( len( method.get( 'params', [] ) ) ) ]
+		self.replayable = all( p.kind != 'opaque' for p in self.params )
+
+		if self.returntype == 'void':
+			self.return_kind = 'void'
+		elif self.returntype == 'const char *':
+			self.return_kind = 'string'
+		elif '*' in self.returntype or api.holds_pointer( strip_type( self.returntype ) ):
+			self.return_kind = 'opaque'
+		else:
+			self.return_kind = 'value'
+		self.return_is_handle = strip_type( self.returntype ) in HANDLE_TYPES
+
+	def count_expression( self, param ):
+		return '(uint32_t)%s' % param.count if param.count else '1'
+
+
+def load_methods( api_json ):
+	api = Api( api_json )
+	interfaces = []
+	methods = []
+	for method in api_json[ 'methods' ]:
+		# keep the order the interfaces and methods first appear in, which is openvr.h order
+		if method[ 'classname' ] not in interfaces:
+			interfaces.append( method[ 'classname' ] )
+		methods.append( Method( api, method, len( methods ), interfaces.index( method[ 'classname' ] ) ) )
+	return interfaces, methods
+
+
+def header( out, generated_for ):
+	out.append( '//========= Copyright Valve Corporation ============//' )
+	out.append( '// Generated by openvr_api_profiler/generate_wrappers.py from openvr_api.json%s. Do not edit by hand.' % generated_for )
+
+
+def purpose( out ):
+	out.append( '' )
+	out.append( '' )
+	out.append( '//-----------------------------------------------------------------------------' )
+	out.append( '// Purpose:' )
+	out.append( '//-----------------------------------------------------------------------------' )
+
+
+def emit_capture_block( out, lines ):
+	if lines:
+		out.append( '\t\tif ( CApiCaptureBuffer *pCapture = call.GetCapture() )' )
+		out.append( '\t\t{' )
+		out.extend( '\t\t\t' + line for line in lines )
+		out.append( '\t\t}' )
+
+
+def emit_capture_inputs( out, method ):
+	lines = []
+	for param in method.params:
+		if param.kind == 'value':
+			lines.append( 'pCapture->WriteValue( %s );' % param.name )
+		elif param.kind == 'instring':
+			lines.append( 'pCapture->WriteString( %s );' % param.name )
+		elif param.kind in ( 'in', 'inout' ):
+			lines.append( 'pCapture->WriteArray( %s, %s );' % ( param.name, method.count_expression( param ) ) )
+		elif param.kind in ( 'out', 'outarray', 'outcountarray', 'outstring' ):
+			lines.append( 'pCapture->WriteVarint( %s ? 1 : 0 );' % param.name )
+	emit_capture_block( out, lines )
+
+
+def emit_capture_outputs( out, method ):
+	lines = []
+	if method.return_kind == 'value':
+		lines.append( 'pCapture->WriteValue( result );' )
+	elif method.return_kind == 'string':
+		lines.append( 'pCapture->WriteString( result );' )
+	for param in method.params:
+		if param.kind in ( 'inout', 'out' ):
+			lines.append( 'pCapture->WriteArray( %s, 1 );' % param.name )
+		elif param.kind == 'outarray':
+			lines.append( 'pCapture->WriteArray( %s, %s );' % ( param.name, method.count_expression( param ) ) )
+		elif param.kind == 'outcountarray':
+			lines.append( 'pCapture->WriteArray( %s, %s ? std::min( *%s, %s ) : 0 );' % ( param.name, param.count_pointer, param.count_pointer, param.capacity_name() ) )
+		elif param.kind == 'outstring':
+			lines.append( 'pCapture->WriteString( %s, %s );' % ( param.name, param.size ) )
+	emit_capture_block( out, lines )
+
+
+def declare( param ):
+	# every type in openvr_api.json ends in a type name or a '*', so the name can just follow it
+	if param.type.endswith( '*' ):
+		return '%s%s' % ( param.type, param.name )
+	return '%s %s' % ( param.type, param.name )
+
+
+def generate_wrappers( interfaces, methods ):
+	out = []
+	header( out, '' )
+	out.append( '#include "openvr_api_profiler.h"' )
+	out.append( '' )
+	out.append( '#include <algorithm>' )
+	out.append( '#include <string.h>' )
+	out.append( '' )
+	out.append( '#include <openvr.h>' )
+	out.append( '' )
+
+	out.append( 'ProfiledMethod_t g_rProfiledMethods[] =' )
+	out.append( '{' )
+	for method in methods:
+		out.append( '\t{ "%s::%s", %s_Version },' % ( method.shortname, method.name, method.classname ) )
+	out.append( '};' )
+	out.append( '' )
+	out.append( 'const uint32_t g_unProfiledMethodCount = sizeof( g_rProfiledMethods ) / sizeof( g_rProfiledMethods[0] );' )
+	out.append( 'const uint32_t g_unProfiledInterfaceCount = %d;' % len( interfaces ) )
+	out.append( '' )
+
+	for interface in interfaces:
+		shortname = interface.split( '::' )[ -1 ]
+		out.append( '' )
+		out.append( '//-----------------------------------------------------------------------------' )
+		out.append( '// Purpose: Profiles every call to %s' % interface )
+		out.append( '//-----------------------------------------------------------------------------' )
+		out.append( 'class CProfiled%s final : public %s' % ( shortname, interface ) )
+		out.append( '{' )
+		out.append( 'public:' )
+		out.append( '\texplicit CProfiled%s( %s *pReal ) : m_pReal( pReal ) {}' % ( shortname, interface ) )
+		for method in methods:
+			if method.classname != interface:
+				continue
+			decl = ', '.join( declare( p ) for p in method.params )
+			args = ', '.join( p.name for p in method.params )
+			out.append( '' )
+			out.append( '\tvirtual %s %s(%s) override' % ( method.returntype, method.name, ' %s ' % decl if decl else '' ) )
+			out.append( '\t{' )
+			out.append( '\t\tCProfiledCall call( %d );' % method.index )
+			if method.replayable:
+				emit_capture_inputs( out, method )
+				for param in method.params:
+					if param.kind == 'outcountarray':
+						out.append( '\t\tconst uint32_t %s = %s ? *%s : 0;' % ( param.capacity_name(), param.count_pointer, param.count_pointer ) )
+			out.append( '\t\tcall.Begin();' )
+			invoke = 'm_pReal->%s(%s);' % ( method.name, ' %s ' % args if args else '' )
+			if method.return_kind == 'void':
+				out.append( '\t\t' + invoke )
+			else:
+				out.append( '\t\t%s result = %s' % ( method.returntype, invoke ) )
+			out.append( '\t\tcall.End();' )
+			if method.replayable:
+				emit_capture_outputs( out, method )
+			if method.return_kind != 'void':
+				out.append( '\t\treturn result;' )
+			out.append( '\t}' )
+		out.append( '' )
+		out.append( 'private:' )
+		out.append( '\t%s *m_pReal;' % interface )
+		out.append( '};' )
+		out.append( '' )
+
+	purpose( out )
+	out.append( 'int Profiler_FindInterface( const char *pchInterfaceVersion )' )
+	out.append( '{' )
+	for i, interface in enumerate( interfaces ):
+		out.append( '\tif ( !strcmp( pchInterfaceVersion, %s_Version ) )' % interface )
+		out.append( '\t\treturn %d;' % i )
+	out.append( '\treturn -1;' )
+	out.append( '}' )
+
+	purpose( out )
+	out.append( 'void *Profiler_CreateWrapper( int nInterface, void *pRealInterface )' )
+	out.append( '{' )
+	out.append( '\tswitch ( nInterface )' )
+	out.append( '\t{' )
+	for i, interface in enumerate( interfaces ):
+		shortname = interface.split( '::' )[ -1 ]
+		out.append( '\tcase %d: return static_cast< %s * >( new CProfiled%s( static_cast< %s * >( pRealInterface ) ) );' % ( i, interface, shortname, interface ) )
+	out.append( '\tdefault: return NULL;' )
+	out.append( '\t}' )
+	out.append( '}' )
+
+	purpose( out )
+	out.append( 'void Profiler_DestroyWrapper( int nInterface, void *pWrapper )' )
+	out.append( '{' )
+	out.append( '\tswitch ( nInterface )' )
+	out.append( '\t{' )
+	for i, interface in enumerate( interfaces ):
+		shortname = interface.split( '::' )[ -1 ]
+		out.append( '\tcase %d: delete static_cast< CProfiled%s * >( static_cast< %s * >( pWrapper ) ); break;' % ( i, shortname, interface ) )
+	out.append( '\t}' )
+	out.append( '}' )
+	return '\n'.join( out ) + '\n'
+
+
+def emit_replay_call( out, method ):
+	out.append( '\tcase %d: // %s::%s' % ( method.index, method.shortname, method.name ) )
+	out.append( '\t{' )
+
+	# the arguments, in capture order
+	for param in method.params:
+		if param.kind == 'value':
+			read = 'reader.ReadValue< %s >()' % param.type
+			if param.is_handle:
+				read = '(%s)Replay_MapHandle( %s )' % ( param.type, read )
+			out.append( '\t\t%s %s = %s;' % ( param.type, param.name, read ) )
+		elif param.kind == 'instring':
+			out.append( '\t\tconst char *%s = reader.ReadString();' % param.name )
+		elif param.kind in ( 'in', 'inout' ):
+			out.append( '\t\tstd::vector< %s > %s_data;' % ( param.storage_type(), param.name ) )
+			out.append( '\t\tconst bool %s_present = reader.ReadArray( %s_data );' % ( param.name, param.name ) )
+		else:
+			out.append( '\t\tconst bool %s_present = reader.ReadVarint() != 0;' % param.name )
+
+	# buffers for what the call only writes, sized the way the application sized them
+	for param in method.params:
+		if param.kind in ( 'out', 'outarray' ):
+			out.append( '\t\tstd::vector< %s > %s_data( %s_present ? %s : 0 );' % ( param.storage_type(), param.name, param.name, method.count_expression( param ) ) )
+		elif param.kind == 'outcountarray':
+			out.append( '\t\tstd::vector< %s > %s_data( %s_present && %s_data.size() == 1 ? %s_data[0] : 0 );' % (
+				param.storage_type(), param.name, param.name, param.count_pointer, param.count_pointer ) )
+		elif param.kind == 'outstring':
+			out.append( '\t\tstd::vector< char > %s_data( %s_present ? %s : 0 );' % ( param.name, param.name, param.size ) )
+	out.append( '\t\tif ( !reader.IsValid() )' )
+	out.append( '\t\t\treturn false;' )
+	out.append( '' )
+
+	args = []
+	for param in method.params:
+		if param.kind in ( 'value', 'instring' ):
+			args.append( param.name )
+		else:
+			args.append( param.argument() )
+	invoke = 'static_cast< %s * >( pInterface )->%s(%s);' % ( method.classname, method.name, ' %s ' % ', '.join( args ) if args else '' )
+	out.append( '\t\tconst uint64_t ulStartTicks = Trace_GetTimestamp();' )
+	if method.return_kind not in ( 'value', 'string' ):
+		out.append( '\t\t' + invoke )
+	else:
+		out.append( '\t\t%s result = %s' % ( method.returntype, invoke ) )
+	out.append( '\t\t*pulTicks = Trace_GetTimestamp() - ulStartTicks;' )
+
+	# the captured results, as far as they're needed to compare the return value and map handles
+	if method.return_kind == 'value':
+		out.append( '\t\tconst %s recorded = reader.ReadValue< %s >();' % ( method.returntype, method.returntype ) )
+		if method.return_is_handle:
+			out.append( '\t\tReplay_AddHandle( recorded, result );' )
+		else:
+			out.append( '\t\t*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;' )
+	elif method.return_kind == 'string':
+		out.append( '\t\tconst char *recorded = reader.ReadString();' )
+		out.append( '\t\t*pbReturnDiffered = recorded && result ? strcmp( recorded, result ) != 0 : recorded != result;' )
+
+	written = [ p for p in method.params if p.kind in ( 'inout', 'out', 'outarray', 'outcountarray', 'outstring' ) ]
+	last_handle = max( [ i for i, p in enumerate( written ) if p.is_handle ] or [ -1 ] )
+	for param in written[ : last_handle + 1 ]:
+		if param.kind == 'outstring':
+			out.append( '\t\treader.ReadString();' )
+			continue
+		out.append( '\t\tstd::vector< %s > %s_recorded;' % ( param.storage_type(), param.name ) )
+		out.append( '\t\treader.ReadArray( %s_recorded );' % param.name )
+		if param.is_handle:
+			out.append( '\t\tif ( %s_recorded.size() == 1 && %s_data.size() == 1 )' % ( param.name, param.name ) )
+			out.append( '\t\t\tReplay_AddHandle( %s_recorded[0], %s_data[0] );' % ( param.name, param.name ) )
+	out.append( '\t\treturn reader.IsValid();' )
+	out.append( '\t}' )
+
+
+def generate_replay( interfaces, methods ):
+	out = []
+	header( out, ' for openvr_api_replay' )
+	out.append( '#include "openvr_api_replay.h"' )
+	out.append( '' )
+	out.append( '#include <string.h>' )
+	out.append( '#include <vector>' )
+	out.append( '' )
+	out.append( '#include <openvr.h>' )
+	out.append( '' )
+	out.append( '#include "shared/tracebuffer.h"' )
+	out.append( '' )
+
+	out.append( 'const char *const g_rpchReplayInterfaceVersions[] =' )
+	out.append( '{' )
+	for interface in interfaces:
+		out.append( '\t%s_Version,' % interface )
+	out.append( '};' )
+	out.append( '' )
+	out.append( 'const ReplayMethod_t g_rReplayMethods[] =' )
+	out.append( '{' )
+	for method in methods:
+		out.append( '\t{ "%s::%s", %d, %s },' % ( method.shortname, method.name, method.interface_index, 'true' if method.replayable else 'false' ) )
+	out.append( '};' )
+	out.append( '' )
+	out.append( 'const uint32_t g_unReplayMethodCount = sizeof( g_rReplayMethods ) / sizeof( g_rReplayMethods[0] );' )
+	out.append( 'const uint32_t g_unReplayInterfaceCount = sizeof( g_rpchReplayInterfaceVersions ) / sizeof( g_rpchReplayInterfaceVersions[0] );' )
+
+	purpose( out )
+	out.append( 'bool Replay_Call( uint32_t unMethod, void *pInterface, CApiCaptureReader &reader, uint64_t *pulTicks, bool *pbReturnDiffered )' )
+	out.append( '{' )
+	out.append( '\t*pulTicks = 0;' )
+	out.append( '\t*pbReturnDiffered = false;' )
+	out.append( '' )
+	out.append( '\tswitch ( unMethod )' )
+	out.append( '\t{' )
+	for method in methods:
+		if method.replayable:
+			emit_replay_call( out, method )
+			out.append( '' )
+	out.append( '\tdefault:' )
+	out.append( '\t\treturn false;' )
+	out.append( '\t}' )
+	out.append( '}' )
+	return '\n'.join( out ) + '\n'
+
+
+def write( path, text ):
+	# binary, so the output has the same line endings on every platform
+	with open( path, 'wb' ) as f:
+		f.write( text.encode( 'utf-8' ) )
+
+
+def main():
+	json_path = sys.argv[ 1 ] if len( sys.argv ) > 1 else DEFAULT_JSON
+	with open( json_path ) as f:
+		interfaces, methods = load_methods( json.load( f ) )
+	write( WRAPPERS_OUTPUT, generate_wrappers( interfaces, methods ) )
+	write( REPLAY_OUTPUT, generate_replay( interfaces, methods ) )
+
+
+if __name__ == '__main__':
+	main()
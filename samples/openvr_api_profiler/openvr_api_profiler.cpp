@@ -0,0 +1,445 @@
+//========= Copyright Valve Corporation ============//
+//
+// A drop-in openvr_api library that times every interface call an application makes.
+// Rename the real library to openvr_api_real.dll (libopenvr_api_real.so, .dylib) or
+// point VR_PROFILER_REAL_LIBRARY at it, then put this build where the application
+// loads openvr_api from. A summary of call counts and latencies per method is written
+// to VR_PROFILER_OUTPUT (openvr_api_profile.txt by default) at VR_Shutdown, at exit,
+// and on the next interface call after SIGUSR1 (SIGBREAK on Windows).
+//
+// Setting VR_CAPTURE_FILE also writes every call from VR_Init on, with its arguments
+// and results, to that file for openvr_api_replay to re-issue.
+//
+#include "openvr_api_profiler.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined( _WIN32 )
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include <openvr.h>
+
+#if defined( _WIN32 )
+static const char *k_pchDefaultRealLibrary = "openvr_api_real.dll";
+static const int k_nDumpSignal = SIGBREAK;
+#elif defined( __APPLE__ )
+static const char *k_pchDefaultRealLibrary = "libopenvr_api_real.dylib";
+static const int k_nDumpSignal = SIGUSR1;
+#else
+static const char *k_pchDefaultRealLibrary = "libopenvr_api_real.so";
+static const int k_nDumpSignal = SIGUSR1;
+#endif
+
+// the call that marks a frame, for the calls per frame column
+static const char *k_pchFrameMethod = "IVRCompositor::WaitGetPoses";
+
+static const uint64_t s_ulLoadTicks = Trace_GetTimestamp();
+static const double s_flNsPerTick = 1000000000.0 / Trace_GetTimestampFrequency();
+static std::atomic< bool > s_bDumpRequested( false );
+
+struct WrappedInterface_t
+{
+	void *pReal;
+	void *pWrapper;
+};
+
+static std::mutex s_interfaceMutex;
+static std::vector< WrappedInterface_t > s_vecWrappedInterfaces;
+
+static std::mutex s_summaryMutex;
+
+static CApiCaptureWriter s_captureWriter;
+static std::atomic< bool > s_bCapturing( false );
+static uint64_t s_ulCaptureStartTicks = 0;
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static void *LoadRealLibrary()
+{
+	const char *pchPath = getenv( "VR_PROFILER_REAL_LIBRARY" );
+	if ( !pchPath || !*pchPath )
+		pchPath = k_pchDefaultRealLibrary;
+
+#if defined( _WIN32 )
+	void *pLibrary = (void *)LoadLibraryA( pchPath );
+#else
+	void *pLibrary = dlopen( pchPath, RTLD_NOW | RTLD_LOCAL );
+#endif
+	if ( !pLibrary )
+		fprintf( stderr, "openvr_api profiler: unable to load the real OpenVR library %s\n", pchPath );
+	return pLibrary;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Looks up an export of the real library, loading it on first use
+//-----------------------------------------------------------------------------
+template < typename FunctionType >
+static FunctionType GetRealFunction( const char *pchName )
+{
+	static void *s_pLibrary = LoadRealLibrary();
+	if ( !s_pLibrary )
+		return NULL;
+
+#if defined( _WIN32 )
+	return reinterpret_cast< FunctionType >( GetProcAddress( (HMODULE)s_pLibrary, pchName ) );
+#else
+	return reinterpret_cast< FunctionType >( dlsym( s_pLibrary, pchName ) );
+#endif
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Opens VR_CAPTURE_FILE, if it is set, the first time VR_Init is called
+//-----------------------------------------------------------------------------
+static void StartCapture( vr::EVRApplicationType eApplicationType )
+{
+	const char *pchPath = getenv( "VR_CAPTURE_FILE" );
+	if ( !pchPath || !*pchPath || s_captureWriter.IsOpen() )
+		return;
+
+	std::vector< ApiCaptureMethod_t > vecMethods( g_unProfiledMethodCount );
+	for ( uint32_t i = 0; i < g_unProfiledMethodCount; i++ )
+	{
+		vecMethods[i].sName = g_rProfiledMethods[i].pchName;
+		vecMethods[i].sInterfaceVersion = g_rProfiledMethods[i].pchInterfaceVersion;
+	}
+
+	if ( !s_captureWriter.Open( pchPath, (uint32_t)eApplicationType, vecMethods ) )
+	{
+		fprintf( stderr, "openvr_api profiler: unable to write the capture %s\n", pchPath );
+		return;
+	}
+	s_ulCaptureStartTicks = Trace_GetTimestamp();
+	s_bCapturing.store( true, std::memory_order_release );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Returns the profiling wrapper for pReal, creating it on first use.
+//			Interfaces the generated wrappers don't know are passed through.
+//-----------------------------------------------------------------------------
+static void *WrapInterface( const char *pchInterfaceVersion, void *pReal )
+{
+	if ( !pReal )
+		return NULL;
+
+	const int nInterface = Profiler_FindInterface( pchInterfaceVersion );
+	if ( nInterface < 0 )
+		return pReal;
+
+	std::lock_guard< std::mutex > lock( s_interfaceMutex );
+	if ( s_vecWrappedInterfaces.empty() )
+	{
+		WrappedInterface_t empty = { NULL, NULL };
+		s_vecWrappedInterfaces.resize( g_unProfiledInterfaceCount, empty );
+	}
+
+	// a replaced wrapper is leaked rather than freed, since the application may still hold it
+	WrappedInterface_t &wrapped = s_vecWrappedInterfaces[ nInterface ];
+	if ( wrapped.pReal != pReal )
+	{
+		wrapped.pReal = pReal;
+		wrapped.pWrapper = Profiler_CreateWrapper( nInterface, pReal );
+	}
+	return wrapped.pWrapper;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Interface pointers are invalid after VR_Shutdown, so the wrappers can go
+//-----------------------------------------------------------------------------
+static void DestroyWrappers()
+{
+	std::lock_guard< std::mutex > lock( s_interfaceMutex );
+	for ( size_t i = 0; i < s_vecWrappedInterfaces.size(); i++ )
+	{
+		if ( s_vecWrappedInterfaces[i].pWrapper )
+			Profiler_DestroyWrapper( (int)i, s_vecWrappedInterfaces[i].pWrapper );
+		s_vecWrappedInterfaces[i].pReal = NULL;
+		s_vecWrappedInterfaces[i].pWrapper = NULL;
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: The upper bound of the bucket that holds the given fraction of calls
+//-----------------------------------------------------------------------------
+static double GetPercentileUs( const uint64_t *pulBuckets, uint64_t ulCalls, double flFraction, uint64_t ulMaxNs )
+{
+	const uint64_t ulTarget = std::max< uint64_t >( 1, (uint64_t)( ulCalls * flFraction + 0.5 ) );
+	uint64_t ulSeen = 0;
+	for ( uint32_t i = 0; i < k_unLatencyBuckets; i++ )
+	{
+		ulSeen += pulBuckets[i];
+		if ( ulSeen >= ulTarget )
+			return std::min< uint64_t >( 2ull << i, ulMaxNs ) / 1000.0;
+	}
+	return ulMaxNs / 1000.0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Writes every called method, most total time first
+//-----------------------------------------------------------------------------
+static void WriteSummary()
+{
+	std::lock_guard< std::mutex > lock( s_summaryMutex );
+
+	const char *pchPath = getenv( "VR_PROFILER_OUTPUT" );
+	if ( !pchPath || !*pchPath )
+		pchPath = "openvr_api_profile.txt";
+
+	FILE *f;
+#if defined( _WIN32 )
+	if ( fopen_s( &f, pchPath, "w" ) != 0 )
+		f = NULL;
+#else
+	f = fopen( pchPath, "w" );
+#endif
+	if ( f == NULL )
+	{
+		fprintf( stderr, "openvr_api profiler: unable to write %s\n", pchPath );
+		return;
+	}
+
+	std::vector< uint32_t > vecCalled;
+	uint64_t ulFrames = 0;
+	for ( uint32_t i = 0; i < g_unProfiledMethodCount; i++ )
+	{
+		const uint64_t ulCalls = g_rProfiledMethods[i].ulCalls.load( std::memory_order_relaxed );
+		if ( ulCalls == 0 )
+			continue;
+		vecCalled.push_back( i );
+		if ( !strcmp( g_rProfiledMethods[i].pchName, k_pchFrameMethod ) )
+			ulFrames = ulCalls;
+	}
+	std::sort( vecCalled.begin(), vecCalled.end(), []( uint32_t a, uint32_t b )
+	{
+		return g_rProfiledMethods[a].ulTotalNs.load( std::memory_order_relaxed ) > g_rProfiledMethods[b].ulTotalNs.load( std::memory_order_relaxed );
+	} );
+
+	fprintf( f, "OpenVR API profile after %.1f s, %llu frames (%s calls)\n", ( Trace_GetTimestamp() - s_ulLoadTicks ) * s_flNsPerTick / 1000000000.0,
+		(unsigned long long)ulFrames, k_pchFrameMethod );
+	fprintf( f, "Percentiles are the upper bound of a power of two bucket.\n\n" );
+	fprintf( f, "%12s %10s %10s %10s %10s %10s %10s  %s\n", "calls", "per frame", "total ms", "mean us", "p50 us", "p99 us", "max us", "method" );
+
+	for ( uint32_t unMethod : vecCalled )
+	{
+		const ProfiledMethod_t &method = g_rProfiledMethods[ unMethod ];
+
+		// counters keep moving while this runs, so each line is only roughly consistent
+		uint64_t rulBuckets[ k_unLatencyBuckets ];
+		uint64_t ulBucketCalls = 0;
+		for ( uint32_t i = 0; i < k_unLatencyBuckets; i++ )
+		{
+			rulBuckets[i] = method.rulBuckets[i].load( std::memory_order_relaxed );
+			ulBucketCalls += rulBuckets[i];
+		}
+		const uint64_t ulCalls = method.ulCalls.load( std::memory_order_relaxed );
+		const uint64_t ulTotalNs = method.ulTotalNs.load( std::memory_order_relaxed );
+		const uint64_t ulMaxNs = method.ulMaxNs.load( std::memory_order_relaxed );
+
+		fprintf( f, "%12llu %10.1f %10.3f %10.2f %10.2f %10.2f %10.2f  %s\n",
+			(unsigned long long)ulCalls,
+			ulFrames ? (double)ulCalls / ulFrames : 0.0,
+			ulTotalNs / 1000000.0,
+			ulTotalNs / 1000.0 / ulCalls,
+			GetPercentileUs( rulBuckets, ulBucketCalls, 0.5, ulMaxNs ),
+			GetPercentileUs( rulBuckets, ulBucketCalls, 0.99, ulMaxNs ),
+			ulMaxNs / 1000.0,
+			method.pchName );
+	}
+
+	fclose( f );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Only sets a flag; the summary is written from the next profiled call
+//-----------------------------------------------------------------------------
+static void OnDumpSignal( int nSignal )
+{
+	s_bDumpRequested.store( true, std::memory_order_relaxed );
+	signal( nSignal, OnDumpSignal );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Installs the dump signal handler on load and writes the summary at exit
+//-----------------------------------------------------------------------------
+class CProfilerLifetime
+{
+public:
+	CProfilerLifetime() { signal( k_nDumpSignal, OnDumpSignal ); }
+	~CProfilerLifetime()
+	{
+		s_bCapturing.store( false );
+		s_captureWriter.Close();
+		WriteSummary();
+	}
+};
+
+static CProfilerLifetime s_profilerLifetime;
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CApiCaptureBuffer *Profiler_GetCaptureBuffer()
+{
+	// acquire, so the capture's start time is visible to this thread too
+	if ( !s_bCapturing.load( std::memory_order_acquire ) )
+		return NULL;
+
+	static thread_local CApiCaptureBuffer t_captureBuffer;
+	t_captureBuffer.Clear();
+	return &t_captureBuffer;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void Profiler_EndCall( uint32_t unMethod, uint64_t ulStartTicks, uint64_t ulEndTicks, const CApiCaptureBuffer *pCapture )
+{
+	ProfiledMethod_t &method = g_rProfiledMethods[ unMethod ];
+	const uint64_t ulNs = (uint64_t)( ( ulEndTicks - ulStartTicks ) * s_flNsPerTick );
+
+	uint32_t unBucket = 0;
+	while ( unBucket + 1 < k_unLatencyBuckets && ( ulNs >> ( unBucket + 1 ) ) != 0 )
+		unBucket++;
+
+	method.ulCalls.fetch_add( 1, std::memory_order_relaxed );
+	method.ulTotalNs.fetch_add( ulNs, std::memory_order_relaxed );
+	method.rulBuckets[ unBucket ].fetch_add( 1, std::memory_order_relaxed );
+
+	uint64_t ulMaxNs = method.ulMaxNs.load( std::memory_order_relaxed );
+	while ( ulNs > ulMaxNs && !method.ulMaxNs.compare_exchange_weak( ulMaxNs, ulNs, std::memory_order_relaxed ) )
+	{
+	}
+
+	if ( pCapture )
+		s_captureWriter.WriteRecord( unMethod, (uint64_t)( ( ulStartTicks - s_ulCaptureStartTicks ) * s_flNsPerTick ), ulNs, *pCapture );
+
+	if ( s_bDumpRequested.load( std::memory_order_relaxed ) && s_bDumpRequested.exchange( false ) )
+		WriteSummary();
+}
+
+
+namespace vr
+{
+
+//-----------------------------------------------------------------------------
+// Purpose: The exports openvr.h declares, forwarded to the real library
+//-----------------------------------------------------------------------------
+VR_INTERFACE IVRSystem *VR_CALLTYPE VR_Init( EVRInitError *peError, EVRApplicationType eApplicationType )
+{
+	typedef IVRSystem *( VR_CALLTYPE *VR_InitFn_t )( EVRInitError *, EVRApplicationType );
+	static VR_InitFn_t s_pReal = GetRealFunction< VR_InitFn_t >( "VR_Init" );
+	if ( !s_pReal )
+	{
+		if ( peError )
+			*peError = VRInitError_Init_VRClientDLLNotFound;
+		return NULL;
+	}
+
+	IVRSystem *pSystem = s_pReal( peError, eApplicationType );
+	if ( pSystem )
+		StartCapture( eApplicationType );
+	return static_cast< IVRSystem * >( WrapInterface( IVRSystem_Version, pSystem ) );
+}
+
+
+VR_INTERFACE void VR_CALLTYPE VR_Shutdown()
+{
+	typedef void ( VR_CALLTYPE *VR_ShutdownFn_t )();
+	static VR_ShutdownFn_t s_pReal = GetRealFunction< VR_ShutdownFn_t >( "VR_Shutdown" );
+	if ( s_pReal )
+		s_pReal();
+
+	DestroyWrappers();
+	s_captureWriter.Flush();
+	WriteSummary();
+}
+
+
+VR_INTERFACE bool VR_CALLTYPE VR_IsHmdPresent()
+{
+	typedef bool ( VR_CALLTYPE *VR_IsHmdPresentFn_t )();
+	static VR_IsHmdPresentFn_t s_pReal = GetRealFunction< VR_IsHmdPresentFn_t >( "VR_IsHmdPresent" );
+	return s_pReal ? s_pReal() : false;
+}
+
+
+VR_INTERFACE bool VR_CALLTYPE VR_IsRuntimeInstalled()
+{
+	typedef bool ( VR_CALLTYPE *VR_IsRuntimeInstalledFn_t )();
+	static VR_IsRuntimeInstalledFn_t s_pReal = GetRealFunction< VR_IsRuntimeInstalledFn_t >( "VR_IsRuntimeInstalled" );
+	return s_pReal ? s_pReal() : false;
+}
+
+
+VR_INTERFACE const char *VR_CALLTYPE VR_GetVRInitErrorAsSymbol( EVRInitError error )
+{
+	typedef const char *( VR_CALLTYPE *VR_GetVRInitErrorAsSymbolFn_t )( EVRInitError );
+	static VR_GetVRInitErrorAsSymbolFn_t s_pReal = GetRealFunction< VR_GetVRInitErrorAsSymbolFn_t >( "VR_GetVRInitErrorAsSymbol" );
+	return s_pReal ? s_pReal( error ) : "VRInitError_Init_VRClientDLLNotFound";
+}
+
+
+VR_INTERFACE const char *VR_CALLTYPE VR_GetVRInitErrorAsEnglishDescription( EVRInitError error )
+{
+	typedef const char *( VR_CALLTYPE *VR_GetVRInitErrorAsEnglishDescriptionFn_t )( EVRInitError );
+	static VR_GetVRInitErrorAsEnglishDescriptionFn_t s_pReal = GetRealFunction< VR_GetVRInitErrorAsEnglishDescriptionFn_t >( "VR_GetVRInitErrorAsEnglishDescription" );
+	return s_pReal ? s_pReal( error ) : "The real OpenVR library could not be loaded by the profiler";
+}
+
+
+VR_INTERFACE void *VR_CALLTYPE VR_GetGenericInterface( const char *pchInterfaceVersion, EVRInitError *peError )
+{
+	typedef void *( VR_CALLTYPE *VR_GetGenericInterfaceFn_t )( const char *, EVRInitError * );
+	static VR_GetGenericInterfaceFn_t s_pReal = GetRealFunction< VR_GetGenericInterfaceFn_t >( "VR_GetGenericInterface" );
+	if ( !s_pReal )
+	{
+		if ( peError )
+			*peError = VRInitError_Init_VRClientDLLNotFound;
+		return NULL;
+	}
+
+	return WrapInterface( pchInterfaceVersion, s_pReal( pchInterfaceVersion, peError ) );
+}
+
+
+// the accessors for the current interfaces only differ by name and type
+#define PROFILED_INTERFACE_ACCESSOR( InterfaceType, AccessorName ) \
+	VR_INTERFACE InterfaceType *VR_CALLTYPE AccessorName() \
+	{ \
+		typedef InterfaceType *( VR_CALLTYPE *AccessorFn_t )(); \
+		static AccessorFn_t s_pReal = GetRealFunction< AccessorFn_t >( #AccessorName ); \
+		return s_pReal ? static_cast< InterfaceType * >( WrapInterface( InterfaceType##_Version, s_pReal() ) ) : NULL; \
+	}
+
+PROFILED_INTERFACE_ACCESSOR( IVRSystem, VRSystem )
+PROFILED_INTERFACE_ACCESSOR( IVRChaperone, VRChaperone )
+PROFILED_INTERFACE_ACCESSOR( IVRChaperoneSetup, VRChaperoneSetup )
+PROFILED_INTERFACE_ACCESSOR( IVRCompositor, VRCompositor )
+PROFILED_INTERFACE_ACCESSOR( IVROverlay, VROverlay )
+PROFILED_INTERFACE_ACCESSOR( IVRRenderModels, VRRenderModels )
+PROFILED_INTERFACE_ACCESSOR( IVRTrackedCamera, VRTrackedCamera )
+PROFILED_INTERFACE_ACCESSOR( IVRExtendedDisplay, VRExtendedDisplay )
+PROFILED_INTERFACE_ACCESSOR( IVRApplications, VRApplications )
+PROFILED_INTERFACE_ACCESSOR( IVRSettings, VRSettings )
+
+} // namespace vr
@@ -0,0 +1,69 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "shared/apicapture.h"
+#include "shared/tracebuffer.h"
+
+// bucket n counts calls that took [2^n, 2^(n+1)) nanoseconds; the last one also takes anything slower
+static const uint32_t k_unLatencyBuckets = 32;
+
+/** Counters for one interface method. Updated with relaxed atomics from any thread. */
+struct ProfiledMethod_t
+{
+	const char *pchName;	// "IVRSystem::PollNextEvent"
+	const char *pchInterfaceVersion;
+	std::atomic< uint64_t > ulCalls;
+	std::atomic< uint64_t > ulTotalNs;
+	std::atomic< uint64_t > ulMaxNs;
+	std::atomic< uint64_t > rulBuckets[ k_unLatencyBuckets ];
+};
+
+// Defined by the generated openvr_api_profiler_wrappers.cpp, one entry per method in openvr_api.json
+extern ProfiledMethod_t g_rProfiledMethods[];
+extern const uint32_t g_unProfiledMethodCount;
+extern const uint32_t g_unProfiledInterfaceCount;
+
+/** Index of the interface whose current version string is pchInterfaceVersion, or -1. Older
+* versions aren't wrapped because the wrappers only know the vtable layout in openvr.h. */
+int Profiler_FindInterface( const char *pchInterfaceVersion );
+
+/** Creates and destroys the wrapper that profiles every method of interface nInterface */
+void *Profiler_CreateWrapper( int nInterface, void *pRealInterface );
+void Profiler_DestroyWrapper( int nInterface, void *pWrapper );
+
+/** The calling thread's payload buffer, emptied, while a capture is being written; otherwise NULL */
+CApiCaptureBuffer *Profiler_GetCaptureBuffer();
+
+/** Records one call to method unMethod between two Trace_GetTimestamp() values, and writes its
+* capture record if pCapture isn't NULL */
+void Profiler_EndCall( uint32_t unMethod, uint64_t ulStartTicks, uint64_t ulEndTicks, const CApiCaptureBuffer *pCapture );
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles one call to a method and, when capturing, collects its
+//			arguments and results. Only the time from Begin() to End() counts,
+//			so writing the capture isn't billed to the runtime.
+//-----------------------------------------------------------------------------
+class CProfiledCall
+{
+public:
+	explicit CProfiledCall( uint32_t unMethod ) : m_unMethod( unMethod ), m_ulStartTicks( 0 ), m_ulEndTicks( 0 ), m_pCapture( Profiler_GetCaptureBuffer() ) {}
+	~CProfiledCall() { Profiler_EndCall( m_unMethod, m_ulStartTicks, m_ulEndTicks, m_pCapture ); }
+
+	/** Where to write the call's payload, or NULL when not capturing */
+	CApiCaptureBuffer *GetCapture() const { return m_pCapture; }
+
+	void Begin() { m_ulStartTicks = Trace_GetTimestamp(); }
+	void End() { m_ulEndTicks = Trace_GetTimestamp(); }
+
+private:
+	CProfiledCall( const CProfiledCall & );
+	CProfiledCall & operator=( const CProfiledCall & );
+
+	uint32_t m_unMethod;
+	uint64_t m_ulStartTicks;
+	uint64_t m_ulEndTicks;
+	CApiCaptureBuffer *m_pCapture;
+};
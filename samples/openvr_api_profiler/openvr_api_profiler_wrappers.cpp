@@ -0,0 +1,4052 @@
+//========= Copyright Valve Corporation ============//
+// Generated by openvr_api_profiler/generate_wrappers.py from openvr_api.json. Do not edit by hand.
+#include "openvr_api_profiler.h"
+
+#include <algorithm>
+#include <string.h>
+
+#include <openvr.h>
+
+ProfiledMethod_t g_rProfiledMethods[] =
+{
+	{ "IVRSystem::GetRecommendedRenderTargetSize", vr::IVRSystem_Version },
+	{ "IVRSystem::GetProjectionMatrix", vr::IVRSystem_Version },
+	{ "IVRSystem::GetProjectionRaw", vr::IVRSystem_Version },
+	{ "IVRSystem::ComputeDistortion", vr::IVRSystem_Version },
+	{ "IVRSystem::GetEyeToHeadTransform", vr::IVRSystem_Version },
+	{ "IVRSystem::GetTimeSinceLastVsync", vr::IVRSystem_Version },
+	{ "IVRSystem::GetD3D9AdapterIndex", vr::IVRSystem_Version },
+	{ "IVRSystem::GetDXGIOutputInfo", vr::IVRSystem_Version },
+	{ "IVRSystem::IsDisplayOnDesktop", vr::IVRSystem_Version },
+	{ "IVRSystem::SetDisplayVisibility", vr::IVRSystem_Version },
+	{ "IVRSystem::GetDeviceToAbsoluteTrackingPose", vr::IVRSystem_Version },
+	{ "IVRSystem::ResetSeatedZeroPose", vr::IVRSystem_Version },
+	{ "IVRSystem::GetSeatedZeroPoseToStandingAbsoluteTrackingPose", vr::IVRSystem_Version },
+	{ "IVRSystem::GetRawZeroPoseToStandingAbsoluteTrackingPose", vr::IVRSystem_Version },
+	{ "IVRSystem::GetSortedTrackedDeviceIndicesOfClass", vr::IVRSystem_Version },
+	{ "IVRSystem::GetTrackedDeviceActivityLevel", vr::IVRSystem_Version },
+	{ "IVRSystem::ApplyTransform", vr::IVRSystem_Version },
+	{ "IVRSystem::GetTrackedDeviceIndexForControllerRole", vr::IVRSystem_Version },
+	{ "IVRSystem::GetControllerRoleForTrackedDeviceIndex", vr::IVRSystem_Version },
+	{ "IVRSystem::GetTrackedDeviceClass", vr::IVRSystem_Version },
+	{ "IVRSystem::IsTrackedDeviceConnected", vr::IVRSystem_Version },
+	{ "IVRSystem::GetBoolTrackedDeviceProperty", vr::IVRSystem_Version },
+	{ "IVRSystem::GetFloatTrackedDeviceProperty", vr::IVRSystem_Version },
+	{ "IVRSystem::GetInt32TrackedDeviceProperty", vr::IVRSystem_Version },
+	{ "IVRSystem::GetUint64TrackedDeviceProperty", vr::IVRSystem_Version },
+	{ "IVRSystem::GetMatrix34TrackedDeviceProperty", vr::IVRSystem_Version },
+	{ "IVRSystem::GetStringTrackedDeviceProperty", vr::IVRSystem_Version },
+	{ "IVRSystem::GetPropErrorNameFromEnum", vr::IVRSystem_Version },
+	{ "IVRSystem::PollNextEvent", vr::IVRSystem_Version },
+	{ "IVRSystem::PollNextEventWithPose", vr::IVRSystem_Version },
+	{ "IVRSystem::GetEventTypeNameFromEnum", vr::IVRSystem_Version },
+	{ "IVRSystem::GetHiddenAreaMesh", vr::IVRSystem_Version },
+	{ "IVRSystem::GetControllerState", vr::IVRSystem_Version },
+	{ "IVRSystem::GetControllerStateWithPose", vr::IVRSystem_Version },
+	{ "IVRSystem::TriggerHapticPulse", vr::IVRSystem_Version },
+	{ "IVRSystem::GetButtonIdNameFromEnum", vr::IVRSystem_Version },
+	{ "IVRSystem::GetControllerAxisTypeNameFromEnum", vr::IVRSystem_Version },
+	{ "IVRSystem::CaptureInputFocus", vr::IVRSystem_Version },
+	{ "IVRSystem::ReleaseInputFocus", vr::IVRSystem_Version },
+	{ "IVRSystem::IsInputFocusCapturedByAnotherProcess", vr::IVRSystem_Version },
+	{ "IVRSystem::DriverDebugRequest", vr::IVRSystem_Version },
+	{ "IVRSystem::PerformFirmwareUpdate", vr::IVRSystem_Version },
+	{ "IVRSystem::AcknowledgeQuit_Exiting", vr::IVRSystem_Version },
+	{ "IVRSystem::AcknowledgeQuit_UserPrompt", vr::IVRSystem_Version },
+	{ "IVRSystem::PerformanceTestEnableCapture", vr::IVRSystem_Version },
+	{ "IVRSystem::PerformanceTestReportFidelityLevelChange", vr::IVRSystem_Version },
+	{ "IVRExtendedDisplay::GetWindowBounds", vr::IVRExtendedDisplay_Version },
+	{ "IVRExtendedDisplay::GetEyeOutputViewport", vr::IVRExtendedDisplay_Version },
+	{ "IVRExtendedDisplay::GetDXGIOutputInfo", vr::IVRExtendedDisplay_Version },
+	{ "IVRApplications::AddApplicationManifest", vr::IVRApplications_Version },
+	{ "IVRApplications::RemoveApplicationManifest", vr::IVRApplications_Version },
+	{ "IVRApplications::IsApplicationInstalled", vr::IVRApplications_Version },
+	{ "IVRApplications::GetApplicationCount", vr::IVRApplications_Version },
+	{ "IVRApplications::GetApplicationKeyByIndex", vr::IVRApplications_Version },
+	{ "IVRApplications::GetApplicationKeyByProcessId", vr::IVRApplications_Version },
+	{ "IVRApplications::LaunchApplication", vr::IVRApplications_Version },
+	{ "IVRApplications::LaunchDashboardOverlay", vr::IVRApplications_Version },
+	{ "IVRApplications::IdentifyApplication", vr::IVRApplications_Version },
+	{ "IVRApplications::GetApplicationProcessId", vr::IVRApplications_Version },
+	{ "IVRApplications::GetApplicationsErrorNameFromEnum", vr::IVRApplications_Version },
+	{ "IVRApplications::GetApplicationPropertyString", vr::IVRApplications_Version },
+	{ "IVRApplications::GetApplicationPropertyBool", vr::IVRApplications_Version },
+	{ "IVRApplications::SetApplicationAutoLaunch", vr::IVRApplications_Version },
+	{ "IVRApplications::GetApplicationAutoLaunch", vr::IVRApplications_Version },
+	{ "IVRApplications::GetStartingApplication", vr::IVRApplications_Version },
+	{ "IVRApplications::GetTransitionState", vr::IVRApplications_Version },
+	{ "IVRApplications::PerformApplicationPrelaunchCheck", vr::IVRApplications_Version },
+	{ "IVRApplications::GetApplicationsTransitionStateNameFromEnum", vr::IVRApplications_Version },
+	{ "IVRApplications::IsQuitUserPromptRequested", vr::IVRApplications_Version },
+	{ "IVRChaperone::GetCalibrationState", vr::IVRChaperone_Version },
+	{ "IVRChaperone::GetPlayAreaSize", vr::IVRChaperone_Version },
+	{ "IVRChaperone::GetPlayAreaRect", vr::IVRChaperone_Version },
+	{ "IVRChaperone::ReloadInfo", vr::IVRChaperone_Version },
+	{ "IVRChaperone::SetSceneColor", vr::IVRChaperone_Version },
+	{ "IVRChaperone::GetBoundsColor", vr::IVRChaperone_Version },
+	{ "IVRChaperone::AreBoundsVisible", vr::IVRChaperone_Version },
+	{ "IVRChaperone::ForceBoundsVisible", vr::IVRChaperone_Version },
+	{ "IVRChaperoneSetup::CommitWorkingCopy", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::RevertWorkingCopy", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::GetWorkingPlayAreaSize", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::GetWorkingPlayAreaRect", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::GetWorkingCollisionBoundsInfo", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::GetLiveCollisionBoundsInfo", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::GetWorkingSeatedZeroPoseToRawTrackingPose", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::GetWorkingStandingZeroPoseToRawTrackingPose", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::SetWorkingPlayAreaSize", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::SetWorkingCollisionBoundsInfo", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::SetWorkingSeatedZeroPoseToRawTrackingPose", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::SetWorkingStandingZeroPoseToRawTrackingPose", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::ReloadFromDisk", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::GetLiveSeatedZeroPoseToRawTrackingPose", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::SetWorkingWallTagInfo", vr::IVRChaperoneSetup_Version },
+	{ "IVRChaperoneSetup::GetLiveWallTagInfo", vr::IVRChaperoneSetup_Version },
+	{ "IVRCompositor::SetTrackingSpace", vr::IVRCompositor_Version },
+	{ "IVRCompositor::GetTrackingSpace", vr::IVRCompositor_Version },
+	{ "IVRCompositor::WaitGetPoses", vr::IVRCompositor_Version },
+	{ "IVRCompositor::GetLastPoses", vr::IVRCompositor_Version },
+	{ "IVRCompositor::Submit", vr::IVRCompositor_Version },
+	{ "IVRCompositor::ClearLastSubmittedFrame", vr::IVRCompositor_Version },
+	{ "IVRCompositor::PostPresentHandoff", vr::IVRCompositor_Version },
+	{ "IVRCompositor::GetFrameTiming", vr::IVRCompositor_Version },
+	{ "IVRCompositor::GetFrameTimeRemaining", vr::IVRCompositor_Version },
+	{ "IVRCompositor::FadeToColor", vr::IVRCompositor_Version },
+	{ "IVRCompositor::FadeGrid", vr::IVRCompositor_Version },
+	{ "IVRCompositor::SetSkyboxOverride", vr::IVRCompositor_Version },
+	{ "IVRCompositor::ClearSkyboxOverride", vr::IVRCompositor_Version },
+	{ "IVRCompositor::CompositorBringToFront", vr::IVRCompositor_Version },
+	{ "IVRCompositor::CompositorGoToBack", vr::IVRCompositor_Version },
+	{ "IVRCompositor::CompositorQuit", vr::IVRCompositor_Version },
+	{ "IVRCompositor::IsFullscreen", vr::IVRCompositor_Version },
+	{ "IVRCompositor::GetCurrentSceneFocusProcess", vr::IVRCompositor_Version },
+	{ "IVRCompositor::GetLastFrameRenderer", vr::IVRCompositor_Version },
+	{ "IVRCompositor::CanRenderScene", vr::IVRCompositor_Version },
+	{ "IVRCompositor::ShowMirrorWindow", vr::IVRCompositor_Version },
+	{ "IVRCompositor::HideMirrorWindow", vr::IVRCompositor_Version },
+	{ "IVRCompositor::IsMirrorWindowVisible", vr::IVRCompositor_Version },
+	{ "IVRCompositor::CompositorDumpImages", vr::IVRCompositor_Version },
+	{ "IVROverlay::FindOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::CreateOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::DestroyOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::SetHighQualityOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::GetHighQualityOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayKey", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayName", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayImageData", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayErrorNameFromEnum", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayFlag", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayFlag", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayColor", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayColor", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayAlpha", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayAlpha", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayWidthInMeters", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayWidthInMeters", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayAutoCurveDistanceRangeInMeters", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayAutoCurveDistanceRangeInMeters", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayTextureColorSpace", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayTextureColorSpace", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayTextureBounds", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayTextureBounds", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayTransformType", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayTransformAbsolute", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayTransformAbsolute", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayTransformTrackedDeviceRelative", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayTransformTrackedDeviceRelative", vr::IVROverlay_Version },
+	{ "IVROverlay::ShowOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::HideOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::IsOverlayVisible", vr::IVROverlay_Version },
+	{ "IVROverlay::GetTransformForOverlayCoordinates", vr::IVROverlay_Version },
+	{ "IVROverlay::PollNextOverlayEvent", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayInputMethod", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayInputMethod", vr::IVROverlay_Version },
+	{ "IVROverlay::GetOverlayMouseScale", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayMouseScale", vr::IVROverlay_Version },
+	{ "IVROverlay::ComputeOverlayIntersection", vr::IVROverlay_Version },
+	{ "IVROverlay::HandleControllerOverlayInteractionAsMouse", vr::IVROverlay_Version },
+	{ "IVROverlay::IsHoverTargetOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::GetGamepadFocusOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::SetGamepadFocusOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayNeighbor", vr::IVROverlay_Version },
+	{ "IVROverlay::MoveGamepadFocusToNeighbor", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayTexture", vr::IVROverlay_Version },
+	{ "IVROverlay::ClearOverlayTexture", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayRaw", vr::IVROverlay_Version },
+	{ "IVROverlay::SetOverlayFromFile", vr::IVROverlay_Version },
+	{ "IVROverlay::CreateDashboardOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::IsDashboardVisible", vr::IVROverlay_Version },
+	{ "IVROverlay::IsActiveDashboardOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::SetDashboardOverlaySceneProcess", vr::IVROverlay_Version },
+	{ "IVROverlay::GetDashboardOverlaySceneProcess", vr::IVROverlay_Version },
+	{ "IVROverlay::ShowDashboard", vr::IVROverlay_Version },
+	{ "IVROverlay::ShowKeyboard", vr::IVROverlay_Version },
+	{ "IVROverlay::ShowKeyboardForOverlay", vr::IVROverlay_Version },
+	{ "IVROverlay::GetKeyboardText", vr::IVROverlay_Version },
+	{ "IVROverlay::HideKeyboard", vr::IVROverlay_Version },
+	{ "IVROverlay::SetKeyboardTransformAbsolute", vr::IVROverlay_Version },
+	{ "IVROverlay::SetKeyboardPositionForOverlay", vr::IVROverlay_Version },
+	{ "IVRRenderModels::LoadRenderModel", vr::IVRRenderModels_Version },
+	{ "IVRRenderModels::FreeRenderModel", vr::IVRRenderModels_Version },
+	{ "IVRRenderModels::LoadTexture", vr::IVRRenderModels_Version },
+	{ "IVRRenderModels::FreeTexture", vr::IVRRenderModels_Version },
+	{ "IVRRenderModels::GetRenderModelName", vr::IVRRenderModels_Version },
+	{ "IVRRenderModels::GetRenderModelCount", vr::IVRRenderModels_Version },
+	{ "IVRRenderModels::GetComponentCount", vr::IVRRenderModels_Version },
+	{ "IVRRenderModels::GetComponentName", vr::IVRRenderModels_Version },
+	{ "IVRRenderModels::GetComponentButtonMask", vr::IVRRenderModels_Version },
+	{ "IVRRenderModels::GetComponentRenderModelName", vr::IVRRenderModels_Version },
+	{ "IVRRenderModels::GetComponentState", vr::IVRRenderModels_Version },
+	{ "IVRNotifications::CreateNotification", vr::IVRNotifications_Version },
+	{ "IVRNotifications::RemoveNotification", vr::IVRNotifications_Version },
+	{ "IVRSettings::GetSettingsErrorNameFromEnum", vr::IVRSettings_Version },
+	{ "IVRSettings::Sync", vr::IVRSettings_Version },
+	{ "IVRSettings::GetBool", vr::IVRSettings_Version },
+	{ "IVRSettings::SetBool", vr::IVRSettings_Version },
+	{ "IVRSettings::GetInt32", vr::IVRSettings_Version },
+	{ "IVRSettings::SetInt32", vr::IVRSettings_Version },
+	{ "IVRSettings::GetFloat", vr::IVRSettings_Version },
+	{ "IVRSettings::SetFloat", vr::IVRSettings_Version },
+	{ "IVRSettings::GetString", vr::IVRSettings_Version },
+	{ "IVRSettings::SetString", vr::IVRSettings_Version },
+	{ "IVRTrackedCamera::HasCamera", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::GetCameraFirmwareDescription", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::GetCameraFrameDimensions", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::SetCameraVideoStreamFormat", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::GetCameraVideoStreamFormat", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::EnableCameraForStreaming", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::StartVideoStream", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::StopVideoStream", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::IsVideoStreamActive", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::GetVideoStreamElapsedTime", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::GetVideoStreamFrame", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::ReleaseVideoStreamFrame", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::SetAutoExposure", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::PauseVideoStream", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::ResumeVideoStream", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::IsVideoStreamPaused", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::GetCameraDistortion", vr::IVRTrackedCamera_Version },
+	{ "IVRTrackedCamera::GetCameraProjection", vr::IVRTrackedCamera_Version },
+};
+
+const uint32_t g_unProfiledMethodCount = sizeof( g_rProfiledMethods ) / sizeof( g_rProfiledMethods[0] );
+const uint32_t g_unProfiledInterfaceCount = 11;
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles every call to vr::IVRSystem
+//-----------------------------------------------------------------------------
+class CProfiledIVRSystem final : public vr::IVRSystem
+{
+public:
+	explicit CProfiledIVRSystem( vr::IVRSystem *pReal ) : m_pReal( pReal ) {}
+
+	virtual void GetRecommendedRenderTargetSize( uint32_t *pnWidth, uint32_t *pnHeight ) override
+	{
+		CProfiledCall call( 0 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pnWidth ? 1 : 0 );
+			pCapture->WriteVarint( pnHeight ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->GetRecommendedRenderTargetSize( pnWidth, pnHeight );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pnWidth, 1 );
+			pCapture->WriteArray( pnHeight, 1 );
+		}
+	}
+
+	virtual struct vr::HmdMatrix44_t GetProjectionMatrix( vr::EVREye eEye, float fNearZ, float fFarZ, vr::EGraphicsAPIConvention eProjType ) override
+	{
+		CProfiledCall call( 1 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eEye );
+			pCapture->WriteValue( fNearZ );
+			pCapture->WriteValue( fFarZ );
+			pCapture->WriteValue( eProjType );
+		}
+		call.Begin();
+		struct vr::HmdMatrix44_t result = m_pReal->GetProjectionMatrix( eEye, fNearZ, fFarZ, eProjType );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual void GetProjectionRaw( vr::EVREye eEye, float *pfLeft, float *pfRight, float *pfTop, float *pfBottom ) override
+	{
+		CProfiledCall call( 2 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eEye );
+			pCapture->WriteVarint( pfLeft ? 1 : 0 );
+			pCapture->WriteVarint( pfRight ? 1 : 0 );
+			pCapture->WriteVarint( pfTop ? 1 : 0 );
+			pCapture->WriteVarint( pfBottom ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->GetProjectionRaw( eEye, pfLeft, pfRight, pfTop, pfBottom );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pfLeft, 1 );
+			pCapture->WriteArray( pfRight, 1 );
+			pCapture->WriteArray( pfTop, 1 );
+			pCapture->WriteArray( pfBottom, 1 );
+		}
+	}
+
+	virtual struct vr::DistortionCoordinates_t ComputeDistortion( vr::EVREye eEye, float fU, float fV ) override
+	{
+		CProfiledCall call( 3 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eEye );
+			pCapture->WriteValue( fU );
+			pCapture->WriteValue( fV );
+		}
+		call.Begin();
+		struct vr::DistortionCoordinates_t result = m_pReal->ComputeDistortion( eEye, fU, fV );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual struct vr::HmdMatrix34_t GetEyeToHeadTransform( vr::EVREye eEye ) override
+	{
+		CProfiledCall call( 4 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eEye );
+		}
+		call.Begin();
+		struct vr::HmdMatrix34_t result = m_pReal->GetEyeToHeadTransform( eEye );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool GetTimeSinceLastVsync( float *pfSecondsSinceLastVsync, uint64_t *pulFrameCounter ) override
+	{
+		CProfiledCall call( 5 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pfSecondsSinceLastVsync ? 1 : 0 );
+			pCapture->WriteVarint( pulFrameCounter ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetTimeSinceLastVsync( pfSecondsSinceLastVsync, pulFrameCounter );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pfSecondsSinceLastVsync, 1 );
+			pCapture->WriteArray( pulFrameCounter, 1 );
+		}
+		return result;
+	}
+
+	virtual int32_t GetD3D9AdapterIndex() override
+	{
+		CProfiledCall call( 6 );
+		call.Begin();
+		int32_t result = m_pReal->GetD3D9AdapterIndex();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual void GetDXGIOutputInfo( int32_t *pnAdapterIndex ) override
+	{
+		CProfiledCall call( 7 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pnAdapterIndex ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->GetDXGIOutputInfo( pnAdapterIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pnAdapterIndex, 1 );
+		}
+	}
+
+	virtual bool IsDisplayOnDesktop() override
+	{
+		CProfiledCall call( 8 );
+		call.Begin();
+		bool result = m_pReal->IsDisplayOnDesktop();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool SetDisplayVisibility( bool bIsVisibleOnDesktop ) override
+	{
+		CProfiledCall call( 9 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( bIsVisibleOnDesktop );
+		}
+		call.Begin();
+		bool result = m_pReal->SetDisplayVisibility( bIsVisibleOnDesktop );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual void GetDeviceToAbsoluteTrackingPose( vr::ETrackingUniverseOrigin eOrigin, float fPredictedSecondsToPhotonsFromNow, struct vr::TrackedDevicePose_t *pTrackedDevicePoseArray, uint32_t unTrackedDevicePoseArrayCount ) override
+	{
+		CProfiledCall call( 10 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eOrigin );
+			pCapture->WriteValue( fPredictedSecondsToPhotonsFromNow );
+			pCapture->WriteVarint( pTrackedDevicePoseArray ? 1 : 0 );
+			pCapture->WriteValue( unTrackedDevicePoseArrayCount );
+		}
+		call.Begin();
+		m_pReal->GetDeviceToAbsoluteTrackingPose( eOrigin, fPredictedSecondsToPhotonsFromNow, pTrackedDevicePoseArray, unTrackedDevicePoseArrayCount );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pTrackedDevicePoseArray, (uint32_t)unTrackedDevicePoseArrayCount );
+		}
+	}
+
+	virtual void ResetSeatedZeroPose() override
+	{
+		CProfiledCall call( 11 );
+		call.Begin();
+		m_pReal->ResetSeatedZeroPose();
+		call.End();
+	}
+
+	virtual struct vr::HmdMatrix34_t GetSeatedZeroPoseToStandingAbsoluteTrackingPose() override
+	{
+		CProfiledCall call( 12 );
+		call.Begin();
+		struct vr::HmdMatrix34_t result = m_pReal->GetSeatedZeroPoseToStandingAbsoluteTrackingPose();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual struct vr::HmdMatrix34_t GetRawZeroPoseToStandingAbsoluteTrackingPose() override
+	{
+		CProfiledCall call( 13 );
+		call.Begin();
+		struct vr::HmdMatrix34_t result = m_pReal->GetRawZeroPoseToStandingAbsoluteTrackingPose();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetSortedTrackedDeviceIndicesOfClass( vr::ETrackedDeviceClass eTrackedDeviceClass, vr::TrackedDeviceIndex_t *punTrackedDeviceIndexArray, uint32_t unTrackedDeviceIndexArrayCount, vr::TrackedDeviceIndex_t unRelativeToTrackedDeviceIndex ) override
+	{
+		CProfiledCall call( 14 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eTrackedDeviceClass );
+			pCapture->WriteVarint( punTrackedDeviceIndexArray ? 1 : 0 );
+			pCapture->WriteValue( unTrackedDeviceIndexArrayCount );
+			pCapture->WriteValue( unRelativeToTrackedDeviceIndex );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->GetSortedTrackedDeviceIndicesOfClass( eTrackedDeviceClass, punTrackedDeviceIndexArray, unTrackedDeviceIndexArrayCount, unRelativeToTrackedDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( punTrackedDeviceIndexArray, (uint32_t)unTrackedDeviceIndexArrayCount );
+		}
+		return result;
+	}
+
+	virtual vr::EDeviceActivityLevel GetTrackedDeviceActivityLevel( vr::TrackedDeviceIndex_t unDeviceId ) override
+	{
+		CProfiledCall call( 15 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceId );
+		}
+		call.Begin();
+		vr::EDeviceActivityLevel result = m_pReal->GetTrackedDeviceActivityLevel( unDeviceId );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual void ApplyTransform( struct vr::TrackedDevicePose_t *pOutputPose, const struct vr::TrackedDevicePose_t *pTrackedDevicePose, const struct vr::HmdMatrix34_t *pTransform ) override
+	{
+		CProfiledCall call( 16 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pOutputPose ? 1 : 0 );
+			pCapture->WriteArray( pTrackedDevicePose, 1 );
+			pCapture->WriteArray( pTransform, 1 );
+		}
+		call.Begin();
+		m_pReal->ApplyTransform( pOutputPose, pTrackedDevicePose, pTransform );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pOutputPose, 1 );
+		}
+	}
+
+	virtual vr::TrackedDeviceIndex_t GetTrackedDeviceIndexForControllerRole( vr::ETrackedControllerRole unDeviceType ) override
+	{
+		CProfiledCall call( 17 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceType );
+		}
+		call.Begin();
+		vr::TrackedDeviceIndex_t result = m_pReal->GetTrackedDeviceIndexForControllerRole( unDeviceType );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::ETrackedControllerRole GetControllerRoleForTrackedDeviceIndex( vr::TrackedDeviceIndex_t unDeviceIndex ) override
+	{
+		CProfiledCall call( 18 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceIndex );
+		}
+		call.Begin();
+		vr::ETrackedControllerRole result = m_pReal->GetControllerRoleForTrackedDeviceIndex( unDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::ETrackedDeviceClass GetTrackedDeviceClass( vr::TrackedDeviceIndex_t unDeviceIndex ) override
+	{
+		CProfiledCall call( 19 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceIndex );
+		}
+		call.Begin();
+		vr::ETrackedDeviceClass result = m_pReal->GetTrackedDeviceClass( unDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool IsTrackedDeviceConnected( vr::TrackedDeviceIndex_t unDeviceIndex ) override
+	{
+		CProfiledCall call( 20 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceIndex );
+		}
+		call.Begin();
+		bool result = m_pReal->IsTrackedDeviceConnected( unDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool GetBoolTrackedDeviceProperty( vr::TrackedDeviceIndex_t unDeviceIndex, vr::ETrackedDeviceProperty prop, vr::ETrackedPropertyError *pError ) override
+	{
+		CProfiledCall call( 21 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceIndex );
+			pCapture->WriteValue( prop );
+			pCapture->WriteVarint( pError ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetBoolTrackedDeviceProperty( unDeviceIndex, prop, pError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pError, 1 );
+		}
+		return result;
+	}
+
+	virtual float GetFloatTrackedDeviceProperty( vr::TrackedDeviceIndex_t unDeviceIndex, vr::ETrackedDeviceProperty prop, vr::ETrackedPropertyError *pError ) override
+	{
+		CProfiledCall call( 22 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceIndex );
+			pCapture->WriteValue( prop );
+			pCapture->WriteVarint( pError ? 1 : 0 );
+		}
+		call.Begin();
+		float result = m_pReal->GetFloatTrackedDeviceProperty( unDeviceIndex, prop, pError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pError, 1 );
+		}
+		return result;
+	}
+
+	virtual int32_t GetInt32TrackedDeviceProperty( vr::TrackedDeviceIndex_t unDeviceIndex, vr::ETrackedDeviceProperty prop, vr::ETrackedPropertyError *pError ) override
+	{
+		CProfiledCall call( 23 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceIndex );
+			pCapture->WriteValue( prop );
+			pCapture->WriteVarint( pError ? 1 : 0 );
+		}
+		call.Begin();
+		int32_t result = m_pReal->GetInt32TrackedDeviceProperty( unDeviceIndex, prop, pError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pError, 1 );
+		}
+		return result;
+	}
+
+	virtual uint64_t GetUint64TrackedDeviceProperty( vr::TrackedDeviceIndex_t unDeviceIndex, vr::ETrackedDeviceProperty prop, vr::ETrackedPropertyError *pError ) override
+	{
+		CProfiledCall call( 24 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceIndex );
+			pCapture->WriteValue( prop );
+			pCapture->WriteVarint( pError ? 1 : 0 );
+		}
+		call.Begin();
+		uint64_t result = m_pReal->GetUint64TrackedDeviceProperty( unDeviceIndex, prop, pError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pError, 1 );
+		}
+		return result;
+	}
+
+	virtual struct vr::HmdMatrix34_t GetMatrix34TrackedDeviceProperty( vr::TrackedDeviceIndex_t unDeviceIndex, vr::ETrackedDeviceProperty prop, vr::ETrackedPropertyError *pError ) override
+	{
+		CProfiledCall call( 25 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceIndex );
+			pCapture->WriteValue( prop );
+			pCapture->WriteVarint( pError ? 1 : 0 );
+		}
+		call.Begin();
+		struct vr::HmdMatrix34_t result = m_pReal->GetMatrix34TrackedDeviceProperty( unDeviceIndex, prop, pError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pError, 1 );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetStringTrackedDeviceProperty( vr::TrackedDeviceIndex_t unDeviceIndex, vr::ETrackedDeviceProperty prop, char *pchValue, uint32_t unBufferSize, vr::ETrackedPropertyError *pError ) override
+	{
+		CProfiledCall call( 26 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceIndex );
+			pCapture->WriteValue( prop );
+			pCapture->WriteVarint( pchValue ? 1 : 0 );
+			pCapture->WriteValue( unBufferSize );
+			pCapture->WriteVarint( pError ? 1 : 0 );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->GetStringTrackedDeviceProperty( unDeviceIndex, prop, pchValue, unBufferSize, pError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchValue, unBufferSize );
+			pCapture->WriteArray( pError, 1 );
+		}
+		return result;
+	}
+
+	virtual const char * GetPropErrorNameFromEnum( vr::ETrackedPropertyError error ) override
+	{
+		CProfiledCall call( 27 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( error );
+		}
+		call.Begin();
+		const char * result = m_pReal->GetPropErrorNameFromEnum( error );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( result );
+		}
+		return result;
+	}
+
+	virtual bool PollNextEvent( struct vr::VREvent_t *pEvent ) override
+	{
+		CProfiledCall call( 28 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pEvent ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->PollNextEvent( pEvent );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pEvent, 1 );
+		}
+		return result;
+	}
+
+	virtual bool PollNextEventWithPose( vr::ETrackingUniverseOrigin eOrigin, vr::VREvent_t *pEvent, vr::TrackedDevicePose_t *pTrackedDevicePose ) override
+	{
+		CProfiledCall call( 29 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eOrigin );
+			pCapture->WriteVarint( pEvent ? 1 : 0 );
+			pCapture->WriteVarint( pTrackedDevicePose ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->PollNextEventWithPose( eOrigin, pEvent, pTrackedDevicePose );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pEvent, 1 );
+			pCapture->WriteArray( pTrackedDevicePose, 1 );
+		}
+		return result;
+	}
+
+	virtual const char * GetEventTypeNameFromEnum( vr::EVREventType eType ) override
+	{
+		CProfiledCall call( 30 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eType );
+		}
+		call.Begin();
+		const char * result = m_pReal->GetEventTypeNameFromEnum( eType );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( result );
+		}
+		return result;
+	}
+
+	virtual struct vr::HiddenAreaMesh_t GetHiddenAreaMesh( vr::EVREye eEye ) override
+	{
+		CProfiledCall call( 31 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eEye );
+		}
+		call.Begin();
+		struct vr::HiddenAreaMesh_t result = m_pReal->GetHiddenAreaMesh( eEye );
+		call.End();
+		return result;
+	}
+
+	virtual bool GetControllerState( vr::TrackedDeviceIndex_t unControllerDeviceIndex, vr::VRControllerState_t *pControllerState ) override
+	{
+		CProfiledCall call( 32 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unControllerDeviceIndex );
+			pCapture->WriteVarint( pControllerState ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetControllerState( unControllerDeviceIndex, pControllerState );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pControllerState, 1 );
+		}
+		return result;
+	}
+
+	virtual bool GetControllerStateWithPose( vr::ETrackingUniverseOrigin eOrigin, vr::TrackedDeviceIndex_t unControllerDeviceIndex, vr::VRControllerState_t *pControllerState, struct vr::TrackedDevicePose_t *pTrackedDevicePose ) override
+	{
+		CProfiledCall call( 33 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eOrigin );
+			pCapture->WriteValue( unControllerDeviceIndex );
+			pCapture->WriteVarint( pControllerState ? 1 : 0 );
+			pCapture->WriteVarint( pTrackedDevicePose ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetControllerStateWithPose( eOrigin, unControllerDeviceIndex, pControllerState, pTrackedDevicePose );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pControllerState, 1 );
+			pCapture->WriteArray( pTrackedDevicePose, 1 );
+		}
+		return result;
+	}
+
+	virtual void TriggerHapticPulse( vr::TrackedDeviceIndex_t unControllerDeviceIndex, uint32_t unAxisId, unsigned short usDurationMicroSec ) override
+	{
+		CProfiledCall call( 34 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unControllerDeviceIndex );
+			pCapture->WriteValue( unAxisId );
+			pCapture->WriteValue( usDurationMicroSec );
+		}
+		call.Begin();
+		m_pReal->TriggerHapticPulse( unControllerDeviceIndex, unAxisId, usDurationMicroSec );
+		call.End();
+	}
+
+	virtual const char * GetButtonIdNameFromEnum( vr::EVRButtonId eButtonId ) override
+	{
+		CProfiledCall call( 35 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eButtonId );
+		}
+		call.Begin();
+		const char * result = m_pReal->GetButtonIdNameFromEnum( eButtonId );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( result );
+		}
+		return result;
+	}
+
+	virtual const char * GetControllerAxisTypeNameFromEnum( vr::EVRControllerAxisType eAxisType ) override
+	{
+		CProfiledCall call( 36 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eAxisType );
+		}
+		call.Begin();
+		const char * result = m_pReal->GetControllerAxisTypeNameFromEnum( eAxisType );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( result );
+		}
+		return result;
+	}
+
+	virtual bool CaptureInputFocus() override
+	{
+		CProfiledCall call( 37 );
+		call.Begin();
+		bool result = m_pReal->CaptureInputFocus();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual void ReleaseInputFocus() override
+	{
+		CProfiledCall call( 38 );
+		call.Begin();
+		m_pReal->ReleaseInputFocus();
+		call.End();
+	}
+
+	virtual bool IsInputFocusCapturedByAnotherProcess() override
+	{
+		CProfiledCall call( 39 );
+		call.Begin();
+		bool result = m_pReal->IsInputFocusCapturedByAnotherProcess();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t DriverDebugRequest( vr::TrackedDeviceIndex_t unDeviceIndex, const char *pchRequest, char *pchResponseBuffer, uint32_t unResponseBufferSize ) override
+	{
+		CProfiledCall call( 40 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceIndex );
+			pCapture->WriteString( pchRequest );
+			pCapture->WriteVarint( pchResponseBuffer ? 1 : 0 );
+			pCapture->WriteValue( unResponseBufferSize );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->DriverDebugRequest( unDeviceIndex, pchRequest, pchResponseBuffer, unResponseBufferSize );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchResponseBuffer, unResponseBufferSize );
+		}
+		return result;
+	}
+
+	virtual vr::EVRFirmwareError PerformFirmwareUpdate( vr::TrackedDeviceIndex_t unDeviceIndex ) override
+	{
+		CProfiledCall call( 41 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unDeviceIndex );
+		}
+		call.Begin();
+		vr::EVRFirmwareError result = m_pReal->PerformFirmwareUpdate( unDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual void AcknowledgeQuit_Exiting() override
+	{
+		CProfiledCall call( 42 );
+		call.Begin();
+		m_pReal->AcknowledgeQuit_Exiting();
+		call.End();
+	}
+
+	virtual void AcknowledgeQuit_UserPrompt() override
+	{
+		CProfiledCall call( 43 );
+		call.Begin();
+		m_pReal->AcknowledgeQuit_UserPrompt();
+		call.End();
+	}
+
+	virtual void PerformanceTestEnableCapture( bool bEnable ) override
+	{
+		CProfiledCall call( 44 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( bEnable );
+		}
+		call.Begin();
+		m_pReal->PerformanceTestEnableCapture( bEnable );
+		call.End();
+	}
+
+	virtual void PerformanceTestReportFidelityLevelChange( int nFidelityLevel ) override
+	{
+		CProfiledCall call( 45 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nFidelityLevel );
+		}
+		call.Begin();
+		m_pReal->PerformanceTestReportFidelityLevelChange( nFidelityLevel );
+		call.End();
+	}
+
+private:
+	vr::IVRSystem *m_pReal;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles every call to vr::IVRExtendedDisplay
+//-----------------------------------------------------------------------------
+class CProfiledIVRExtendedDisplay final : public vr::IVRExtendedDisplay
+{
+public:
+	explicit CProfiledIVRExtendedDisplay( vr::IVRExtendedDisplay *pReal ) : m_pReal( pReal ) {}
+
+	virtual void GetWindowBounds( int32_t *pnX, int32_t *pnY, uint32_t *pnWidth, uint32_t *pnHeight ) override
+	{
+		CProfiledCall call( 46 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pnX ? 1 : 0 );
+			pCapture->WriteVarint( pnY ? 1 : 0 );
+			pCapture->WriteVarint( pnWidth ? 1 : 0 );
+			pCapture->WriteVarint( pnHeight ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->GetWindowBounds( pnX, pnY, pnWidth, pnHeight );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pnX, 1 );
+			pCapture->WriteArray( pnY, 1 );
+			pCapture->WriteArray( pnWidth, 1 );
+			pCapture->WriteArray( pnHeight, 1 );
+		}
+	}
+
+	virtual void GetEyeOutputViewport( vr::EVREye eEye, uint32_t *pnX, uint32_t *pnY, uint32_t *pnWidth, uint32_t *pnHeight ) override
+	{
+		CProfiledCall call( 47 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eEye );
+			pCapture->WriteVarint( pnX ? 1 : 0 );
+			pCapture->WriteVarint( pnY ? 1 : 0 );
+			pCapture->WriteVarint( pnWidth ? 1 : 0 );
+			pCapture->WriteVarint( pnHeight ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->GetEyeOutputViewport( eEye, pnX, pnY, pnWidth, pnHeight );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pnX, 1 );
+			pCapture->WriteArray( pnY, 1 );
+			pCapture->WriteArray( pnWidth, 1 );
+			pCapture->WriteArray( pnHeight, 1 );
+		}
+	}
+
+	virtual void GetDXGIOutputInfo( int32_t *pnAdapterIndex, int32_t *pnAdapterOutputIndex ) override
+	{
+		CProfiledCall call( 48 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pnAdapterIndex ? 1 : 0 );
+			pCapture->WriteVarint( pnAdapterOutputIndex ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->GetDXGIOutputInfo( pnAdapterIndex, pnAdapterOutputIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pnAdapterIndex, 1 );
+			pCapture->WriteArray( pnAdapterOutputIndex, 1 );
+		}
+	}
+
+private:
+	vr::IVRExtendedDisplay *m_pReal;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles every call to vr::IVRApplications
+//-----------------------------------------------------------------------------
+class CProfiledIVRApplications final : public vr::IVRApplications
+{
+public:
+	explicit CProfiledIVRApplications( vr::IVRApplications *pReal ) : m_pReal( pReal ) {}
+
+	virtual vr::EVRApplicationError AddApplicationManifest( const char *pchApplicationManifestFullPath, bool bTemporary ) override
+	{
+		CProfiledCall call( 49 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchApplicationManifestFullPath );
+			pCapture->WriteValue( bTemporary );
+		}
+		call.Begin();
+		vr::EVRApplicationError result = m_pReal->AddApplicationManifest( pchApplicationManifestFullPath, bTemporary );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVRApplicationError RemoveApplicationManifest( const char *pchApplicationManifestFullPath ) override
+	{
+		CProfiledCall call( 50 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchApplicationManifestFullPath );
+		}
+		call.Begin();
+		vr::EVRApplicationError result = m_pReal->RemoveApplicationManifest( pchApplicationManifestFullPath );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool IsApplicationInstalled( const char *pchAppKey ) override
+	{
+		CProfiledCall call( 51 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchAppKey );
+		}
+		call.Begin();
+		bool result = m_pReal->IsApplicationInstalled( pchAppKey );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetApplicationCount() override
+	{
+		CProfiledCall call( 52 );
+		call.Begin();
+		uint32_t result = m_pReal->GetApplicationCount();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVRApplicationError GetApplicationKeyByIndex( uint32_t unApplicationIndex, char *pchAppKeyBuffer, uint32_t unAppKeyBufferLen ) override
+	{
+		CProfiledCall call( 53 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unApplicationIndex );
+			pCapture->WriteVarint( pchAppKeyBuffer ? 1 : 0 );
+			pCapture->WriteValue( unAppKeyBufferLen );
+		}
+		call.Begin();
+		vr::EVRApplicationError result = m_pReal->GetApplicationKeyByIndex( unApplicationIndex, pchAppKeyBuffer, unAppKeyBufferLen );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchAppKeyBuffer, unAppKeyBufferLen );
+		}
+		return result;
+	}
+
+	virtual vr::EVRApplicationError GetApplicationKeyByProcessId( uint32_t unProcessId, char *pchAppKeyBuffer, uint32_t unAppKeyBufferLen ) override
+	{
+		CProfiledCall call( 54 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unProcessId );
+			pCapture->WriteVarint( pchAppKeyBuffer ? 1 : 0 );
+			pCapture->WriteValue( unAppKeyBufferLen );
+		}
+		call.Begin();
+		vr::EVRApplicationError result = m_pReal->GetApplicationKeyByProcessId( unProcessId, pchAppKeyBuffer, unAppKeyBufferLen );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchAppKeyBuffer, unAppKeyBufferLen );
+		}
+		return result;
+	}
+
+	virtual vr::EVRApplicationError LaunchApplication( const char *pchAppKey ) override
+	{
+		CProfiledCall call( 55 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchAppKey );
+		}
+		call.Begin();
+		vr::EVRApplicationError result = m_pReal->LaunchApplication( pchAppKey );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVRApplicationError LaunchDashboardOverlay( const char *pchAppKey ) override
+	{
+		CProfiledCall call( 56 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchAppKey );
+		}
+		call.Begin();
+		vr::EVRApplicationError result = m_pReal->LaunchDashboardOverlay( pchAppKey );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVRApplicationError IdentifyApplication( uint32_t unProcessId, const char *pchAppKey ) override
+	{
+		CProfiledCall call( 57 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unProcessId );
+			pCapture->WriteString( pchAppKey );
+		}
+		call.Begin();
+		vr::EVRApplicationError result = m_pReal->IdentifyApplication( unProcessId, pchAppKey );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetApplicationProcessId( const char *pchAppKey ) override
+	{
+		CProfiledCall call( 58 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchAppKey );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->GetApplicationProcessId( pchAppKey );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual const char * GetApplicationsErrorNameFromEnum( vr::EVRApplicationError error ) override
+	{
+		CProfiledCall call( 59 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( error );
+		}
+		call.Begin();
+		const char * result = m_pReal->GetApplicationsErrorNameFromEnum( error );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetApplicationPropertyString( const char *pchAppKey, vr::EVRApplicationProperty eProperty, char *pchPropertyValueBuffer, uint32_t unPropertyValueBufferLen, vr::EVRApplicationError *peError ) override
+	{
+		CProfiledCall call( 60 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchAppKey );
+			pCapture->WriteValue( eProperty );
+			pCapture->WriteVarint( pchPropertyValueBuffer ? 1 : 0 );
+			pCapture->WriteValue( unPropertyValueBufferLen );
+			pCapture->WriteVarint( peError ? 1 : 0 );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->GetApplicationPropertyString( pchAppKey, eProperty, pchPropertyValueBuffer, unPropertyValueBufferLen, peError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchPropertyValueBuffer, unPropertyValueBufferLen );
+			pCapture->WriteArray( peError, 1 );
+		}
+		return result;
+	}
+
+	virtual bool GetApplicationPropertyBool( const char *pchAppKey, vr::EVRApplicationProperty eProperty, vr::EVRApplicationError *peError ) override
+	{
+		CProfiledCall call( 61 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchAppKey );
+			pCapture->WriteValue( eProperty );
+			pCapture->WriteVarint( peError ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetApplicationPropertyBool( pchAppKey, eProperty, peError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( peError, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVRApplicationError SetApplicationAutoLaunch( const char *pchAppKey, bool bAutoLaunch ) override
+	{
+		CProfiledCall call( 62 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchAppKey );
+			pCapture->WriteValue( bAutoLaunch );
+		}
+		call.Begin();
+		vr::EVRApplicationError result = m_pReal->SetApplicationAutoLaunch( pchAppKey, bAutoLaunch );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool GetApplicationAutoLaunch( const char *pchAppKey ) override
+	{
+		CProfiledCall call( 63 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchAppKey );
+		}
+		call.Begin();
+		bool result = m_pReal->GetApplicationAutoLaunch( pchAppKey );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVRApplicationError GetStartingApplication( char *pchAppKeyBuffer, uint32_t unAppKeyBufferLen ) override
+	{
+		CProfiledCall call( 64 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pchAppKeyBuffer ? 1 : 0 );
+			pCapture->WriteValue( unAppKeyBufferLen );
+		}
+		call.Begin();
+		vr::EVRApplicationError result = m_pReal->GetStartingApplication( pchAppKeyBuffer, unAppKeyBufferLen );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchAppKeyBuffer, unAppKeyBufferLen );
+		}
+		return result;
+	}
+
+	virtual vr::EVRApplicationTransitionState GetTransitionState() override
+	{
+		CProfiledCall call( 65 );
+		call.Begin();
+		vr::EVRApplicationTransitionState result = m_pReal->GetTransitionState();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVRApplicationError PerformApplicationPrelaunchCheck( const char *pchAppKey ) override
+	{
+		CProfiledCall call( 66 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchAppKey );
+		}
+		call.Begin();
+		vr::EVRApplicationError result = m_pReal->PerformApplicationPrelaunchCheck( pchAppKey );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual const char * GetApplicationsTransitionStateNameFromEnum( vr::EVRApplicationTransitionState state ) override
+	{
+		CProfiledCall call( 67 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( state );
+		}
+		call.Begin();
+		const char * result = m_pReal->GetApplicationsTransitionStateNameFromEnum( state );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( result );
+		}
+		return result;
+	}
+
+	virtual bool IsQuitUserPromptRequested() override
+	{
+		CProfiledCall call( 68 );
+		call.Begin();
+		bool result = m_pReal->IsQuitUserPromptRequested();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+private:
+	vr::IVRApplications *m_pReal;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles every call to vr::IVRChaperone
+//-----------------------------------------------------------------------------
+class CProfiledIVRChaperone final : public vr::IVRChaperone
+{
+public:
+	explicit CProfiledIVRChaperone( vr::IVRChaperone *pReal ) : m_pReal( pReal ) {}
+
+	virtual vr::ChaperoneCalibrationState GetCalibrationState() override
+	{
+		CProfiledCall call( 69 );
+		call.Begin();
+		vr::ChaperoneCalibrationState result = m_pReal->GetCalibrationState();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool GetPlayAreaSize( float *pSizeX, float *pSizeZ ) override
+	{
+		CProfiledCall call( 70 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pSizeX ? 1 : 0 );
+			pCapture->WriteVarint( pSizeZ ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetPlayAreaSize( pSizeX, pSizeZ );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pSizeX, 1 );
+			pCapture->WriteArray( pSizeZ, 1 );
+		}
+		return result;
+	}
+
+	virtual bool GetPlayAreaRect( struct vr::HmdQuad_t *rect ) override
+	{
+		CProfiledCall call( 71 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( rect ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetPlayAreaRect( rect );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( rect, 1 );
+		}
+		return result;
+	}
+
+	virtual void ReloadInfo() override
+	{
+		CProfiledCall call( 72 );
+		call.Begin();
+		m_pReal->ReloadInfo();
+		call.End();
+	}
+
+	virtual void SetSceneColor( struct vr::HmdColor_t color ) override
+	{
+		CProfiledCall call( 73 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( color );
+		}
+		call.Begin();
+		m_pReal->SetSceneColor( color );
+		call.End();
+	}
+
+	virtual void GetBoundsColor( struct vr::HmdColor_t *pOutputColorArray, int nNumOutputColors, float flCollisionBoundsFadeDistance, struct vr::HmdColor_t *pOutputCameraColor ) override
+	{
+		CProfiledCall call( 74 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pOutputColorArray ? 1 : 0 );
+			pCapture->WriteValue( nNumOutputColors );
+			pCapture->WriteValue( flCollisionBoundsFadeDistance );
+			pCapture->WriteVarint( pOutputCameraColor ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->GetBoundsColor( pOutputColorArray, nNumOutputColors, flCollisionBoundsFadeDistance, pOutputCameraColor );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pOutputColorArray, (uint32_t)nNumOutputColors );
+			pCapture->WriteArray( pOutputCameraColor, 1 );
+		}
+	}
+
+	virtual bool AreBoundsVisible() override
+	{
+		CProfiledCall call( 75 );
+		call.Begin();
+		bool result = m_pReal->AreBoundsVisible();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual void ForceBoundsVisible( bool bForce ) override
+	{
+		CProfiledCall call( 76 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( bForce );
+		}
+		call.Begin();
+		m_pReal->ForceBoundsVisible( bForce );
+		call.End();
+	}
+
+private:
+	vr::IVRChaperone *m_pReal;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles every call to vr::IVRChaperoneSetup
+//-----------------------------------------------------------------------------
+class CProfiledIVRChaperoneSetup final : public vr::IVRChaperoneSetup
+{
+public:
+	explicit CProfiledIVRChaperoneSetup( vr::IVRChaperoneSetup *pReal ) : m_pReal( pReal ) {}
+
+	virtual bool CommitWorkingCopy( vr::EChaperoneConfigFile configFile ) override
+	{
+		CProfiledCall call( 77 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( configFile );
+		}
+		call.Begin();
+		bool result = m_pReal->CommitWorkingCopy( configFile );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual void RevertWorkingCopy() override
+	{
+		CProfiledCall call( 78 );
+		call.Begin();
+		m_pReal->RevertWorkingCopy();
+		call.End();
+	}
+
+	virtual bool GetWorkingPlayAreaSize( float *pSizeX, float *pSizeZ ) override
+	{
+		CProfiledCall call( 79 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pSizeX ? 1 : 0 );
+			pCapture->WriteVarint( pSizeZ ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetWorkingPlayAreaSize( pSizeX, pSizeZ );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pSizeX, 1 );
+			pCapture->WriteArray( pSizeZ, 1 );
+		}
+		return result;
+	}
+
+	virtual bool GetWorkingPlayAreaRect( struct vr::HmdQuad_t *rect ) override
+	{
+		CProfiledCall call( 80 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( rect ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetWorkingPlayAreaRect( rect );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( rect, 1 );
+		}
+		return result;
+	}
+
+	virtual bool GetWorkingCollisionBoundsInfo( struct vr::HmdQuad_t *pQuadsBuffer, uint32_t *punQuadsCount ) override
+	{
+		CProfiledCall call( 81 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pQuadsBuffer ? 1 : 0 );
+			pCapture->WriteArray( punQuadsCount, 1 );
+		}
+		const uint32_t unQuadsBufferCapacity = punQuadsCount ? *punQuadsCount : 0;
+		call.Begin();
+		bool result = m_pReal->GetWorkingCollisionBoundsInfo( pQuadsBuffer, punQuadsCount );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pQuadsBuffer, punQuadsCount ? std::min( *punQuadsCount, unQuadsBufferCapacity ) : 0 );
+			pCapture->WriteArray( punQuadsCount, 1 );
+		}
+		return result;
+	}
+
+	virtual bool GetLiveCollisionBoundsInfo( struct vr::HmdQuad_t *pQuadsBuffer, uint32_t *punQuadsCount ) override
+	{
+		CProfiledCall call( 82 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pQuadsBuffer ? 1 : 0 );
+			pCapture->WriteArray( punQuadsCount, 1 );
+		}
+		const uint32_t unQuadsBufferCapacity = punQuadsCount ? *punQuadsCount : 0;
+		call.Begin();
+		bool result = m_pReal->GetLiveCollisionBoundsInfo( pQuadsBuffer, punQuadsCount );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pQuadsBuffer, punQuadsCount ? std::min( *punQuadsCount, unQuadsBufferCapacity ) : 0 );
+			pCapture->WriteArray( punQuadsCount, 1 );
+		}
+		return result;
+	}
+
+	virtual bool GetWorkingSeatedZeroPoseToRawTrackingPose( struct vr::HmdMatrix34_t *pmatSeatedZeroPoseToRawTrackingPose ) override
+	{
+		CProfiledCall call( 83 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pmatSeatedZeroPoseToRawTrackingPose ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetWorkingSeatedZeroPoseToRawTrackingPose( pmatSeatedZeroPoseToRawTrackingPose );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pmatSeatedZeroPoseToRawTrackingPose, 1 );
+		}
+		return result;
+	}
+
+	virtual bool GetWorkingStandingZeroPoseToRawTrackingPose( struct vr::HmdMatrix34_t *pmatStandingZeroPoseToRawTrackingPose ) override
+	{
+		CProfiledCall call( 84 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pmatStandingZeroPoseToRawTrackingPose ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetWorkingStandingZeroPoseToRawTrackingPose( pmatStandingZeroPoseToRawTrackingPose );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pmatStandingZeroPoseToRawTrackingPose, 1 );
+		}
+		return result;
+	}
+
+	virtual void SetWorkingPlayAreaSize( float sizeX, float sizeZ ) override
+	{
+		CProfiledCall call( 85 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( sizeX );
+			pCapture->WriteValue( sizeZ );
+		}
+		call.Begin();
+		m_pReal->SetWorkingPlayAreaSize( sizeX, sizeZ );
+		call.End();
+	}
+
+	virtual void SetWorkingCollisionBoundsInfo( struct vr::HmdQuad_t *pQuadsBuffer, uint32_t unQuadsCount ) override
+	{
+		CProfiledCall call( 86 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pQuadsBuffer, (uint32_t)unQuadsCount );
+			pCapture->WriteValue( unQuadsCount );
+		}
+		call.Begin();
+		m_pReal->SetWorkingCollisionBoundsInfo( pQuadsBuffer, unQuadsCount );
+		call.End();
+	}
+
+	virtual void SetWorkingSeatedZeroPoseToRawTrackingPose( const struct vr::HmdMatrix34_t *pMatSeatedZeroPoseToRawTrackingPose ) override
+	{
+		CProfiledCall call( 87 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pMatSeatedZeroPoseToRawTrackingPose, 1 );
+		}
+		call.Begin();
+		m_pReal->SetWorkingSeatedZeroPoseToRawTrackingPose( pMatSeatedZeroPoseToRawTrackingPose );
+		call.End();
+	}
+
+	virtual void SetWorkingStandingZeroPoseToRawTrackingPose( const struct vr::HmdMatrix34_t *pMatStandingZeroPoseToRawTrackingPose ) override
+	{
+		CProfiledCall call( 88 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pMatStandingZeroPoseToRawTrackingPose, 1 );
+		}
+		call.Begin();
+		m_pReal->SetWorkingStandingZeroPoseToRawTrackingPose( pMatStandingZeroPoseToRawTrackingPose );
+		call.End();
+	}
+
+	virtual void ReloadFromDisk( vr::EChaperoneConfigFile configFile ) override
+	{
+		CProfiledCall call( 89 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( configFile );
+		}
+		call.Begin();
+		m_pReal->ReloadFromDisk( configFile );
+		call.End();
+	}
+
+	virtual bool GetLiveSeatedZeroPoseToRawTrackingPose( struct vr::HmdMatrix34_t *pmatSeatedZeroPoseToRawTrackingPose ) override
+	{
+		CProfiledCall call( 90 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pmatSeatedZeroPoseToRawTrackingPose ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetLiveSeatedZeroPoseToRawTrackingPose( pmatSeatedZeroPoseToRawTrackingPose );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pmatSeatedZeroPoseToRawTrackingPose, 1 );
+		}
+		return result;
+	}
+
+	virtual void SetWorkingWallTagInfo( uint8_t *pTagsBuffer, uint32_t unTagCount ) override
+	{
+		CProfiledCall call( 91 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( pTagsBuffer, (uint32_t)unTagCount );
+			pCapture->WriteValue( unTagCount );
+		}
+		call.Begin();
+		m_pReal->SetWorkingWallTagInfo( pTagsBuffer, unTagCount );
+		call.End();
+	}
+
+	virtual bool GetLiveWallTagInfo( uint8_t *pTagsBuffer, uint32_t *punTagCount ) override
+	{
+		CProfiledCall call( 92 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pTagsBuffer ? 1 : 0 );
+			pCapture->WriteArray( punTagCount, 1 );
+		}
+		const uint32_t unTagsBufferCapacity = punTagCount ? *punTagCount : 0;
+		call.Begin();
+		bool result = m_pReal->GetLiveWallTagInfo( pTagsBuffer, punTagCount );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pTagsBuffer, punTagCount ? std::min( *punTagCount, unTagsBufferCapacity ) : 0 );
+			pCapture->WriteArray( punTagCount, 1 );
+		}
+		return result;
+	}
+
+private:
+	vr::IVRChaperoneSetup *m_pReal;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles every call to vr::IVRCompositor
+//-----------------------------------------------------------------------------
+class CProfiledIVRCompositor final : public vr::IVRCompositor
+{
+public:
+	explicit CProfiledIVRCompositor( vr::IVRCompositor *pReal ) : m_pReal( pReal ) {}
+
+	virtual void SetTrackingSpace( vr::ETrackingUniverseOrigin eOrigin ) override
+	{
+		CProfiledCall call( 93 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eOrigin );
+		}
+		call.Begin();
+		m_pReal->SetTrackingSpace( eOrigin );
+		call.End();
+	}
+
+	virtual vr::ETrackingUniverseOrigin GetTrackingSpace() override
+	{
+		CProfiledCall call( 94 );
+		call.Begin();
+		vr::ETrackingUniverseOrigin result = m_pReal->GetTrackingSpace();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVRCompositorError WaitGetPoses( struct vr::TrackedDevicePose_t *pRenderPoseArray, uint32_t unRenderPoseArrayCount, struct vr::TrackedDevicePose_t *pGamePoseArray, uint32_t unGamePoseArrayCount ) override
+	{
+		CProfiledCall call( 95 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pRenderPoseArray ? 1 : 0 );
+			pCapture->WriteValue( unRenderPoseArrayCount );
+			pCapture->WriteVarint( pGamePoseArray ? 1 : 0 );
+			pCapture->WriteValue( unGamePoseArrayCount );
+		}
+		call.Begin();
+		vr::EVRCompositorError result = m_pReal->WaitGetPoses( pRenderPoseArray, unRenderPoseArrayCount, pGamePoseArray, unGamePoseArrayCount );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pRenderPoseArray, (uint32_t)unRenderPoseArrayCount );
+			pCapture->WriteArray( pGamePoseArray, (uint32_t)unGamePoseArrayCount );
+		}
+		return result;
+	}
+
+	virtual vr::EVRCompositorError GetLastPoses( struct vr::TrackedDevicePose_t *pRenderPoseArray, uint32_t unRenderPoseArrayCount, struct vr::TrackedDevicePose_t *pGamePoseArray, uint32_t unGamePoseArrayCount ) override
+	{
+		CProfiledCall call( 96 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pRenderPoseArray ? 1 : 0 );
+			pCapture->WriteValue( unRenderPoseArrayCount );
+			pCapture->WriteVarint( pGamePoseArray ? 1 : 0 );
+			pCapture->WriteValue( unGamePoseArrayCount );
+		}
+		call.Begin();
+		vr::EVRCompositorError result = m_pReal->GetLastPoses( pRenderPoseArray, unRenderPoseArrayCount, pGamePoseArray, unGamePoseArrayCount );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pRenderPoseArray, (uint32_t)unRenderPoseArrayCount );
+			pCapture->WriteArray( pGamePoseArray, (uint32_t)unGamePoseArrayCount );
+		}
+		return result;
+	}
+
+	virtual vr::EVRCompositorError Submit( vr::EVREye eEye, const struct vr::Texture_t *pTexture, const struct vr::VRTextureBounds_t *pBounds, vr::EVRSubmitFlags nSubmitFlags ) override
+	{
+		CProfiledCall call( 97 );
+		call.Begin();
+		vr::EVRCompositorError result = m_pReal->Submit( eEye, pTexture, pBounds, nSubmitFlags );
+		call.End();
+		return result;
+	}
+
+	virtual void ClearLastSubmittedFrame() override
+	{
+		CProfiledCall call( 98 );
+		call.Begin();
+		m_pReal->ClearLastSubmittedFrame();
+		call.End();
+	}
+
+	virtual void PostPresentHandoff() override
+	{
+		CProfiledCall call( 99 );
+		call.Begin();
+		m_pReal->PostPresentHandoff();
+		call.End();
+	}
+
+	virtual bool GetFrameTiming( struct vr::Compositor_FrameTiming *pTiming, uint32_t unFramesAgo ) override
+	{
+		CProfiledCall call( 100 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pTiming ? 1 : 0 );
+			pCapture->WriteValue( unFramesAgo );
+		}
+		call.Begin();
+		bool result = m_pReal->GetFrameTiming( pTiming, unFramesAgo );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pTiming, 1 );
+		}
+		return result;
+	}
+
+	virtual float GetFrameTimeRemaining() override
+	{
+		CProfiledCall call( 101 );
+		call.Begin();
+		float result = m_pReal->GetFrameTimeRemaining();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual void FadeToColor( float fSeconds, float fRed, float fGreen, float fBlue, float fAlpha, bool bBackground ) override
+	{
+		CProfiledCall call( 102 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( fSeconds );
+			pCapture->WriteValue( fRed );
+			pCapture->WriteValue( fGreen );
+			pCapture->WriteValue( fBlue );
+			pCapture->WriteValue( fAlpha );
+			pCapture->WriteValue( bBackground );
+		}
+		call.Begin();
+		m_pReal->FadeToColor( fSeconds, fRed, fGreen, fBlue, fAlpha, bBackground );
+		call.End();
+	}
+
+	virtual void FadeGrid( float fSeconds, bool bFadeIn ) override
+	{
+		CProfiledCall call( 103 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( fSeconds );
+			pCapture->WriteValue( bFadeIn );
+		}
+		call.Begin();
+		m_pReal->FadeGrid( fSeconds, bFadeIn );
+		call.End();
+	}
+
+	virtual vr::EVRCompositorError SetSkyboxOverride( const struct vr::Texture_t *pTextures, uint32_t unTextureCount ) override
+	{
+		CProfiledCall call( 104 );
+		call.Begin();
+		vr::EVRCompositorError result = m_pReal->SetSkyboxOverride( pTextures, unTextureCount );
+		call.End();
+		return result;
+	}
+
+	virtual void ClearSkyboxOverride() override
+	{
+		CProfiledCall call( 105 );
+		call.Begin();
+		m_pReal->ClearSkyboxOverride();
+		call.End();
+	}
+
+	virtual void CompositorBringToFront() override
+	{
+		CProfiledCall call( 106 );
+		call.Begin();
+		m_pReal->CompositorBringToFront();
+		call.End();
+	}
+
+	virtual void CompositorGoToBack() override
+	{
+		CProfiledCall call( 107 );
+		call.Begin();
+		m_pReal->CompositorGoToBack();
+		call.End();
+	}
+
+	virtual void CompositorQuit() override
+	{
+		CProfiledCall call( 108 );
+		call.Begin();
+		m_pReal->CompositorQuit();
+		call.End();
+	}
+
+	virtual bool IsFullscreen() override
+	{
+		CProfiledCall call( 109 );
+		call.Begin();
+		bool result = m_pReal->IsFullscreen();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetCurrentSceneFocusProcess() override
+	{
+		CProfiledCall call( 110 );
+		call.Begin();
+		uint32_t result = m_pReal->GetCurrentSceneFocusProcess();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetLastFrameRenderer() override
+	{
+		CProfiledCall call( 111 );
+		call.Begin();
+		uint32_t result = m_pReal->GetLastFrameRenderer();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool CanRenderScene() override
+	{
+		CProfiledCall call( 112 );
+		call.Begin();
+		bool result = m_pReal->CanRenderScene();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual void ShowMirrorWindow() override
+	{
+		CProfiledCall call( 113 );
+		call.Begin();
+		m_pReal->ShowMirrorWindow();
+		call.End();
+	}
+
+	virtual void HideMirrorWindow() override
+	{
+		CProfiledCall call( 114 );
+		call.Begin();
+		m_pReal->HideMirrorWindow();
+		call.End();
+	}
+
+	virtual bool IsMirrorWindowVisible() override
+	{
+		CProfiledCall call( 115 );
+		call.Begin();
+		bool result = m_pReal->IsMirrorWindowVisible();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual void CompositorDumpImages() override
+	{
+		CProfiledCall call( 116 );
+		call.Begin();
+		m_pReal->CompositorDumpImages();
+		call.End();
+	}
+
+private:
+	vr::IVRCompositor *m_pReal;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles every call to vr::IVROverlay
+//-----------------------------------------------------------------------------
+class CProfiledIVROverlay final : public vr::IVROverlay
+{
+public:
+	explicit CProfiledIVROverlay( vr::IVROverlay *pReal ) : m_pReal( pReal ) {}
+
+	virtual vr::EVROverlayError FindOverlay( const char *pchOverlayKey, vr::VROverlayHandle_t *pOverlayHandle ) override
+	{
+		CProfiledCall call( 117 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchOverlayKey );
+			pCapture->WriteVarint( pOverlayHandle ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->FindOverlay( pchOverlayKey, pOverlayHandle );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pOverlayHandle, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError CreateOverlay( const char *pchOverlayKey, const char *pchOverlayFriendlyName, vr::VROverlayHandle_t *pOverlayHandle ) override
+	{
+		CProfiledCall call( 118 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchOverlayKey );
+			pCapture->WriteString( pchOverlayFriendlyName );
+			pCapture->WriteVarint( pOverlayHandle ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->CreateOverlay( pchOverlayKey, pchOverlayFriendlyName, pOverlayHandle );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pOverlayHandle, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError DestroyOverlay( vr::VROverlayHandle_t ulOverlayHandle ) override
+	{
+		CProfiledCall call( 119 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->DestroyOverlay( ulOverlayHandle );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetHighQualityOverlay( vr::VROverlayHandle_t ulOverlayHandle ) override
+	{
+		CProfiledCall call( 120 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetHighQualityOverlay( ulOverlayHandle );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::VROverlayHandle_t GetHighQualityOverlay() override
+	{
+		CProfiledCall call( 121 );
+		call.Begin();
+		vr::VROverlayHandle_t result = m_pReal->GetHighQualityOverlay();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetOverlayKey( vr::VROverlayHandle_t ulOverlayHandle, char *pchValue, uint32_t unBufferSize, vr::EVROverlayError *pError ) override
+	{
+		CProfiledCall call( 122 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( pchValue ? 1 : 0 );
+			pCapture->WriteValue( unBufferSize );
+			pCapture->WriteVarint( pError ? 1 : 0 );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->GetOverlayKey( ulOverlayHandle, pchValue, unBufferSize, pError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchValue, unBufferSize );
+			pCapture->WriteArray( pError, 1 );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetOverlayName( vr::VROverlayHandle_t ulOverlayHandle, char *pchValue, uint32_t unBufferSize, vr::EVROverlayError *pError ) override
+	{
+		CProfiledCall call( 123 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( pchValue ? 1 : 0 );
+			pCapture->WriteValue( unBufferSize );
+			pCapture->WriteVarint( pError ? 1 : 0 );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->GetOverlayName( ulOverlayHandle, pchValue, unBufferSize, pError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchValue, unBufferSize );
+			pCapture->WriteArray( pError, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayImageData( vr::VROverlayHandle_t ulOverlayHandle, void *pvBuffer, uint32_t unBufferSize, uint32_t *punWidth, uint32_t *punHeight ) override
+	{
+		CProfiledCall call( 124 );
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayImageData( ulOverlayHandle, pvBuffer, unBufferSize, punWidth, punHeight );
+		call.End();
+		return result;
+	}
+
+	virtual const char * GetOverlayErrorNameFromEnum( vr::EVROverlayError error ) override
+	{
+		CProfiledCall call( 125 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( error );
+		}
+		call.Begin();
+		const char * result = m_pReal->GetOverlayErrorNameFromEnum( error );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayFlag( vr::VROverlayHandle_t ulOverlayHandle, vr::VROverlayFlags eOverlayFlag, bool bEnabled ) override
+	{
+		CProfiledCall call( 126 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( eOverlayFlag );
+			pCapture->WriteValue( bEnabled );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayFlag( ulOverlayHandle, eOverlayFlag, bEnabled );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayFlag( vr::VROverlayHandle_t ulOverlayHandle, vr::VROverlayFlags eOverlayFlag, bool *pbEnabled ) override
+	{
+		CProfiledCall call( 127 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( eOverlayFlag );
+			pCapture->WriteVarint( pbEnabled ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayFlag( ulOverlayHandle, eOverlayFlag, pbEnabled );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pbEnabled, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayColor( vr::VROverlayHandle_t ulOverlayHandle, float fRed, float fGreen, float fBlue ) override
+	{
+		CProfiledCall call( 128 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( fRed );
+			pCapture->WriteValue( fGreen );
+			pCapture->WriteValue( fBlue );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayColor( ulOverlayHandle, fRed, fGreen, fBlue );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayColor( vr::VROverlayHandle_t ulOverlayHandle, float *pfRed, float *pfGreen, float *pfBlue ) override
+	{
+		CProfiledCall call( 129 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( pfRed ? 1 : 0 );
+			pCapture->WriteVarint( pfGreen ? 1 : 0 );
+			pCapture->WriteVarint( pfBlue ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayColor( ulOverlayHandle, pfRed, pfGreen, pfBlue );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pfRed, 1 );
+			pCapture->WriteArray( pfGreen, 1 );
+			pCapture->WriteArray( pfBlue, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayAlpha( vr::VROverlayHandle_t ulOverlayHandle, float fAlpha ) override
+	{
+		CProfiledCall call( 130 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( fAlpha );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayAlpha( ulOverlayHandle, fAlpha );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayAlpha( vr::VROverlayHandle_t ulOverlayHandle, float *pfAlpha ) override
+	{
+		CProfiledCall call( 131 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( pfAlpha ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayAlpha( ulOverlayHandle, pfAlpha );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pfAlpha, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayWidthInMeters( vr::VROverlayHandle_t ulOverlayHandle, float fWidthInMeters ) override
+	{
+		CProfiledCall call( 132 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( fWidthInMeters );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayWidthInMeters( ulOverlayHandle, fWidthInMeters );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayWidthInMeters( vr::VROverlayHandle_t ulOverlayHandle, float *pfWidthInMeters ) override
+	{
+		CProfiledCall call( 133 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( pfWidthInMeters ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayWidthInMeters( ulOverlayHandle, pfWidthInMeters );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pfWidthInMeters, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayAutoCurveDistanceRangeInMeters( vr::VROverlayHandle_t ulOverlayHandle, float fMinDistanceInMeters, float fMaxDistanceInMeters ) override
+	{
+		CProfiledCall call( 134 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( fMinDistanceInMeters );
+			pCapture->WriteValue( fMaxDistanceInMeters );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayAutoCurveDistanceRangeInMeters( ulOverlayHandle, fMinDistanceInMeters, fMaxDistanceInMeters );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayAutoCurveDistanceRangeInMeters( vr::VROverlayHandle_t ulOverlayHandle, float *pfMinDistanceInMeters, float *pfMaxDistanceInMeters ) override
+	{
+		CProfiledCall call( 135 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( pfMinDistanceInMeters ? 1 : 0 );
+			pCapture->WriteVarint( pfMaxDistanceInMeters ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayAutoCurveDistanceRangeInMeters( ulOverlayHandle, pfMinDistanceInMeters, pfMaxDistanceInMeters );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pfMinDistanceInMeters, 1 );
+			pCapture->WriteArray( pfMaxDistanceInMeters, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayTextureColorSpace( vr::VROverlayHandle_t ulOverlayHandle, vr::EColorSpace eTextureColorSpace ) override
+	{
+		CProfiledCall call( 136 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( eTextureColorSpace );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayTextureColorSpace( ulOverlayHandle, eTextureColorSpace );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayTextureColorSpace( vr::VROverlayHandle_t ulOverlayHandle, vr::EColorSpace *peTextureColorSpace ) override
+	{
+		CProfiledCall call( 137 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( peTextureColorSpace ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayTextureColorSpace( ulOverlayHandle, peTextureColorSpace );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( peTextureColorSpace, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayTextureBounds( vr::VROverlayHandle_t ulOverlayHandle, const struct vr::VRTextureBounds_t *pOverlayTextureBounds ) override
+	{
+		CProfiledCall call( 138 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteArray( pOverlayTextureBounds, 1 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayTextureBounds( ulOverlayHandle, pOverlayTextureBounds );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayTextureBounds( vr::VROverlayHandle_t ulOverlayHandle, struct vr::VRTextureBounds_t *pOverlayTextureBounds ) override
+	{
+		CProfiledCall call( 139 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( pOverlayTextureBounds ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayTextureBounds( ulOverlayHandle, pOverlayTextureBounds );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pOverlayTextureBounds, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayTransformType( vr::VROverlayHandle_t ulOverlayHandle, vr::VROverlayTransformType *peTransformType ) override
+	{
+		CProfiledCall call( 140 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( peTransformType ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayTransformType( ulOverlayHandle, peTransformType );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( peTransformType, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayTransformAbsolute( vr::VROverlayHandle_t ulOverlayHandle, vr::ETrackingUniverseOrigin eTrackingOrigin, const struct vr::HmdMatrix34_t *pmatTrackingOriginToOverlayTransform ) override
+	{
+		CProfiledCall call( 141 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( eTrackingOrigin );
+			pCapture->WriteArray( pmatTrackingOriginToOverlayTransform, 1 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayTransformAbsolute( ulOverlayHandle, eTrackingOrigin, pmatTrackingOriginToOverlayTransform );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayTransformAbsolute( vr::VROverlayHandle_t ulOverlayHandle, vr::ETrackingUniverseOrigin *peTrackingOrigin, struct vr::HmdMatrix34_t *pmatTrackingOriginToOverlayTransform ) override
+	{
+		CProfiledCall call( 142 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( peTrackingOrigin ? 1 : 0 );
+			pCapture->WriteVarint( pmatTrackingOriginToOverlayTransform ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayTransformAbsolute( ulOverlayHandle, peTrackingOrigin, pmatTrackingOriginToOverlayTransform );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( peTrackingOrigin, 1 );
+			pCapture->WriteArray( pmatTrackingOriginToOverlayTransform, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayTransformTrackedDeviceRelative( vr::VROverlayHandle_t ulOverlayHandle, vr::TrackedDeviceIndex_t unTrackedDevice, const struct vr::HmdMatrix34_t *pmatTrackedDeviceToOverlayTransform ) override
+	{
+		CProfiledCall call( 143 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( unTrackedDevice );
+			pCapture->WriteArray( pmatTrackedDeviceToOverlayTransform, 1 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayTransformTrackedDeviceRelative( ulOverlayHandle, unTrackedDevice, pmatTrackedDeviceToOverlayTransform );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayTransformTrackedDeviceRelative( vr::VROverlayHandle_t ulOverlayHandle, vr::TrackedDeviceIndex_t *punTrackedDevice, struct vr::HmdMatrix34_t *pmatTrackedDeviceToOverlayTransform ) override
+	{
+		CProfiledCall call( 144 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( punTrackedDevice ? 1 : 0 );
+			pCapture->WriteVarint( pmatTrackedDeviceToOverlayTransform ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayTransformTrackedDeviceRelative( ulOverlayHandle, punTrackedDevice, pmatTrackedDeviceToOverlayTransform );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( punTrackedDevice, 1 );
+			pCapture->WriteArray( pmatTrackedDeviceToOverlayTransform, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError ShowOverlay( vr::VROverlayHandle_t ulOverlayHandle ) override
+	{
+		CProfiledCall call( 145 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->ShowOverlay( ulOverlayHandle );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError HideOverlay( vr::VROverlayHandle_t ulOverlayHandle ) override
+	{
+		CProfiledCall call( 146 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->HideOverlay( ulOverlayHandle );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool IsOverlayVisible( vr::VROverlayHandle_t ulOverlayHandle ) override
+	{
+		CProfiledCall call( 147 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+		}
+		call.Begin();
+		bool result = m_pReal->IsOverlayVisible( ulOverlayHandle );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetTransformForOverlayCoordinates( vr::VROverlayHandle_t ulOverlayHandle, vr::ETrackingUniverseOrigin eTrackingOrigin, struct vr::HmdVector2_t coordinatesInOverlay, struct vr::HmdMatrix34_t *pmatTransform ) override
+	{
+		CProfiledCall call( 148 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( eTrackingOrigin );
+			pCapture->WriteValue( coordinatesInOverlay );
+			pCapture->WriteVarint( pmatTransform ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetTransformForOverlayCoordinates( ulOverlayHandle, eTrackingOrigin, coordinatesInOverlay, pmatTransform );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pmatTransform, 1 );
+		}
+		return result;
+	}
+
+	virtual bool PollNextOverlayEvent( vr::VROverlayHandle_t ulOverlayHandle, struct vr::VREvent_t *pEvent ) override
+	{
+		CProfiledCall call( 149 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( pEvent ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->PollNextOverlayEvent( ulOverlayHandle, pEvent );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pEvent, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayInputMethod( vr::VROverlayHandle_t ulOverlayHandle, vr::VROverlayInputMethod *peInputMethod ) override
+	{
+		CProfiledCall call( 150 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( peInputMethod ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayInputMethod( ulOverlayHandle, peInputMethod );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( peInputMethod, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayInputMethod( vr::VROverlayHandle_t ulOverlayHandle, vr::VROverlayInputMethod eInputMethod ) override
+	{
+		CProfiledCall call( 151 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( eInputMethod );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayInputMethod( ulOverlayHandle, eInputMethod );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetOverlayMouseScale( vr::VROverlayHandle_t ulOverlayHandle, struct vr::HmdVector2_t *pvecMouseScale ) override
+	{
+		CProfiledCall call( 152 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( pvecMouseScale ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetOverlayMouseScale( ulOverlayHandle, pvecMouseScale );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pvecMouseScale, 1 );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayMouseScale( vr::VROverlayHandle_t ulOverlayHandle, const struct vr::HmdVector2_t *pvecMouseScale ) override
+	{
+		CProfiledCall call( 153 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteArray( pvecMouseScale, 1 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayMouseScale( ulOverlayHandle, pvecMouseScale );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool ComputeOverlayIntersection( vr::VROverlayHandle_t ulOverlayHandle, const struct vr::VROverlayIntersectionParams_t *pParams, struct vr::VROverlayIntersectionResults_t *pResults ) override
+	{
+		CProfiledCall call( 154 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteArray( pParams, 1 );
+			pCapture->WriteVarint( pResults ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->ComputeOverlayIntersection( ulOverlayHandle, pParams, pResults );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pResults, 1 );
+		}
+		return result;
+	}
+
+	virtual bool HandleControllerOverlayInteractionAsMouse( vr::VROverlayHandle_t ulOverlayHandle, vr::TrackedDeviceIndex_t unControllerDeviceIndex ) override
+	{
+		CProfiledCall call( 155 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( unControllerDeviceIndex );
+		}
+		call.Begin();
+		bool result = m_pReal->HandleControllerOverlayInteractionAsMouse( ulOverlayHandle, unControllerDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool IsHoverTargetOverlay( vr::VROverlayHandle_t ulOverlayHandle ) override
+	{
+		CProfiledCall call( 156 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+		}
+		call.Begin();
+		bool result = m_pReal->IsHoverTargetOverlay( ulOverlayHandle );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::VROverlayHandle_t GetGamepadFocusOverlay() override
+	{
+		CProfiledCall call( 157 );
+		call.Begin();
+		vr::VROverlayHandle_t result = m_pReal->GetGamepadFocusOverlay();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetGamepadFocusOverlay( vr::VROverlayHandle_t ulNewFocusOverlay ) override
+	{
+		CProfiledCall call( 158 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulNewFocusOverlay );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetGamepadFocusOverlay( ulNewFocusOverlay );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayNeighbor( vr::EOverlayDirection eDirection, vr::VROverlayHandle_t ulFrom, vr::VROverlayHandle_t ulTo ) override
+	{
+		CProfiledCall call( 159 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eDirection );
+			pCapture->WriteValue( ulFrom );
+			pCapture->WriteValue( ulTo );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayNeighbor( eDirection, ulFrom, ulTo );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError MoveGamepadFocusToNeighbor( vr::EOverlayDirection eDirection, vr::VROverlayHandle_t ulFrom ) override
+	{
+		CProfiledCall call( 160 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eDirection );
+			pCapture->WriteValue( ulFrom );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->MoveGamepadFocusToNeighbor( eDirection, ulFrom );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayTexture( vr::VROverlayHandle_t ulOverlayHandle, const struct vr::Texture_t *pTexture ) override
+	{
+		CProfiledCall call( 161 );
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayTexture( ulOverlayHandle, pTexture );
+		call.End();
+		return result;
+	}
+
+	virtual vr::EVROverlayError ClearOverlayTexture( vr::VROverlayHandle_t ulOverlayHandle ) override
+	{
+		CProfiledCall call( 162 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->ClearOverlayTexture( ulOverlayHandle );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayRaw( vr::VROverlayHandle_t ulOverlayHandle, void *pvBuffer, uint32_t unWidth, uint32_t unHeight, uint32_t unDepth ) override
+	{
+		CProfiledCall call( 163 );
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayRaw( ulOverlayHandle, pvBuffer, unWidth, unHeight, unDepth );
+		call.End();
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetOverlayFromFile( vr::VROverlayHandle_t ulOverlayHandle, const char *pchFilePath ) override
+	{
+		CProfiledCall call( 164 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteString( pchFilePath );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetOverlayFromFile( ulOverlayHandle, pchFilePath );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError CreateDashboardOverlay( const char *pchOverlayKey, const char *pchOverlayFriendlyName, vr::VROverlayHandle_t *pMainHandle, vr::VROverlayHandle_t *pThumbnailHandle ) override
+	{
+		CProfiledCall call( 165 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchOverlayKey );
+			pCapture->WriteString( pchOverlayFriendlyName );
+			pCapture->WriteVarint( pMainHandle ? 1 : 0 );
+			pCapture->WriteVarint( pThumbnailHandle ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->CreateDashboardOverlay( pchOverlayKey, pchOverlayFriendlyName, pMainHandle, pThumbnailHandle );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pMainHandle, 1 );
+			pCapture->WriteArray( pThumbnailHandle, 1 );
+		}
+		return result;
+	}
+
+	virtual bool IsDashboardVisible() override
+	{
+		CProfiledCall call( 166 );
+		call.Begin();
+		bool result = m_pReal->IsDashboardVisible();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool IsActiveDashboardOverlay( vr::VROverlayHandle_t ulOverlayHandle ) override
+	{
+		CProfiledCall call( 167 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+		}
+		call.Begin();
+		bool result = m_pReal->IsActiveDashboardOverlay( ulOverlayHandle );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError SetDashboardOverlaySceneProcess( vr::VROverlayHandle_t ulOverlayHandle, uint32_t unProcessId ) override
+	{
+		CProfiledCall call( 168 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( unProcessId );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->SetDashboardOverlaySceneProcess( ulOverlayHandle, unProcessId );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError GetDashboardOverlaySceneProcess( vr::VROverlayHandle_t ulOverlayHandle, uint32_t *punProcessId ) override
+	{
+		CProfiledCall call( 169 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteVarint( punProcessId ? 1 : 0 );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->GetDashboardOverlaySceneProcess( ulOverlayHandle, punProcessId );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( punProcessId, 1 );
+		}
+		return result;
+	}
+
+	virtual void ShowDashboard( const char *pchOverlayToShow ) override
+	{
+		CProfiledCall call( 170 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchOverlayToShow );
+		}
+		call.Begin();
+		m_pReal->ShowDashboard( pchOverlayToShow );
+		call.End();
+	}
+
+	virtual vr::EVROverlayError ShowKeyboard( vr::EGamepadTextInputMode eInputMode, vr::EGamepadTextInputLineMode eLineInputMode, const char *pchDescription, uint32_t unCharMax, const char *pchExistingText, bool bUseMinimalMode, uint64_t uUserValue ) override
+	{
+		CProfiledCall call( 171 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eInputMode );
+			pCapture->WriteValue( eLineInputMode );
+			pCapture->WriteString( pchDescription );
+			pCapture->WriteValue( unCharMax );
+			pCapture->WriteString( pchExistingText );
+			pCapture->WriteValue( bUseMinimalMode );
+			pCapture->WriteValue( uUserValue );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->ShowKeyboard( eInputMode, eLineInputMode, pchDescription, unCharMax, pchExistingText, bUseMinimalMode, uUserValue );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::EVROverlayError ShowKeyboardForOverlay( vr::VROverlayHandle_t ulOverlayHandle, vr::EGamepadTextInputMode eInputMode, vr::EGamepadTextInputLineMode eLineInputMode, const char *pchDescription, uint32_t unCharMax, const char *pchExistingText, bool bUseMinimalMode, uint64_t uUserValue ) override
+	{
+		CProfiledCall call( 172 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( eInputMode );
+			pCapture->WriteValue( eLineInputMode );
+			pCapture->WriteString( pchDescription );
+			pCapture->WriteValue( unCharMax );
+			pCapture->WriteString( pchExistingText );
+			pCapture->WriteValue( bUseMinimalMode );
+			pCapture->WriteValue( uUserValue );
+		}
+		call.Begin();
+		vr::EVROverlayError result = m_pReal->ShowKeyboardForOverlay( ulOverlayHandle, eInputMode, eLineInputMode, pchDescription, unCharMax, pchExistingText, bUseMinimalMode, uUserValue );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetKeyboardText( char *pchText, uint32_t cchText ) override
+	{
+		CProfiledCall call( 173 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( pchText ? 1 : 0 );
+			pCapture->WriteValue( cchText );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->GetKeyboardText( pchText, cchText );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchText, cchText );
+		}
+		return result;
+	}
+
+	virtual void HideKeyboard() override
+	{
+		CProfiledCall call( 174 );
+		call.Begin();
+		m_pReal->HideKeyboard();
+		call.End();
+	}
+
+	virtual void SetKeyboardTransformAbsolute( vr::ETrackingUniverseOrigin eTrackingOrigin, const struct vr::HmdMatrix34_t *pmatTrackingOriginToKeyboardTransform ) override
+	{
+		CProfiledCall call( 175 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eTrackingOrigin );
+			pCapture->WriteArray( pmatTrackingOriginToKeyboardTransform, 1 );
+		}
+		call.Begin();
+		m_pReal->SetKeyboardTransformAbsolute( eTrackingOrigin, pmatTrackingOriginToKeyboardTransform );
+		call.End();
+	}
+
+	virtual void SetKeyboardPositionForOverlay( vr::VROverlayHandle_t ulOverlayHandle, struct vr::HmdRect2_t avoidRect ) override
+	{
+		CProfiledCall call( 176 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( ulOverlayHandle );
+			pCapture->WriteValue( avoidRect );
+		}
+		call.Begin();
+		m_pReal->SetKeyboardPositionForOverlay( ulOverlayHandle, avoidRect );
+		call.End();
+	}
+
+private:
+	vr::IVROverlay *m_pReal;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles every call to vr::IVRRenderModels
+//-----------------------------------------------------------------------------
+class CProfiledIVRRenderModels final : public vr::IVRRenderModels
+{
+public:
+	explicit CProfiledIVRRenderModels( vr::IVRRenderModels *pReal ) : m_pReal( pReal ) {}
+
+	virtual bool LoadRenderModel( const char *pchRenderModelName, struct vr::RenderModel_t **ppRenderModel ) override
+	{
+		CProfiledCall call( 177 );
+		call.Begin();
+		bool result = m_pReal->LoadRenderModel( pchRenderModelName, ppRenderModel );
+		call.End();
+		return result;
+	}
+
+	virtual void FreeRenderModel( struct vr::RenderModel_t *pRenderModel ) override
+	{
+		CProfiledCall call( 178 );
+		call.Begin();
+		m_pReal->FreeRenderModel( pRenderModel );
+		call.End();
+	}
+
+	virtual bool LoadTexture( vr::TextureID_t textureId, struct vr::RenderModel_TextureMap_t **ppTexture ) override
+	{
+		CProfiledCall call( 179 );
+		call.Begin();
+		bool result = m_pReal->LoadTexture( textureId, ppTexture );
+		call.End();
+		return result;
+	}
+
+	virtual void FreeTexture( struct vr::RenderModel_TextureMap_t *pTexture ) override
+	{
+		CProfiledCall call( 180 );
+		call.Begin();
+		m_pReal->FreeTexture( pTexture );
+		call.End();
+	}
+
+	virtual uint32_t GetRenderModelName( uint32_t unRenderModelIndex, char *pchRenderModelName, uint32_t unRenderModelNameLen ) override
+	{
+		CProfiledCall call( 181 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( unRenderModelIndex );
+			pCapture->WriteVarint( pchRenderModelName ? 1 : 0 );
+			pCapture->WriteValue( unRenderModelNameLen );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->GetRenderModelName( unRenderModelIndex, pchRenderModelName, unRenderModelNameLen );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchRenderModelName, unRenderModelNameLen );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetRenderModelCount() override
+	{
+		CProfiledCall call( 182 );
+		call.Begin();
+		uint32_t result = m_pReal->GetRenderModelCount();
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetComponentCount( const char *pchRenderModelName ) override
+	{
+		CProfiledCall call( 183 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchRenderModelName );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->GetComponentCount( pchRenderModelName );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetComponentName( const char *pchRenderModelName, uint32_t unComponentIndex, char *pchComponentName, uint32_t unComponentNameLen ) override
+	{
+		CProfiledCall call( 184 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchRenderModelName );
+			pCapture->WriteValue( unComponentIndex );
+			pCapture->WriteVarint( pchComponentName ? 1 : 0 );
+			pCapture->WriteValue( unComponentNameLen );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->GetComponentName( pchRenderModelName, unComponentIndex, pchComponentName, unComponentNameLen );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchComponentName, unComponentNameLen );
+		}
+		return result;
+	}
+
+	virtual uint64_t GetComponentButtonMask( const char *pchRenderModelName, const char *pchComponentName ) override
+	{
+		CProfiledCall call( 185 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchRenderModelName );
+			pCapture->WriteString( pchComponentName );
+		}
+		call.Begin();
+		uint64_t result = m_pReal->GetComponentButtonMask( pchRenderModelName, pchComponentName );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual uint32_t GetComponentRenderModelName( const char *pchRenderModelName, const char *pchComponentName, char *pchComponentRenderModelName, uint32_t unComponentRenderModelNameLen ) override
+	{
+		CProfiledCall call( 186 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchRenderModelName );
+			pCapture->WriteString( pchComponentName );
+			pCapture->WriteVarint( pchComponentRenderModelName ? 1 : 0 );
+			pCapture->WriteValue( unComponentRenderModelNameLen );
+		}
+		call.Begin();
+		uint32_t result = m_pReal->GetComponentRenderModelName( pchRenderModelName, pchComponentName, pchComponentRenderModelName, unComponentRenderModelNameLen );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pchComponentRenderModelName, unComponentRenderModelNameLen );
+		}
+		return result;
+	}
+
+	virtual bool GetComponentState( const char *pchRenderModelName, const char *pchComponentName, const vr::VRControllerState_t *pControllerState, struct vr::RenderModel_ComponentState_t *pComponentState ) override
+	{
+		CProfiledCall call( 187 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchRenderModelName );
+			pCapture->WriteString( pchComponentName );
+			pCapture->WriteArray( pControllerState, 1 );
+			pCapture->WriteVarint( pComponentState ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetComponentState( pchRenderModelName, pchComponentName, pControllerState, pComponentState );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pComponentState, 1 );
+		}
+		return result;
+	}
+
+private:
+	vr::IVRRenderModels *m_pReal;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles every call to vr::IVRNotifications
+//-----------------------------------------------------------------------------
+class CProfiledIVRNotifications final : public vr::IVRNotifications
+{
+public:
+	explicit CProfiledIVRNotifications( vr::IVRNotifications *pReal ) : m_pReal( pReal ) {}
+
+	virtual vr::EVRNotificationError CreateNotification( vr::VROverlayHandle_t ulOverlayHandle, uint64_t ulUserValue, vr::EVRNotificationType type, const char *pchText, vr::EVRNotificationStyle style, const struct vr::NotificationBitmap_t *pImage, vr::VRNotificationId *pNotificationId ) override
+	{
+		CProfiledCall call( 188 );
+		call.Begin();
+		vr::EVRNotificationError result = m_pReal->CreateNotification( ulOverlayHandle, ulUserValue, type, pchText, style, pImage, pNotificationId );
+		call.End();
+		return result;
+	}
+
+	virtual vr::EVRNotificationError RemoveNotification( vr::VRNotificationId notificationId ) override
+	{
+		CProfiledCall call( 189 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( notificationId );
+		}
+		call.Begin();
+		vr::EVRNotificationError result = m_pReal->RemoveNotification( notificationId );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+private:
+	vr::IVRNotifications *m_pReal;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles every call to vr::IVRSettings
+//-----------------------------------------------------------------------------
+class CProfiledIVRSettings final : public vr::IVRSettings
+{
+public:
+	explicit CProfiledIVRSettings( vr::IVRSettings *pReal ) : m_pReal( pReal ) {}
+
+	virtual const char * GetSettingsErrorNameFromEnum( vr::EVRSettingsError eError ) override
+	{
+		CProfiledCall call( 190 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( eError );
+		}
+		call.Begin();
+		const char * result = m_pReal->GetSettingsErrorNameFromEnum( eError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( result );
+		}
+		return result;
+	}
+
+	virtual void Sync( vr::EVRSettingsError *peError ) override
+	{
+		CProfiledCall call( 191 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteVarint( peError ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->Sync( peError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( peError, 1 );
+		}
+	}
+
+	virtual bool GetBool( const char *pchSection, const char *pchSettingsKey, bool bDefaultValue, vr::EVRSettingsError *peError ) override
+	{
+		CProfiledCall call( 192 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchSection );
+			pCapture->WriteString( pchSettingsKey );
+			pCapture->WriteValue( bDefaultValue );
+			pCapture->WriteVarint( peError ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetBool( pchSection, pchSettingsKey, bDefaultValue, peError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( peError, 1 );
+		}
+		return result;
+	}
+
+	virtual void SetBool( const char *pchSection, const char *pchSettingsKey, bool bValue, vr::EVRSettingsError *peError ) override
+	{
+		CProfiledCall call( 193 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchSection );
+			pCapture->WriteString( pchSettingsKey );
+			pCapture->WriteValue( bValue );
+			pCapture->WriteVarint( peError ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->SetBool( pchSection, pchSettingsKey, bValue, peError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( peError, 1 );
+		}
+	}
+
+	virtual int32_t GetInt32( const char *pchSection, const char *pchSettingsKey, int32_t nDefaultValue, vr::EVRSettingsError *peError ) override
+	{
+		CProfiledCall call( 194 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchSection );
+			pCapture->WriteString( pchSettingsKey );
+			pCapture->WriteValue( nDefaultValue );
+			pCapture->WriteVarint( peError ? 1 : 0 );
+		}
+		call.Begin();
+		int32_t result = m_pReal->GetInt32( pchSection, pchSettingsKey, nDefaultValue, peError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( peError, 1 );
+		}
+		return result;
+	}
+
+	virtual void SetInt32( const char *pchSection, const char *pchSettingsKey, int32_t nValue, vr::EVRSettingsError *peError ) override
+	{
+		CProfiledCall call( 195 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchSection );
+			pCapture->WriteString( pchSettingsKey );
+			pCapture->WriteValue( nValue );
+			pCapture->WriteVarint( peError ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->SetInt32( pchSection, pchSettingsKey, nValue, peError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( peError, 1 );
+		}
+	}
+
+	virtual float GetFloat( const char *pchSection, const char *pchSettingsKey, float flDefaultValue, vr::EVRSettingsError *peError ) override
+	{
+		CProfiledCall call( 196 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchSection );
+			pCapture->WriteString( pchSettingsKey );
+			pCapture->WriteValue( flDefaultValue );
+			pCapture->WriteVarint( peError ? 1 : 0 );
+		}
+		call.Begin();
+		float result = m_pReal->GetFloat( pchSection, pchSettingsKey, flDefaultValue, peError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( peError, 1 );
+		}
+		return result;
+	}
+
+	virtual void SetFloat( const char *pchSection, const char *pchSettingsKey, float flValue, vr::EVRSettingsError *peError ) override
+	{
+		CProfiledCall call( 197 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchSection );
+			pCapture->WriteString( pchSettingsKey );
+			pCapture->WriteValue( flValue );
+			pCapture->WriteVarint( peError ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->SetFloat( pchSection, pchSettingsKey, flValue, peError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( peError, 1 );
+		}
+	}
+
+	virtual void GetString( const char *pchSection, const char *pchSettingsKey, char *pchValue, uint32_t unValueLen, const char *pchDefaultValue, vr::EVRSettingsError *peError ) override
+	{
+		CProfiledCall call( 198 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchSection );
+			pCapture->WriteString( pchSettingsKey );
+			pCapture->WriteVarint( pchValue ? 1 : 0 );
+			pCapture->WriteValue( unValueLen );
+			pCapture->WriteString( pchDefaultValue );
+			pCapture->WriteVarint( peError ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->GetString( pchSection, pchSettingsKey, pchValue, unValueLen, pchDefaultValue, peError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchValue, unValueLen );
+			pCapture->WriteArray( peError, 1 );
+		}
+	}
+
+	virtual void SetString( const char *pchSection, const char *pchSettingsKey, const char *pchValue, vr::EVRSettingsError *peError ) override
+	{
+		CProfiledCall call( 199 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteString( pchSection );
+			pCapture->WriteString( pchSettingsKey );
+			pCapture->WriteString( pchValue );
+			pCapture->WriteVarint( peError ? 1 : 0 );
+		}
+		call.Begin();
+		m_pReal->SetString( pchSection, pchSettingsKey, pchValue, peError );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteArray( peError, 1 );
+		}
+	}
+
+private:
+	vr::IVRSettings *m_pReal;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Profiles every call to vr::IVRTrackedCamera
+//-----------------------------------------------------------------------------
+class CProfiledIVRTrackedCamera final : public vr::IVRTrackedCamera
+{
+public:
+	explicit CProfiledIVRTrackedCamera( vr::IVRTrackedCamera *pReal ) : m_pReal( pReal ) {}
+
+	virtual bool HasCamera( vr::TrackedDeviceIndex_t nDeviceIndex ) override
+	{
+		CProfiledCall call( 200 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+		}
+		call.Begin();
+		bool result = m_pReal->HasCamera( nDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool GetCameraFirmwareDescription( vr::TrackedDeviceIndex_t nDeviceIndex, char *pBuffer, uint32_t nBufferLen ) override
+	{
+		CProfiledCall call( 201 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+			pCapture->WriteVarint( pBuffer ? 1 : 0 );
+			pCapture->WriteValue( nBufferLen );
+		}
+		call.Begin();
+		bool result = m_pReal->GetCameraFirmwareDescription( nDeviceIndex, pBuffer, nBufferLen );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteString( pBuffer, nBufferLen );
+		}
+		return result;
+	}
+
+	virtual bool GetCameraFrameDimensions( vr::TrackedDeviceIndex_t nDeviceIndex, vr::ECameraVideoStreamFormat nVideoStreamFormat, uint32_t *pWidth, uint32_t *pHeight ) override
+	{
+		CProfiledCall call( 202 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+			pCapture->WriteValue( nVideoStreamFormat );
+			pCapture->WriteVarint( pWidth ? 1 : 0 );
+			pCapture->WriteVarint( pHeight ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetCameraFrameDimensions( nDeviceIndex, nVideoStreamFormat, pWidth, pHeight );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pWidth, 1 );
+			pCapture->WriteArray( pHeight, 1 );
+		}
+		return result;
+	}
+
+	virtual bool SetCameraVideoStreamFormat( vr::TrackedDeviceIndex_t nDeviceIndex, vr::ECameraVideoStreamFormat nVideoStreamFormat ) override
+	{
+		CProfiledCall call( 203 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+			pCapture->WriteValue( nVideoStreamFormat );
+		}
+		call.Begin();
+		bool result = m_pReal->SetCameraVideoStreamFormat( nDeviceIndex, nVideoStreamFormat );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual vr::ECameraVideoStreamFormat GetCameraVideoStreamFormat( vr::TrackedDeviceIndex_t nDeviceIndex ) override
+	{
+		CProfiledCall call( 204 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+		}
+		call.Begin();
+		vr::ECameraVideoStreamFormat result = m_pReal->GetCameraVideoStreamFormat( nDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool EnableCameraForStreaming( vr::TrackedDeviceIndex_t nDeviceIndex, bool bEnable ) override
+	{
+		CProfiledCall call( 205 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+			pCapture->WriteValue( bEnable );
+		}
+		call.Begin();
+		bool result = m_pReal->EnableCameraForStreaming( nDeviceIndex, bEnable );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool StartVideoStream( vr::TrackedDeviceIndex_t nDeviceIndex ) override
+	{
+		CProfiledCall call( 206 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+		}
+		call.Begin();
+		bool result = m_pReal->StartVideoStream( nDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool StopVideoStream( vr::TrackedDeviceIndex_t nDeviceIndex ) override
+	{
+		CProfiledCall call( 207 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+		}
+		call.Begin();
+		bool result = m_pReal->StopVideoStream( nDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool IsVideoStreamActive( vr::TrackedDeviceIndex_t nDeviceIndex ) override
+	{
+		CProfiledCall call( 208 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+		}
+		call.Begin();
+		bool result = m_pReal->IsVideoStreamActive( nDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual float GetVideoStreamElapsedTime( vr::TrackedDeviceIndex_t nDeviceIndex ) override
+	{
+		CProfiledCall call( 209 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+		}
+		call.Begin();
+		float result = m_pReal->GetVideoStreamElapsedTime( nDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual const vr::CameraVideoStreamFrame_t * GetVideoStreamFrame( vr::TrackedDeviceIndex_t nDeviceIndex ) override
+	{
+		CProfiledCall call( 210 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+		}
+		call.Begin();
+		const vr::CameraVideoStreamFrame_t * result = m_pReal->GetVideoStreamFrame( nDeviceIndex );
+		call.End();
+		return result;
+	}
+
+	virtual bool ReleaseVideoStreamFrame( vr::TrackedDeviceIndex_t nDeviceIndex, const vr::CameraVideoStreamFrame_t *pFrameImage ) override
+	{
+		CProfiledCall call( 211 );
+		call.Begin();
+		bool result = m_pReal->ReleaseVideoStreamFrame( nDeviceIndex, pFrameImage );
+		call.End();
+		return result;
+	}
+
+	virtual bool SetAutoExposure( vr::TrackedDeviceIndex_t nDeviceIndex, bool bEnable ) override
+	{
+		CProfiledCall call( 212 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+			pCapture->WriteValue( bEnable );
+		}
+		call.Begin();
+		bool result = m_pReal->SetAutoExposure( nDeviceIndex, bEnable );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool PauseVideoStream( vr::TrackedDeviceIndex_t nDeviceIndex ) override
+	{
+		CProfiledCall call( 213 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+		}
+		call.Begin();
+		bool result = m_pReal->PauseVideoStream( nDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool ResumeVideoStream( vr::TrackedDeviceIndex_t nDeviceIndex ) override
+	{
+		CProfiledCall call( 214 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+		}
+		call.Begin();
+		bool result = m_pReal->ResumeVideoStream( nDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool IsVideoStreamPaused( vr::TrackedDeviceIndex_t nDeviceIndex ) override
+	{
+		CProfiledCall call( 215 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+		}
+		call.Begin();
+		bool result = m_pReal->IsVideoStreamPaused( nDeviceIndex );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+		}
+		return result;
+	}
+
+	virtual bool GetCameraDistortion( vr::TrackedDeviceIndex_t nDeviceIndex, float flInputU, float flInputV, float *pflOutputU, float *pflOutputV ) override
+	{
+		CProfiledCall call( 216 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+			pCapture->WriteValue( flInputU );
+			pCapture->WriteValue( flInputV );
+			pCapture->WriteVarint( pflOutputU ? 1 : 0 );
+			pCapture->WriteVarint( pflOutputV ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetCameraDistortion( nDeviceIndex, flInputU, flInputV, pflOutputU, pflOutputV );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pflOutputU, 1 );
+			pCapture->WriteArray( pflOutputV, 1 );
+		}
+		return result;
+	}
+
+	virtual bool GetCameraProjection( vr::TrackedDeviceIndex_t nDeviceIndex, float flWidthPixels, float flHeightPixels, float flZNear, float flZFar, vr::HmdMatrix44_t *pProjection ) override
+	{
+		CProfiledCall call( 217 );
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( nDeviceIndex );
+			pCapture->WriteValue( flWidthPixels );
+			pCapture->WriteValue( flHeightPixels );
+			pCapture->WriteValue( flZNear );
+			pCapture->WriteValue( flZFar );
+			pCapture->WriteVarint( pProjection ? 1 : 0 );
+		}
+		call.Begin();
+		bool result = m_pReal->GetCameraProjection( nDeviceIndex, flWidthPixels, flHeightPixels, flZNear, flZFar, pProjection );
+		call.End();
+		if ( CApiCaptureBuffer *pCapture = call.GetCapture() )
+		{
+			pCapture->WriteValue( result );
+			pCapture->WriteArray( pProjection, 1 );
+		}
+		return result;
+	}
+
+private:
+	vr::IVRTrackedCamera *m_pReal;
+};
+
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+int Profiler_FindInterface( const char *pchInterfaceVersion )
+{
+	if ( !strcmp( pchInterfaceVersion, vr::IVRSystem_Version ) )
+		return 0;
+	if ( !strcmp( pchInterfaceVersion, vr::IVRExtendedDisplay_Version ) )
+		return 1;
+	if ( !strcmp( pchInterfaceVersion, vr::IVRApplications_Version ) )
+		return 2;
+	if ( !strcmp( pchInterfaceVersion, vr::IVRChaperone_Version ) )
+		return 3;
+	if ( !strcmp( pchInterfaceVersion, vr::IVRChaperoneSetup_Version ) )
+		return 4;
+	if ( !strcmp( pchInterfaceVersion, vr::IVRCompositor_Version ) )
+		return 5;
+	if ( !strcmp( pchInterfaceVersion, vr::IVROverlay_Version ) )
+		return 6;
+	if ( !strcmp( pchInterfaceVersion, vr::IVRRenderModels_Version ) )
+		return 7;
+	if ( !strcmp( pchInterfaceVersion, vr::IVRNotifications_Version ) )
+		return 8;
+	if ( !strcmp( pchInterfaceVersion, vr::IVRSettings_Version ) )
+		return 9;
+	if ( !strcmp( pchInterfaceVersion, vr::IVRTrackedCamera_Version ) )
+		return 10;
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void *Profiler_CreateWrapper( int nInterface, void *pRealInterface )
+{
+	switch ( nInterface )
+	{
+	case 0: return static_cast< vr::IVRSystem * >( new CProfiledIVRSystem( static_cast< vr::IVRSystem * >( pRealInterface ) ) );
+	case 1: return static_cast< vr::IVRExtendedDisplay * >( new CProfiledIVRExtendedDisplay( static_cast< vr::IVRExtendedDisplay * >( pRealInterface ) ) );
+	case 2: return static_cast< vr::IVRApplications * >( new CProfiledIVRApplications( static_cast< vr::IVRApplications * >( pRealInterface ) ) );
+	case 3: return static_cast< vr::IVRChaperone * >( new CProfiledIVRChaperone( static_cast< vr::IVRChaperone * >( pRealInterface ) ) );
+	case 4: return static_cast< vr::IVRChaperoneSetup * >( new CProfiledIVRChaperoneSetup( static_cast< vr::IVRChaperoneSetup * >( pRealInterface ) ) );
+	case 5: return static_cast< vr::IVRCompositor * >( new CProfiledIVRCompositor( static_cast< vr::IVRCompositor * >( pRealInterface ) ) );
+	case 6: return static_cast< vr::IVROverlay * >( new CProfiledIVROverlay( static_cast< vr::IVROverlay * >( pRealInterface ) ) );
+	case 7: return static_cast< vr::IVRRenderModels * >( new CProfiledIVRRenderModels( static_cast< vr::IVRRenderModels * >( pRealInterface ) ) );
+	case 8: return static_cast< vr::IVRNotifications * >( new CProfiledIVRNotifications( static_cast< vr::IVRNotifications * >( pRealInterface ) ) );
+	case 9: return static_cast< vr::IVRSettings * >( new CProfiledIVRSettings( static_cast< vr::IVRSettings * >( pRealInterface ) ) );
+	case 10: return static_cast< vr::IVRTrackedCamera * >( new CProfiledIVRTrackedCamera( static_cast< vr::IVRTrackedCamera * >( pRealInterface ) ) );
+	default: return NULL;
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void Profiler_DestroyWrapper( int nInterface, void *pWrapper )
+{
+	switch ( nInterface )
+	{
+	case 0: delete static_cast< CProfiledIVRSystem * >( static_cast< vr::IVRSystem * >( pWrapper ) ); break;
+	case 1: delete static_cast< CProfiledIVRExtendedDisplay * >( static_cast< vr::IVRExtendedDisplay * >( pWrapper ) ); break;
+	case 2: delete static_cast< CProfiledIVRApplications * >( static_cast< vr::IVRApplications * >( pWrapper ) ); break;
+	case 3: delete static_cast< CProfiledIVRChaperone * >( static_cast< vr::IVRChaperone * >( pWrapper ) ); break;
+	case 4: delete static_cast< CProfiledIVRChaperoneSetup * >( static_cast< vr::IVRChaperoneSetup * >( pWrapper ) ); break;
+	case 5: delete static_cast< CProfiledIVRCompositor * >( static_cast< vr::IVRCompositor * >( pWrapper ) ); break;
+	case 6: delete static_cast< CProfiledIVROverlay * >( static_cast< vr::IVROverlay * >( pWrapper ) ); break;
+	case 7: delete static_cast< CProfiledIVRRenderModels * >( static_cast< vr::IVRRenderModels * >( pWrapper ) ); break;
+	case 8: delete static_cast< CProfiledIVRNotifications * >( static_cast< vr::IVRNotifications * >( pWrapper ) ); break;
+	case 9: delete static_cast< CProfiledIVRSettings * >( static_cast< vr::IVRSettings * >( pWrapper ) ); break;
+	case 10: delete static_cast< CProfiledIVRTrackedCamera * >( static_cast< vr::IVRTrackedCamera * >( pWrapper ) ); break;
+	}
+}
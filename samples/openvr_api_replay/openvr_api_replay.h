@@ -0,0 +1,30 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <cstdint>
+
+#include "shared/apicapture.h"
+
+/** One method the replayer knows how to call, in openvr_api.json order */
+struct ReplayMethod_t
+{
+	const char *pchName;	// "IVRSystem::PollNextEvent"
+	int nInterface;			// index into g_rpchReplayInterfaceVersions
+	bool bReplayable;		// false for calls that pass textures or raw buffers, which were captured as timing only
+};
+
+// Defined by the generated openvr_api_replay_calls.cpp
+extern const char *const g_rpchReplayInterfaceVersions[];
+extern const ReplayMethod_t g_rReplayMethods[];
+extern const uint32_t g_unReplayMethodCount;
+extern const uint32_t g_unReplayInterfaceCount;
+
+/** Calls method unMethod on pInterface with the arguments in a captured payload. pulTicks
+* gets the Trace_GetTimestamp() ticks the call took and pbReturnDiffered whether its return
+* value differs from the recorded one. Returns false if the payload was malformed. */
+bool Replay_Call( uint32_t unMethod, void *pInterface, CApiCaptureReader &reader, uint64_t *pulTicks, bool *pbReturnDiffered );
+
+/** Overlay handles and notification ids are chosen by the runtime, so the ones in a capture
+* are mapped to the ones the replay got back. Unknown handles pass through unchanged. */
+uint64_t Replay_MapHandle( uint64_t ulRecorded );
+void Replay_AddHandle( uint64_t ulRecorded, uint64_t ulReplayed );
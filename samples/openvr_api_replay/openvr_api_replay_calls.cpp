@@ -0,0 +1,3390 @@
+//========= Copyright Valve Corporation ============//
+// Generated by openvr_api_profiler/generate_wrappers.py from openvr_api.json for openvr_api_replay. Do not edit by hand.
+#include "openvr_api_replay.h"
+
+#include <string.h>
+#include <vector>
+
+#include <openvr.h>
+
+#include "shared/tracebuffer.h"
+
+const char *const g_rpchReplayInterfaceVersions[] =
+{
+	vr::IVRSystem_Version,
+	vr::IVRExtendedDisplay_Version,
+	vr::IVRApplications_Version,
+	vr::IVRChaperone_Version,
+	vr::IVRChaperoneSetup_Version,
+	vr::IVRCompositor_Version,
+	vr::IVROverlay_Version,
+	vr::IVRRenderModels_Version,
+	vr::IVRNotifications_Version,
+	vr::IVRSettings_Version,
+	vr::IVRTrackedCamera_Version,
+};
+
+const ReplayMethod_t g_rReplayMethods[] =
+{
+	{ "IVRSystem::GetRecommendedRenderTargetSize", 0, true },
+	{ "IVRSystem::GetProjectionMatrix", 0, true },
+	{ "IVRSystem::GetProjectionRaw", 0, true },
+	{ "IVRSystem::ComputeDistortion", 0, true },
+	{ "IVRSystem::GetEyeToHeadTransform", 0, true },
+	{ "IVRSystem::GetTimeSinceLastVsync", 0, true },
+	{ "IVRSystem::GetD3D9AdapterIndex", 0, true },
+	{ "IVRSystem::GetDXGIOutputInfo", 0, true },
+	{ "IVRSystem::IsDisplayOnDesktop", 0, true },
+	{ "IVRSystem::SetDisplayVisibility", 0, true },
+	{ "IVRSystem::GetDeviceToAbsoluteTrackingPose", 0, true },
+	{ "IVRSystem::ResetSeatedZeroPose", 0, true },
+	{ "IVRSystem::GetSeatedZeroPoseToStandingAbsoluteTrackingPose", 0, true },
+	{ "IVRSystem::GetRawZeroPoseToStandingAbsoluteTrackingPose", 0, true },
+	{ "IVRSystem::GetSortedTrackedDeviceIndicesOfClass", 0, true },
+	{ "IVRSystem::GetTrackedDeviceActivityLevel", 0, true },
+	{ "IVRSystem::ApplyTransform", 0, true },
+	{ "IVRSystem::GetTrackedDeviceIndexForControllerRole", 0, true },
+	{ "IVRSystem::GetControllerRoleForTrackedDeviceIndex", 0, true },
+	{ "IVRSystem::GetTrackedDeviceClass", 0, true },
+	{ "IVRSystem::IsTrackedDeviceConnected", 0, true },
+	{ "IVRSystem::GetBoolTrackedDeviceProperty", 0, true },
+	{ "IVRSystem::GetFloatTrackedDeviceProperty", 0, true },
+	{ "IVRSystem::GetInt32TrackedDeviceProperty", 0, true },
+	{ "IVRSystem::GetUint64TrackedDeviceProperty", 0, true },
+	{ "IVRSystem::GetMatrix34TrackedDeviceProperty", 0, true },
+	{ "IVRSystem::GetStringTrackedDeviceProperty", 0, true },
+	{ "IVRSystem::GetPropErrorNameFromEnum", 0, true },
+	{ "IVRSystem::PollNextEvent", 0, true },
+	{ "IVRSystem::PollNextEventWithPose", 0, true },
+	{ "IVRSystem::GetEventTypeNameFromEnum", 0, true },
+	{ "IVRSystem::GetHiddenAreaMesh", 0, true },
+	{ "IVRSystem::GetControllerState", 0, true },
+	{ "IVRSystem::GetControllerStateWithPose", 0, true },
+	{ "IVRSystem::TriggerHapticPulse", 0, true },
+	{ "IVRSystem::GetButtonIdNameFromEnum", 0, true },
+	{ "IVRSystem::GetControllerAxisTypeNameFromEnum", 0, true },
+	{ "IVRSystem::CaptureInputFocus", 0, true },
+	{ "IVRSystem::ReleaseInputFocus", 0, true },
+	{ "IVRSystem::IsInputFocusCapturedByAnotherProcess", 0, true },
+	{ "IVRSystem::DriverDebugRequest", 0, true },
+	{ "IVRSystem::PerformFirmwareUpdate", 0, true },
+	{ "IVRSystem::AcknowledgeQuit_Exiting", 0, true },
+	{ "IVRSystem::AcknowledgeQuit_UserPrompt", 0, true },
+	{ "IVRSystem::PerformanceTestEnableCapture", 0, true },
+	{ "IVRSystem::PerformanceTestReportFidelityLevelChange", 0, true },
+	{ "IVRExtendedDisplay::GetWindowBounds", 1, true },
+	{ "IVRExtendedDisplay::GetEyeOutputViewport", 1, true },
+	{ "IVRExtendedDisplay::GetDXGIOutputInfo", 1, true },
+	{ "IVRApplications::AddApplicationManifest", 2, true },
+	{ "IVRApplications::RemoveApplicationManifest", 2, true },
+	{ "IVRApplications::IsApplicationInstalled", 2, true },
+	{ "IVRApplications::GetApplicationCount", 2, true },
+	{ "IVRApplications::GetApplicationKeyByIndex", 2, true },
+	{ "IVRApplications::GetApplicationKeyByProcessId", 2, true },
+	{ "IVRApplications::LaunchApplication", 2, true },
+	{ "IVRApplications::LaunchDashboardOverlay", 2, true },
+	{ "IVRApplications::IdentifyApplication", 2, true },
+	{ "IVRApplications::GetApplicationProcessId", 2, true },
+	{ "IVRApplications::GetApplicationsErrorNameFromEnum", 2, true },
+	{ "IVRApplications::GetApplicationPropertyString", 2, true },
+	{ "IVRApplications::GetApplicationPropertyBool", 2, true },
+	{ "IVRApplications::SetApplicationAutoLaunch", 2, true },
+	{ "IVRApplications::GetApplicationAutoLaunch", 2, true },
+	{ "IVRApplications::GetStartingApplication", 2, true },
+	{ "IVRApplications::GetTransitionState", 2, true },
+	{ "IVRApplications::PerformApplicationPrelaunchCheck", 2, true },
+	{ "IVRApplications::GetApplicationsTransitionStateNameFromEnum", 2, true },
+	{ "IVRApplications::IsQuitUserPromptRequested", 2, true },
+	{ "IVRChaperone::GetCalibrationState", 3, true },
+	{ "IVRChaperone::GetPlayAreaSize", 3, true },
+	{ "IVRChaperone::GetPlayAreaRect", 3, true },
+	{ "IVRChaperone::ReloadInfo", 3, true },
+	{ "IVRChaperone::SetSceneColor", 3, true },
+	{ "IVRChaperone::GetBoundsColor", 3, true },
+	{ "IVRChaperone::AreBoundsVisible", 3, true },
+	{ "IVRChaperone::ForceBoundsVisible", 3, true },
+	{ "IVRChaperoneSetup::CommitWorkingCopy", 4, true },
+	{ "IVRChaperoneSetup::RevertWorkingCopy", 4, true },
+	{ "IVRChaperoneSetup::GetWorkingPlayAreaSize", 4, true },
+	{ "IVRChaperoneSetup::GetWorkingPlayAreaRect", 4, true },
+	{ "IVRChaperoneSetup::GetWorkingCollisionBoundsInfo", 4, true },
+	{ "IVRChaperoneSetup::GetLiveCollisionBoundsInfo", 4, true },
+	{ "IVRChaperoneSetup::GetWorkingSeatedZeroPoseToRawTrackingPose", 4, true },
+	{ "IVRChaperoneSetup::GetWorkingStandingZeroPoseToRawTrackingPose", 4, true },
+	{ "IVRChaperoneSetup::SetWorkingPlayAreaSize", 4, true },
+	{ "IVRChaperoneSetup::SetWorkingCollisionBoundsInfo", 4, true },
+	{ "IVRChaperoneSetup::SetWorkingSeatedZeroPoseToRawTrackingPose", 4, true },
+	{ "IVRChaperoneSetup::SetWorkingStandingZeroPoseToRawTrackingPose", 4, true },
+	{ "IVRChaperoneSetup::ReloadFromDisk", 4, true },
+	{ "IVRChaperoneSetup::GetLiveSeatedZeroPoseToRawTrackingPose", 4, true },
+	{ "IVRChaperoneSetup::SetWorkingWallTagInfo", 4, true },
+	{ "IVRChaperoneSetup::GetLiveWallTagInfo", 4, true },
+	{ "IVRCompositor::SetTrackingSpace", 5, true },
+	{ "IVRCompositor::GetTrackingSpace", 5, true },
+	{ "IVRCompositor::WaitGetPoses", 5, true },
+	{ "IVRCompositor::GetLastPoses", 5, true },
+	{ "IVRCompositor::Submit", 5, false },
+	{ "IVRCompositor::ClearLastSubmittedFrame", 5, true },
+	{ "IVRCompositor::PostPresentHandoff", 5, true },
+	{ "IVRCompositor::GetFrameTiming", 5, true },
+	{ "IVRCompositor::GetFrameTimeRemaining", 5, true },
+	{ "IVRCompositor::FadeToColor", 5, true },
+	{ "IVRCompositor::FadeGrid", 5, true },
+	{ "IVRCompositor::SetSkyboxOverride", 5, false },
+	{ "IVRCompositor::ClearSkyboxOverride", 5, true },
+	{ "IVRCompositor::CompositorBringToFront", 5, true },
+	{ "IVRCompositor::CompositorGoToBack", 5, true },
+	{ "IVRCompositor::CompositorQuit", 5, true },
+	{ "IVRCompositor::IsFullscreen", 5, true },
+	{ "IVRCompositor::GetCurrentSceneFocusProcess", 5, true },
+	{ "IVRCompositor::GetLastFrameRenderer", 5, true },
+	{ "IVRCompositor::CanRenderScene", 5, true },
+	{ "IVRCompositor::ShowMirrorWindow", 5, true },
+	{ "IVRCompositor::HideMirrorWindow", 5, true },
+	{ "IVRCompositor::IsMirrorWindowVisible", 5, true },
+	{ "IVRCompositor::CompositorDumpImages", 5, true },
+	{ "IVROverlay::FindOverlay", 6, true },
+	{ "IVROverlay::CreateOverlay", 6, true },
+	{ "IVROverlay::DestroyOverlay", 6, true },
+	{ "IVROverlay::SetHighQualityOverlay", 6, true },
+	{ "IVROverlay::GetHighQualityOverlay", 6, true },
+	{ "IVROverlay::GetOverlayKey", 6, true },
+	{ "IVROverlay::GetOverlayName", 6, true },
+	{ "IVROverlay::GetOverlayImageData", 6, false },
+	{ "IVROverlay::GetOverlayErrorNameFromEnum", 6, true },
+	{ "IVROverlay::SetOverlayFlag", 6, true },
+	{ "IVROverlay::GetOverlayFlag", 6, true },
+	{ "IVROverlay::SetOverlayColor", 6, true },
+	{ "IVROverlay::GetOverlayColor", 6, true },
+	{ "IVROverlay::SetOverlayAlpha", 6, true },
+	{ "IVROverlay::GetOverlayAlpha", 6, true },
+	{ "IVROverlay::SetOverlayWidthInMeters", 6, true },
+	{ "IVROverlay::GetOverlayWidthInMeters", 6, true },
+	{ "IVROverlay::SetOverlayAutoCurveDistanceRangeInMeters", 6, true },
+	{ "IVROverlay::GetOverlayAutoCurveDistanceRangeInMeters", 6, true },
+	{ "IVROverlay::SetOverlayTextureColorSpace", 6, true },
+	{ "IVROverlay::GetOverlayTextureColorSpace", 6, true },
+	{ "IVROverlay::SetOverlayTextureBounds", 6, true },
+	{ "IVROverlay::GetOverlayTextureBounds", 6, true },
+	{ "IVROverlay::GetOverlayTransformType", 6, true },
+	{ "IVROverlay::SetOverlayTransformAbsolute", 6, true },
+	{ "IVROverlay::GetOverlayTransformAbsolute", 6, true },
+	{ "IVROverlay::SetOverlayTransformTrackedDeviceRelative", 6, true },
+	{ "IVROverlay::GetOverlayTransformTrackedDeviceRelative", 6, true },
+	{ "IVROverlay::ShowOverlay", 6, true },
+	{ "IVROverlay::HideOverlay", 6, true },
+	{ "IVROverlay::IsOverlayVisible", 6, true },
+	{ "IVROverlay::GetTransformForOverlayCoordinates", 6, true },
+	{ "IVROverlay::PollNextOverlayEvent", 6, true },
+	{ "IVROverlay::GetOverlayInputMethod", 6, true },
+	{ "IVROverlay::SetOverlayInputMethod", 6, true },
+	{ "IVROverlay::GetOverlayMouseScale", 6, true },
+	{ "IVROverlay::SetOverlayMouseScale", 6, true },
+	{ "IVROverlay::ComputeOverlayIntersection", 6, true },
+	{ "IVROverlay::HandleControllerOverlayInteractionAsMouse", 6, true },
+	{ "IVROverlay::IsHoverTargetOverlay", 6, true },
+	{ "IVROverlay::GetGamepadFocusOverlay", 6, true },
+	{ "IVROverlay::SetGamepadFocusOverlay", 6, true },
+	{ "IVROverlay::SetOverlayNeighbor", 6, true },
+	{ "IVROverlay::MoveGamepadFocusToNeighbor", 6, true },
+	{ "IVROverlay::SetOverlayTexture", 6, false },
+	{ "IVROverlay::ClearOverlayTexture", 6, true },
+	{ "IVROverlay::SetOverlayRaw", 6, false },
+	{ "IVROverlay::SetOverlayFromFile", 6, true },
+	{ "IVROverlay::CreateDashboardOverlay", 6, true },
+	{ "IVROverlay::IsDashboardVisible", 6, true },
+	{ "IVROverlay::IsActiveDashboardOverlay", 6, true },
+	{ "IVROverlay::SetDashboardOverlaySceneProcess", 6, true },
+	{ "IVROverlay::GetDashboardOverlaySceneProcess", 6, true },
+	{ "IVROverlay::ShowDashboard", 6, true },
+	{ "IVROverlay::ShowKeyboard", 6, true },
+	{ "IVROverlay::ShowKeyboardForOverlay", 6, true },
+	{ "IVROverlay::GetKeyboardText", 6, true },
+	{ "IVROverlay::HideKeyboard", 6, true },
+	{ "IVROverlay::SetKeyboardTransformAbsolute", 6, true },
+	{ "IVROverlay::SetKeyboardPositionForOverlay", 6, true },
+	{ "IVRRenderModels::LoadRenderModel", 7, false },
+	{ "IVRRenderModels::FreeRenderModel", 7, false },
+	{ "IVRRenderModels::LoadTexture", 7, false },
+	{ "IVRRenderModels::FreeTexture", 7, false },
+	{ "IVRRenderModels::GetRenderModelName", 7, true },
+	{ "IVRRenderModels::GetRenderModelCount", 7, true },
+	{ "IVRRenderModels::GetComponentCount", 7, true },
+	{ "IVRRenderModels::GetComponentName", 7, true },
+	{ "IVRRenderModels::GetComponentButtonMask", 7, true },
+	{ "IVRRenderModels::GetComponentRenderModelName", 7, true },
+	{ "IVRRenderModels::GetComponentState", 7, true },
+	{ "IVRNotifications::CreateNotification", 8, false },
+	{ "IVRNotifications::RemoveNotification", 8, true },
+	{ "IVRSettings::GetSettingsErrorNameFromEnum", 9, true },
+	{ "IVRSettings::Sync", 9, true },
+	{ "IVRSettings::GetBool", 9, true },
+	{ "IVRSettings::SetBool", 9, true },
+	{ "IVRSettings::GetInt32", 9, true },
+	{ "IVRSettings::SetInt32", 9, true },
+	{ "IVRSettings::GetFloat", 9, true },
+	{ "IVRSettings::SetFloat", 9, true },
+	{ "IVRSettings::GetString", 9, true },
+	{ "IVRSettings::SetString", 9, true },
+	{ "IVRTrackedCamera::HasCamera", 10, true },
+	{ "IVRTrackedCamera::GetCameraFirmwareDescription", 10, true },
+	{ "IVRTrackedCamera::GetCameraFrameDimensions", 10, true },
+	{ "IVRTrackedCamera::SetCameraVideoStreamFormat", 10, true },
+	{ "IVRTrackedCamera::GetCameraVideoStreamFormat", 10, true },
+	{ "IVRTrackedCamera::EnableCameraForStreaming", 10, true },
+	{ "IVRTrackedCamera::StartVideoStream", 10, true },
+	{ "IVRTrackedCamera::StopVideoStream", 10, true },
+	{ "IVRTrackedCamera::IsVideoStreamActive", 10, true },
+	{ "IVRTrackedCamera::GetVideoStreamElapsedTime", 10, true },
+	{ "IVRTrackedCamera::GetVideoStreamFrame", 10, true },
+	{ "IVRTrackedCamera::ReleaseVideoStreamFrame", 10, false },
+	{ "IVRTrackedCamera::SetAutoExposure", 10, true },
+	{ "IVRTrackedCamera::PauseVideoStream", 10, true },
+	{ "IVRTrackedCamera::ResumeVideoStream", 10, true },
+	{ "IVRTrackedCamera::IsVideoStreamPaused", 10, true },
+	{ "IVRTrackedCamera::GetCameraDistortion", 10, true },
+	{ "IVRTrackedCamera::GetCameraProjection", 10, true },
+};
+
+const uint32_t g_unReplayMethodCount = sizeof( g_rReplayMethods ) / sizeof( g_rReplayMethods[0] );
+const uint32_t g_unReplayInterfaceCount = sizeof( g_rpchReplayInterfaceVersions ) / sizeof( g_rpchReplayInterfaceVersions[0] );
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool Replay_Call( uint32_t unMethod, void *pInterface, CApiCaptureReader &reader, uint64_t *pulTicks, bool *pbReturnDiffered )
+{
+	*pulTicks = 0;
+	*pbReturnDiffered = false;
+
+	switch ( unMethod )
+	{
+	case 0: // IVRSystem::GetRecommendedRenderTargetSize
+	{
+		const bool pnWidth_present = reader.ReadVarint() != 0;
+		const bool pnHeight_present = reader.ReadVarint() != 0;
+		std::vector< uint32_t > pnWidth_data( pnWidth_present ? 1 : 0 );
+		std::vector< uint32_t > pnHeight_data( pnHeight_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->GetRecommendedRenderTargetSize( pnWidth_present ? pnWidth_data.data() : NULL, pnHeight_present ? pnHeight_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 1: // IVRSystem::GetProjectionMatrix
+	{
+		vr::EVREye eEye = reader.ReadValue< vr::EVREye >();
+		float fNearZ = reader.ReadValue< float >();
+		float fFarZ = reader.ReadValue< float >();
+		vr::EGraphicsAPIConvention eProjType = reader.ReadValue< vr::EGraphicsAPIConvention >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		struct vr::HmdMatrix44_t result = static_cast< vr::IVRSystem * >( pInterface )->GetProjectionMatrix( eEye, fNearZ, fFarZ, eProjType );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const struct vr::HmdMatrix44_t recorded = reader.ReadValue< struct vr::HmdMatrix44_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 2: // IVRSystem::GetProjectionRaw
+	{
+		vr::EVREye eEye = reader.ReadValue< vr::EVREye >();
+		const bool pfLeft_present = reader.ReadVarint() != 0;
+		const bool pfRight_present = reader.ReadVarint() != 0;
+		const bool pfTop_present = reader.ReadVarint() != 0;
+		const bool pfBottom_present = reader.ReadVarint() != 0;
+		std::vector< float > pfLeft_data( pfLeft_present ? 1 : 0 );
+		std::vector< float > pfRight_data( pfRight_present ? 1 : 0 );
+		std::vector< float > pfTop_data( pfTop_present ? 1 : 0 );
+		std::vector< float > pfBottom_data( pfBottom_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->GetProjectionRaw( eEye, pfLeft_present ? pfLeft_data.data() : NULL, pfRight_present ? pfRight_data.data() : NULL, pfTop_present ? pfTop_data.data() : NULL, pfBottom_present ? pfBottom_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 3: // IVRSystem::ComputeDistortion
+	{
+		vr::EVREye eEye = reader.ReadValue< vr::EVREye >();
+		float fU = reader.ReadValue< float >();
+		float fV = reader.ReadValue< float >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		struct vr::DistortionCoordinates_t result = static_cast< vr::IVRSystem * >( pInterface )->ComputeDistortion( eEye, fU, fV );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const struct vr::DistortionCoordinates_t recorded = reader.ReadValue< struct vr::DistortionCoordinates_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 4: // IVRSystem::GetEyeToHeadTransform
+	{
+		vr::EVREye eEye = reader.ReadValue< vr::EVREye >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		struct vr::HmdMatrix34_t result = static_cast< vr::IVRSystem * >( pInterface )->GetEyeToHeadTransform( eEye );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const struct vr::HmdMatrix34_t recorded = reader.ReadValue< struct vr::HmdMatrix34_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 5: // IVRSystem::GetTimeSinceLastVsync
+	{
+		const bool pfSecondsSinceLastVsync_present = reader.ReadVarint() != 0;
+		const bool pulFrameCounter_present = reader.ReadVarint() != 0;
+		std::vector< float > pfSecondsSinceLastVsync_data( pfSecondsSinceLastVsync_present ? 1 : 0 );
+		std::vector< uint64_t > pulFrameCounter_data( pulFrameCounter_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSystem * >( pInterface )->GetTimeSinceLastVsync( pfSecondsSinceLastVsync_present ? pfSecondsSinceLastVsync_data.data() : NULL, pulFrameCounter_present ? pulFrameCounter_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 6: // IVRSystem::GetD3D9AdapterIndex
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		int32_t result = static_cast< vr::IVRSystem * >( pInterface )->GetD3D9AdapterIndex();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const int32_t recorded = reader.ReadValue< int32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 7: // IVRSystem::GetDXGIOutputInfo
+	{
+		const bool pnAdapterIndex_present = reader.ReadVarint() != 0;
+		std::vector< int32_t > pnAdapterIndex_data( pnAdapterIndex_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->GetDXGIOutputInfo( pnAdapterIndex_present ? pnAdapterIndex_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 8: // IVRSystem::IsDisplayOnDesktop
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSystem * >( pInterface )->IsDisplayOnDesktop();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 9: // IVRSystem::SetDisplayVisibility
+	{
+		bool bIsVisibleOnDesktop = reader.ReadValue< bool >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSystem * >( pInterface )->SetDisplayVisibility( bIsVisibleOnDesktop );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 10: // IVRSystem::GetDeviceToAbsoluteTrackingPose
+	{
+		vr::ETrackingUniverseOrigin eOrigin = reader.ReadValue< vr::ETrackingUniverseOrigin >();
+		float fPredictedSecondsToPhotonsFromNow = reader.ReadValue< float >();
+		const bool pTrackedDevicePoseArray_present = reader.ReadVarint() != 0;
+		uint32_t unTrackedDevicePoseArrayCount = reader.ReadValue< uint32_t >();
+		std::vector< struct vr::TrackedDevicePose_t > pTrackedDevicePoseArray_data( pTrackedDevicePoseArray_present ? (uint32_t)unTrackedDevicePoseArrayCount : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->GetDeviceToAbsoluteTrackingPose( eOrigin, fPredictedSecondsToPhotonsFromNow, pTrackedDevicePoseArray_present ? pTrackedDevicePoseArray_data.data() : NULL, unTrackedDevicePoseArrayCount );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 11: // IVRSystem::ResetSeatedZeroPose
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->ResetSeatedZeroPose();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 12: // IVRSystem::GetSeatedZeroPoseToStandingAbsoluteTrackingPose
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		struct vr::HmdMatrix34_t result = static_cast< vr::IVRSystem * >( pInterface )->GetSeatedZeroPoseToStandingAbsoluteTrackingPose();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const struct vr::HmdMatrix34_t recorded = reader.ReadValue< struct vr::HmdMatrix34_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 13: // IVRSystem::GetRawZeroPoseToStandingAbsoluteTrackingPose
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		struct vr::HmdMatrix34_t result = static_cast< vr::IVRSystem * >( pInterface )->GetRawZeroPoseToStandingAbsoluteTrackingPose();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const struct vr::HmdMatrix34_t recorded = reader.ReadValue< struct vr::HmdMatrix34_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 14: // IVRSystem::GetSortedTrackedDeviceIndicesOfClass
+	{
+		vr::ETrackedDeviceClass eTrackedDeviceClass = reader.ReadValue< vr::ETrackedDeviceClass >();
+		const bool punTrackedDeviceIndexArray_present = reader.ReadVarint() != 0;
+		uint32_t unTrackedDeviceIndexArrayCount = reader.ReadValue< uint32_t >();
+		vr::TrackedDeviceIndex_t unRelativeToTrackedDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		std::vector< vr::TrackedDeviceIndex_t > punTrackedDeviceIndexArray_data( punTrackedDeviceIndexArray_present ? (uint32_t)unTrackedDeviceIndexArrayCount : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRSystem * >( pInterface )->GetSortedTrackedDeviceIndicesOfClass( eTrackedDeviceClass, punTrackedDeviceIndexArray_present ? punTrackedDeviceIndexArray_data.data() : NULL, unTrackedDeviceIndexArrayCount, unRelativeToTrackedDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 15: // IVRSystem::GetTrackedDeviceActivityLevel
+	{
+		vr::TrackedDeviceIndex_t unDeviceId = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EDeviceActivityLevel result = static_cast< vr::IVRSystem * >( pInterface )->GetTrackedDeviceActivityLevel( unDeviceId );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EDeviceActivityLevel recorded = reader.ReadValue< vr::EDeviceActivityLevel >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 16: // IVRSystem::ApplyTransform
+	{
+		const bool pOutputPose_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::TrackedDevicePose_t > pTrackedDevicePose_data;
+		const bool pTrackedDevicePose_present = reader.ReadArray( pTrackedDevicePose_data );
+		std::vector< struct vr::HmdMatrix34_t > pTransform_data;
+		const bool pTransform_present = reader.ReadArray( pTransform_data );
+		std::vector< struct vr::TrackedDevicePose_t > pOutputPose_data( pOutputPose_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->ApplyTransform( pOutputPose_present ? pOutputPose_data.data() : NULL, pTrackedDevicePose_present ? pTrackedDevicePose_data.data() : NULL, pTransform_present ? pTransform_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 17: // IVRSystem::GetTrackedDeviceIndexForControllerRole
+	{
+		vr::ETrackedControllerRole unDeviceType = reader.ReadValue< vr::ETrackedControllerRole >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::TrackedDeviceIndex_t result = static_cast< vr::IVRSystem * >( pInterface )->GetTrackedDeviceIndexForControllerRole( unDeviceType );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::TrackedDeviceIndex_t recorded = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 18: // IVRSystem::GetControllerRoleForTrackedDeviceIndex
+	{
+		vr::TrackedDeviceIndex_t unDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::ETrackedControllerRole result = static_cast< vr::IVRSystem * >( pInterface )->GetControllerRoleForTrackedDeviceIndex( unDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::ETrackedControllerRole recorded = reader.ReadValue< vr::ETrackedControllerRole >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 19: // IVRSystem::GetTrackedDeviceClass
+	{
+		vr::TrackedDeviceIndex_t unDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::ETrackedDeviceClass result = static_cast< vr::IVRSystem * >( pInterface )->GetTrackedDeviceClass( unDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::ETrackedDeviceClass recorded = reader.ReadValue< vr::ETrackedDeviceClass >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 20: // IVRSystem::IsTrackedDeviceConnected
+	{
+		vr::TrackedDeviceIndex_t unDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSystem * >( pInterface )->IsTrackedDeviceConnected( unDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 21: // IVRSystem::GetBoolTrackedDeviceProperty
+	{
+		vr::TrackedDeviceIndex_t unDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		vr::ETrackedDeviceProperty prop = reader.ReadValue< vr::ETrackedDeviceProperty >();
+		const bool pError_present = reader.ReadVarint() != 0;
+		std::vector< vr::ETrackedPropertyError > pError_data( pError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSystem * >( pInterface )->GetBoolTrackedDeviceProperty( unDeviceIndex, prop, pError_present ? pError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 22: // IVRSystem::GetFloatTrackedDeviceProperty
+	{
+		vr::TrackedDeviceIndex_t unDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		vr::ETrackedDeviceProperty prop = reader.ReadValue< vr::ETrackedDeviceProperty >();
+		const bool pError_present = reader.ReadVarint() != 0;
+		std::vector< vr::ETrackedPropertyError > pError_data( pError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		float result = static_cast< vr::IVRSystem * >( pInterface )->GetFloatTrackedDeviceProperty( unDeviceIndex, prop, pError_present ? pError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const float recorded = reader.ReadValue< float >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 23: // IVRSystem::GetInt32TrackedDeviceProperty
+	{
+		vr::TrackedDeviceIndex_t unDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		vr::ETrackedDeviceProperty prop = reader.ReadValue< vr::ETrackedDeviceProperty >();
+		const bool pError_present = reader.ReadVarint() != 0;
+		std::vector< vr::ETrackedPropertyError > pError_data( pError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		int32_t result = static_cast< vr::IVRSystem * >( pInterface )->GetInt32TrackedDeviceProperty( unDeviceIndex, prop, pError_present ? pError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const int32_t recorded = reader.ReadValue< int32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 24: // IVRSystem::GetUint64TrackedDeviceProperty
+	{
+		vr::TrackedDeviceIndex_t unDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		vr::ETrackedDeviceProperty prop = reader.ReadValue< vr::ETrackedDeviceProperty >();
+		const bool pError_present = reader.ReadVarint() != 0;
+		std::vector< vr::ETrackedPropertyError > pError_data( pError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint64_t result = static_cast< vr::IVRSystem * >( pInterface )->GetUint64TrackedDeviceProperty( unDeviceIndex, prop, pError_present ? pError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint64_t recorded = reader.ReadValue< uint64_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 25: // IVRSystem::GetMatrix34TrackedDeviceProperty
+	{
+		vr::TrackedDeviceIndex_t unDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		vr::ETrackedDeviceProperty prop = reader.ReadValue< vr::ETrackedDeviceProperty >();
+		const bool pError_present = reader.ReadVarint() != 0;
+		std::vector< vr::ETrackedPropertyError > pError_data( pError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		struct vr::HmdMatrix34_t result = static_cast< vr::IVRSystem * >( pInterface )->GetMatrix34TrackedDeviceProperty( unDeviceIndex, prop, pError_present ? pError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const struct vr::HmdMatrix34_t recorded = reader.ReadValue< struct vr::HmdMatrix34_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 26: // IVRSystem::GetStringTrackedDeviceProperty
+	{
+		vr::TrackedDeviceIndex_t unDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		vr::ETrackedDeviceProperty prop = reader.ReadValue< vr::ETrackedDeviceProperty >();
+		const bool pchValue_present = reader.ReadVarint() != 0;
+		uint32_t unBufferSize = reader.ReadValue< uint32_t >();
+		const bool pError_present = reader.ReadVarint() != 0;
+		std::vector< char > pchValue_data( pchValue_present ? unBufferSize : 0 );
+		std::vector< vr::ETrackedPropertyError > pError_data( pError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRSystem * >( pInterface )->GetStringTrackedDeviceProperty( unDeviceIndex, prop, pchValue_present ? pchValue_data.data() : NULL, unBufferSize, pError_present ? pError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 27: // IVRSystem::GetPropErrorNameFromEnum
+	{
+		vr::ETrackedPropertyError error = reader.ReadValue< vr::ETrackedPropertyError >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		const char * result = static_cast< vr::IVRSystem * >( pInterface )->GetPropErrorNameFromEnum( error );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const char *recorded = reader.ReadString();
+		*pbReturnDiffered = recorded && result ? strcmp( recorded, result ) != 0 : recorded != result;
+		return reader.IsValid();
+	}
+
+	case 28: // IVRSystem::PollNextEvent
+	{
+		const bool pEvent_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::VREvent_t > pEvent_data( pEvent_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSystem * >( pInterface )->PollNextEvent( pEvent_present ? pEvent_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 29: // IVRSystem::PollNextEventWithPose
+	{
+		vr::ETrackingUniverseOrigin eOrigin = reader.ReadValue< vr::ETrackingUniverseOrigin >();
+		const bool pEvent_present = reader.ReadVarint() != 0;
+		const bool pTrackedDevicePose_present = reader.ReadVarint() != 0;
+		std::vector< vr::VREvent_t > pEvent_data( pEvent_present ? 1 : 0 );
+		std::vector< vr::TrackedDevicePose_t > pTrackedDevicePose_data( pTrackedDevicePose_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSystem * >( pInterface )->PollNextEventWithPose( eOrigin, pEvent_present ? pEvent_data.data() : NULL, pTrackedDevicePose_present ? pTrackedDevicePose_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 30: // IVRSystem::GetEventTypeNameFromEnum
+	{
+		vr::EVREventType eType = reader.ReadValue< vr::EVREventType >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		const char * result = static_cast< vr::IVRSystem * >( pInterface )->GetEventTypeNameFromEnum( eType );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const char *recorded = reader.ReadString();
+		*pbReturnDiffered = recorded && result ? strcmp( recorded, result ) != 0 : recorded != result;
+		return reader.IsValid();
+	}
+
+	case 31: // IVRSystem::GetHiddenAreaMesh
+	{
+		vr::EVREye eEye = reader.ReadValue< vr::EVREye >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->GetHiddenAreaMesh( eEye );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 32: // IVRSystem::GetControllerState
+	{
+		vr::TrackedDeviceIndex_t unControllerDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		const bool pControllerState_present = reader.ReadVarint() != 0;
+		std::vector< vr::VRControllerState_t > pControllerState_data( pControllerState_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSystem * >( pInterface )->GetControllerState( unControllerDeviceIndex, pControllerState_present ? pControllerState_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 33: // IVRSystem::GetControllerStateWithPose
+	{
+		vr::ETrackingUniverseOrigin eOrigin = reader.ReadValue< vr::ETrackingUniverseOrigin >();
+		vr::TrackedDeviceIndex_t unControllerDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		const bool pControllerState_present = reader.ReadVarint() != 0;
+		const bool pTrackedDevicePose_present = reader.ReadVarint() != 0;
+		std::vector< vr::VRControllerState_t > pControllerState_data( pControllerState_present ? 1 : 0 );
+		std::vector< struct vr::TrackedDevicePose_t > pTrackedDevicePose_data( pTrackedDevicePose_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSystem * >( pInterface )->GetControllerStateWithPose( eOrigin, unControllerDeviceIndex, pControllerState_present ? pControllerState_data.data() : NULL, pTrackedDevicePose_present ? pTrackedDevicePose_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 34: // IVRSystem::TriggerHapticPulse
+	{
+		vr::TrackedDeviceIndex_t unControllerDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		uint32_t unAxisId = reader.ReadValue< uint32_t >();
+		unsigned short usDurationMicroSec = reader.ReadValue< unsigned short >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->TriggerHapticPulse( unControllerDeviceIndex, unAxisId, usDurationMicroSec );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 35: // IVRSystem::GetButtonIdNameFromEnum
+	{
+		vr::EVRButtonId eButtonId = reader.ReadValue< vr::EVRButtonId >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		const char * result = static_cast< vr::IVRSystem * >( pInterface )->GetButtonIdNameFromEnum( eButtonId );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const char *recorded = reader.ReadString();
+		*pbReturnDiffered = recorded && result ? strcmp( recorded, result ) != 0 : recorded != result;
+		return reader.IsValid();
+	}
+
+	case 36: // IVRSystem::GetControllerAxisTypeNameFromEnum
+	{
+		vr::EVRControllerAxisType eAxisType = reader.ReadValue< vr::EVRControllerAxisType >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		const char * result = static_cast< vr::IVRSystem * >( pInterface )->GetControllerAxisTypeNameFromEnum( eAxisType );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const char *recorded = reader.ReadString();
+		*pbReturnDiffered = recorded && result ? strcmp( recorded, result ) != 0 : recorded != result;
+		return reader.IsValid();
+	}
+
+	case 37: // IVRSystem::CaptureInputFocus
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSystem * >( pInterface )->CaptureInputFocus();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 38: // IVRSystem::ReleaseInputFocus
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->ReleaseInputFocus();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 39: // IVRSystem::IsInputFocusCapturedByAnotherProcess
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSystem * >( pInterface )->IsInputFocusCapturedByAnotherProcess();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 40: // IVRSystem::DriverDebugRequest
+	{
+		vr::TrackedDeviceIndex_t unDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		const char *pchRequest = reader.ReadString();
+		const bool pchResponseBuffer_present = reader.ReadVarint() != 0;
+		uint32_t unResponseBufferSize = reader.ReadValue< uint32_t >();
+		std::vector< char > pchResponseBuffer_data( pchResponseBuffer_present ? unResponseBufferSize : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRSystem * >( pInterface )->DriverDebugRequest( unDeviceIndex, pchRequest, pchResponseBuffer_present ? pchResponseBuffer_data.data() : NULL, unResponseBufferSize );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 41: // IVRSystem::PerformFirmwareUpdate
+	{
+		vr::TrackedDeviceIndex_t unDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRFirmwareError result = static_cast< vr::IVRSystem * >( pInterface )->PerformFirmwareUpdate( unDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRFirmwareError recorded = reader.ReadValue< vr::EVRFirmwareError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 42: // IVRSystem::AcknowledgeQuit_Exiting
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->AcknowledgeQuit_Exiting();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 43: // IVRSystem::AcknowledgeQuit_UserPrompt
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->AcknowledgeQuit_UserPrompt();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 44: // IVRSystem::PerformanceTestEnableCapture
+	{
+		bool bEnable = reader.ReadValue< bool >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->PerformanceTestEnableCapture( bEnable );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 45: // IVRSystem::PerformanceTestReportFidelityLevelChange
+	{
+		int nFidelityLevel = reader.ReadValue< int >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSystem * >( pInterface )->PerformanceTestReportFidelityLevelChange( nFidelityLevel );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 46: // IVRExtendedDisplay::GetWindowBounds
+	{
+		const bool pnX_present = reader.ReadVarint() != 0;
+		const bool pnY_present = reader.ReadVarint() != 0;
+		const bool pnWidth_present = reader.ReadVarint() != 0;
+		const bool pnHeight_present = reader.ReadVarint() != 0;
+		std::vector< int32_t > pnX_data( pnX_present ? 1 : 0 );
+		std::vector< int32_t > pnY_data( pnY_present ? 1 : 0 );
+		std::vector< uint32_t > pnWidth_data( pnWidth_present ? 1 : 0 );
+		std::vector< uint32_t > pnHeight_data( pnHeight_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRExtendedDisplay * >( pInterface )->GetWindowBounds( pnX_present ? pnX_data.data() : NULL, pnY_present ? pnY_data.data() : NULL, pnWidth_present ? pnWidth_data.data() : NULL, pnHeight_present ? pnHeight_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 47: // IVRExtendedDisplay::GetEyeOutputViewport
+	{
+		vr::EVREye eEye = reader.ReadValue< vr::EVREye >();
+		const bool pnX_present = reader.ReadVarint() != 0;
+		const bool pnY_present = reader.ReadVarint() != 0;
+		const bool pnWidth_present = reader.ReadVarint() != 0;
+		const bool pnHeight_present = reader.ReadVarint() != 0;
+		std::vector< uint32_t > pnX_data( pnX_present ? 1 : 0 );
+		std::vector< uint32_t > pnY_data( pnY_present ? 1 : 0 );
+		std::vector< uint32_t > pnWidth_data( pnWidth_present ? 1 : 0 );
+		std::vector< uint32_t > pnHeight_data( pnHeight_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRExtendedDisplay * >( pInterface )->GetEyeOutputViewport( eEye, pnX_present ? pnX_data.data() : NULL, pnY_present ? pnY_data.data() : NULL, pnWidth_present ? pnWidth_data.data() : NULL, pnHeight_present ? pnHeight_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 48: // IVRExtendedDisplay::GetDXGIOutputInfo
+	{
+		const bool pnAdapterIndex_present = reader.ReadVarint() != 0;
+		const bool pnAdapterOutputIndex_present = reader.ReadVarint() != 0;
+		std::vector< int32_t > pnAdapterIndex_data( pnAdapterIndex_present ? 1 : 0 );
+		std::vector< int32_t > pnAdapterOutputIndex_data( pnAdapterOutputIndex_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRExtendedDisplay * >( pInterface )->GetDXGIOutputInfo( pnAdapterIndex_present ? pnAdapterIndex_data.data() : NULL, pnAdapterOutputIndex_present ? pnAdapterOutputIndex_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 49: // IVRApplications::AddApplicationManifest
+	{
+		const char *pchApplicationManifestFullPath = reader.ReadString();
+		bool bTemporary = reader.ReadValue< bool >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRApplicationError result = static_cast< vr::IVRApplications * >( pInterface )->AddApplicationManifest( pchApplicationManifestFullPath, bTemporary );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRApplicationError recorded = reader.ReadValue< vr::EVRApplicationError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 50: // IVRApplications::RemoveApplicationManifest
+	{
+		const char *pchApplicationManifestFullPath = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRApplicationError result = static_cast< vr::IVRApplications * >( pInterface )->RemoveApplicationManifest( pchApplicationManifestFullPath );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRApplicationError recorded = reader.ReadValue< vr::EVRApplicationError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 51: // IVRApplications::IsApplicationInstalled
+	{
+		const char *pchAppKey = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRApplications * >( pInterface )->IsApplicationInstalled( pchAppKey );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 52: // IVRApplications::GetApplicationCount
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRApplications * >( pInterface )->GetApplicationCount();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 53: // IVRApplications::GetApplicationKeyByIndex
+	{
+		uint32_t unApplicationIndex = reader.ReadValue< uint32_t >();
+		const bool pchAppKeyBuffer_present = reader.ReadVarint() != 0;
+		uint32_t unAppKeyBufferLen = reader.ReadValue< uint32_t >();
+		std::vector< char > pchAppKeyBuffer_data( pchAppKeyBuffer_present ? unAppKeyBufferLen : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRApplicationError result = static_cast< vr::IVRApplications * >( pInterface )->GetApplicationKeyByIndex( unApplicationIndex, pchAppKeyBuffer_present ? pchAppKeyBuffer_data.data() : NULL, unAppKeyBufferLen );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRApplicationError recorded = reader.ReadValue< vr::EVRApplicationError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 54: // IVRApplications::GetApplicationKeyByProcessId
+	{
+		uint32_t unProcessId = reader.ReadValue< uint32_t >();
+		const bool pchAppKeyBuffer_present = reader.ReadVarint() != 0;
+		uint32_t unAppKeyBufferLen = reader.ReadValue< uint32_t >();
+		std::vector< char > pchAppKeyBuffer_data( pchAppKeyBuffer_present ? unAppKeyBufferLen : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRApplicationError result = static_cast< vr::IVRApplications * >( pInterface )->GetApplicationKeyByProcessId( unProcessId, pchAppKeyBuffer_present ? pchAppKeyBuffer_data.data() : NULL, unAppKeyBufferLen );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRApplicationError recorded = reader.ReadValue< vr::EVRApplicationError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 55: // IVRApplications::LaunchApplication
+	{
+		const char *pchAppKey = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRApplicationError result = static_cast< vr::IVRApplications * >( pInterface )->LaunchApplication( pchAppKey );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRApplicationError recorded = reader.ReadValue< vr::EVRApplicationError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 56: // IVRApplications::LaunchDashboardOverlay
+	{
+		const char *pchAppKey = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRApplicationError result = static_cast< vr::IVRApplications * >( pInterface )->LaunchDashboardOverlay( pchAppKey );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRApplicationError recorded = reader.ReadValue< vr::EVRApplicationError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 57: // IVRApplications::IdentifyApplication
+	{
+		uint32_t unProcessId = reader.ReadValue< uint32_t >();
+		const char *pchAppKey = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRApplicationError result = static_cast< vr::IVRApplications * >( pInterface )->IdentifyApplication( unProcessId, pchAppKey );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRApplicationError recorded = reader.ReadValue< vr::EVRApplicationError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 58: // IVRApplications::GetApplicationProcessId
+	{
+		const char *pchAppKey = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRApplications * >( pInterface )->GetApplicationProcessId( pchAppKey );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 59: // IVRApplications::GetApplicationsErrorNameFromEnum
+	{
+		vr::EVRApplicationError error = reader.ReadValue< vr::EVRApplicationError >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		const char * result = static_cast< vr::IVRApplications * >( pInterface )->GetApplicationsErrorNameFromEnum( error );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const char *recorded = reader.ReadString();
+		*pbReturnDiffered = recorded && result ? strcmp( recorded, result ) != 0 : recorded != result;
+		return reader.IsValid();
+	}
+
+	case 60: // IVRApplications::GetApplicationPropertyString
+	{
+		const char *pchAppKey = reader.ReadString();
+		vr::EVRApplicationProperty eProperty = reader.ReadValue< vr::EVRApplicationProperty >();
+		const bool pchPropertyValueBuffer_present = reader.ReadVarint() != 0;
+		uint32_t unPropertyValueBufferLen = reader.ReadValue< uint32_t >();
+		const bool peError_present = reader.ReadVarint() != 0;
+		std::vector< char > pchPropertyValueBuffer_data( pchPropertyValueBuffer_present ? unPropertyValueBufferLen : 0 );
+		std::vector< vr::EVRApplicationError > peError_data( peError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRApplications * >( pInterface )->GetApplicationPropertyString( pchAppKey, eProperty, pchPropertyValueBuffer_present ? pchPropertyValueBuffer_data.data() : NULL, unPropertyValueBufferLen, peError_present ? peError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 61: // IVRApplications::GetApplicationPropertyBool
+	{
+		const char *pchAppKey = reader.ReadString();
+		vr::EVRApplicationProperty eProperty = reader.ReadValue< vr::EVRApplicationProperty >();
+		const bool peError_present = reader.ReadVarint() != 0;
+		std::vector< vr::EVRApplicationError > peError_data( peError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRApplications * >( pInterface )->GetApplicationPropertyBool( pchAppKey, eProperty, peError_present ? peError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 62: // IVRApplications::SetApplicationAutoLaunch
+	{
+		const char *pchAppKey = reader.ReadString();
+		bool bAutoLaunch = reader.ReadValue< bool >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRApplicationError result = static_cast< vr::IVRApplications * >( pInterface )->SetApplicationAutoLaunch( pchAppKey, bAutoLaunch );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRApplicationError recorded = reader.ReadValue< vr::EVRApplicationError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 63: // IVRApplications::GetApplicationAutoLaunch
+	{
+		const char *pchAppKey = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRApplications * >( pInterface )->GetApplicationAutoLaunch( pchAppKey );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 64: // IVRApplications::GetStartingApplication
+	{
+		const bool pchAppKeyBuffer_present = reader.ReadVarint() != 0;
+		uint32_t unAppKeyBufferLen = reader.ReadValue< uint32_t >();
+		std::vector< char > pchAppKeyBuffer_data( pchAppKeyBuffer_present ? unAppKeyBufferLen : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRApplicationError result = static_cast< vr::IVRApplications * >( pInterface )->GetStartingApplication( pchAppKeyBuffer_present ? pchAppKeyBuffer_data.data() : NULL, unAppKeyBufferLen );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRApplicationError recorded = reader.ReadValue< vr::EVRApplicationError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 65: // IVRApplications::GetTransitionState
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRApplicationTransitionState result = static_cast< vr::IVRApplications * >( pInterface )->GetTransitionState();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRApplicationTransitionState recorded = reader.ReadValue< vr::EVRApplicationTransitionState >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 66: // IVRApplications::PerformApplicationPrelaunchCheck
+	{
+		const char *pchAppKey = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRApplicationError result = static_cast< vr::IVRApplications * >( pInterface )->PerformApplicationPrelaunchCheck( pchAppKey );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRApplicationError recorded = reader.ReadValue< vr::EVRApplicationError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 67: // IVRApplications::GetApplicationsTransitionStateNameFromEnum
+	{
+		vr::EVRApplicationTransitionState state = reader.ReadValue< vr::EVRApplicationTransitionState >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		const char * result = static_cast< vr::IVRApplications * >( pInterface )->GetApplicationsTransitionStateNameFromEnum( state );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const char *recorded = reader.ReadString();
+		*pbReturnDiffered = recorded && result ? strcmp( recorded, result ) != 0 : recorded != result;
+		return reader.IsValid();
+	}
+
+	case 68: // IVRApplications::IsQuitUserPromptRequested
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRApplications * >( pInterface )->IsQuitUserPromptRequested();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 69: // IVRChaperone::GetCalibrationState
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::ChaperoneCalibrationState result = static_cast< vr::IVRChaperone * >( pInterface )->GetCalibrationState();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::ChaperoneCalibrationState recorded = reader.ReadValue< vr::ChaperoneCalibrationState >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 70: // IVRChaperone::GetPlayAreaSize
+	{
+		const bool pSizeX_present = reader.ReadVarint() != 0;
+		const bool pSizeZ_present = reader.ReadVarint() != 0;
+		std::vector< float > pSizeX_data( pSizeX_present ? 1 : 0 );
+		std::vector< float > pSizeZ_data( pSizeZ_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperone * >( pInterface )->GetPlayAreaSize( pSizeX_present ? pSizeX_data.data() : NULL, pSizeZ_present ? pSizeZ_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 71: // IVRChaperone::GetPlayAreaRect
+	{
+		const bool rect_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::HmdQuad_t > rect_data( rect_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperone * >( pInterface )->GetPlayAreaRect( rect_present ? rect_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 72: // IVRChaperone::ReloadInfo
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRChaperone * >( pInterface )->ReloadInfo();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 73: // IVRChaperone::SetSceneColor
+	{
+		struct vr::HmdColor_t color = reader.ReadValue< struct vr::HmdColor_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRChaperone * >( pInterface )->SetSceneColor( color );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 74: // IVRChaperone::GetBoundsColor
+	{
+		const bool pOutputColorArray_present = reader.ReadVarint() != 0;
+		int nNumOutputColors = reader.ReadValue< int >();
+		float flCollisionBoundsFadeDistance = reader.ReadValue< float >();
+		const bool pOutputCameraColor_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::HmdColor_t > pOutputColorArray_data( pOutputColorArray_present ? (uint32_t)nNumOutputColors : 0 );
+		std::vector< struct vr::HmdColor_t > pOutputCameraColor_data( pOutputCameraColor_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRChaperone * >( pInterface )->GetBoundsColor( pOutputColorArray_present ? pOutputColorArray_data.data() : NULL, nNumOutputColors, flCollisionBoundsFadeDistance, pOutputCameraColor_present ? pOutputCameraColor_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 75: // IVRChaperone::AreBoundsVisible
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperone * >( pInterface )->AreBoundsVisible();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 76: // IVRChaperone::ForceBoundsVisible
+	{
+		bool bForce = reader.ReadValue< bool >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRChaperone * >( pInterface )->ForceBoundsVisible( bForce );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 77: // IVRChaperoneSetup::CommitWorkingCopy
+	{
+		vr::EChaperoneConfigFile configFile = reader.ReadValue< vr::EChaperoneConfigFile >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperoneSetup * >( pInterface )->CommitWorkingCopy( configFile );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 78: // IVRChaperoneSetup::RevertWorkingCopy
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRChaperoneSetup * >( pInterface )->RevertWorkingCopy();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 79: // IVRChaperoneSetup::GetWorkingPlayAreaSize
+	{
+		const bool pSizeX_present = reader.ReadVarint() != 0;
+		const bool pSizeZ_present = reader.ReadVarint() != 0;
+		std::vector< float > pSizeX_data( pSizeX_present ? 1 : 0 );
+		std::vector< float > pSizeZ_data( pSizeZ_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperoneSetup * >( pInterface )->GetWorkingPlayAreaSize( pSizeX_present ? pSizeX_data.data() : NULL, pSizeZ_present ? pSizeZ_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 80: // IVRChaperoneSetup::GetWorkingPlayAreaRect
+	{
+		const bool rect_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::HmdQuad_t > rect_data( rect_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperoneSetup * >( pInterface )->GetWorkingPlayAreaRect( rect_present ? rect_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 81: // IVRChaperoneSetup::GetWorkingCollisionBoundsInfo
+	{
+		const bool pQuadsBuffer_present = reader.ReadVarint() != 0;
+		std::vector< uint32_t > punQuadsCount_data;
+		const bool punQuadsCount_present = reader.ReadArray( punQuadsCount_data );
+		std::vector< struct vr::HmdQuad_t > pQuadsBuffer_data( pQuadsBuffer_present && punQuadsCount_data.size() == 1 ? punQuadsCount_data[0] : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperoneSetup * >( pInterface )->GetWorkingCollisionBoundsInfo( pQuadsBuffer_present ? pQuadsBuffer_data.data() : NULL, punQuadsCount_present ? punQuadsCount_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 82: // IVRChaperoneSetup::GetLiveCollisionBoundsInfo
+	{
+		const bool pQuadsBuffer_present = reader.ReadVarint() != 0;
+		std::vector< uint32_t > punQuadsCount_data;
+		const bool punQuadsCount_present = reader.ReadArray( punQuadsCount_data );
+		std::vector< struct vr::HmdQuad_t > pQuadsBuffer_data( pQuadsBuffer_present && punQuadsCount_data.size() == 1 ? punQuadsCount_data[0] : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperoneSetup * >( pInterface )->GetLiveCollisionBoundsInfo( pQuadsBuffer_present ? pQuadsBuffer_data.data() : NULL, punQuadsCount_present ? punQuadsCount_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 83: // IVRChaperoneSetup::GetWorkingSeatedZeroPoseToRawTrackingPose
+	{
+		const bool pmatSeatedZeroPoseToRawTrackingPose_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::HmdMatrix34_t > pmatSeatedZeroPoseToRawTrackingPose_data( pmatSeatedZeroPoseToRawTrackingPose_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperoneSetup * >( pInterface )->GetWorkingSeatedZeroPoseToRawTrackingPose( pmatSeatedZeroPoseToRawTrackingPose_present ? pmatSeatedZeroPoseToRawTrackingPose_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 84: // IVRChaperoneSetup::GetWorkingStandingZeroPoseToRawTrackingPose
+	{
+		const bool pmatStandingZeroPoseToRawTrackingPose_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::HmdMatrix34_t > pmatStandingZeroPoseToRawTrackingPose_data( pmatStandingZeroPoseToRawTrackingPose_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperoneSetup * >( pInterface )->GetWorkingStandingZeroPoseToRawTrackingPose( pmatStandingZeroPoseToRawTrackingPose_present ? pmatStandingZeroPoseToRawTrackingPose_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 85: // IVRChaperoneSetup::SetWorkingPlayAreaSize
+	{
+		float sizeX = reader.ReadValue< float >();
+		float sizeZ = reader.ReadValue< float >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRChaperoneSetup * >( pInterface )->SetWorkingPlayAreaSize( sizeX, sizeZ );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 86: // IVRChaperoneSetup::SetWorkingCollisionBoundsInfo
+	{
+		std::vector< struct vr::HmdQuad_t > pQuadsBuffer_data;
+		const bool pQuadsBuffer_present = reader.ReadArray( pQuadsBuffer_data );
+		uint32_t unQuadsCount = reader.ReadValue< uint32_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRChaperoneSetup * >( pInterface )->SetWorkingCollisionBoundsInfo( pQuadsBuffer_present ? pQuadsBuffer_data.data() : NULL, unQuadsCount );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 87: // IVRChaperoneSetup::SetWorkingSeatedZeroPoseToRawTrackingPose
+	{
+		std::vector< struct vr::HmdMatrix34_t > pMatSeatedZeroPoseToRawTrackingPose_data;
+		const bool pMatSeatedZeroPoseToRawTrackingPose_present = reader.ReadArray( pMatSeatedZeroPoseToRawTrackingPose_data );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRChaperoneSetup * >( pInterface )->SetWorkingSeatedZeroPoseToRawTrackingPose( pMatSeatedZeroPoseToRawTrackingPose_present ? pMatSeatedZeroPoseToRawTrackingPose_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 88: // IVRChaperoneSetup::SetWorkingStandingZeroPoseToRawTrackingPose
+	{
+		std::vector< struct vr::HmdMatrix34_t > pMatStandingZeroPoseToRawTrackingPose_data;
+		const bool pMatStandingZeroPoseToRawTrackingPose_present = reader.ReadArray( pMatStandingZeroPoseToRawTrackingPose_data );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRChaperoneSetup * >( pInterface )->SetWorkingStandingZeroPoseToRawTrackingPose( pMatStandingZeroPoseToRawTrackingPose_present ? pMatStandingZeroPoseToRawTrackingPose_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 89: // IVRChaperoneSetup::ReloadFromDisk
+	{
+		vr::EChaperoneConfigFile configFile = reader.ReadValue< vr::EChaperoneConfigFile >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRChaperoneSetup * >( pInterface )->ReloadFromDisk( configFile );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 90: // IVRChaperoneSetup::GetLiveSeatedZeroPoseToRawTrackingPose
+	{
+		const bool pmatSeatedZeroPoseToRawTrackingPose_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::HmdMatrix34_t > pmatSeatedZeroPoseToRawTrackingPose_data( pmatSeatedZeroPoseToRawTrackingPose_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperoneSetup * >( pInterface )->GetLiveSeatedZeroPoseToRawTrackingPose( pmatSeatedZeroPoseToRawTrackingPose_present ? pmatSeatedZeroPoseToRawTrackingPose_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 91: // IVRChaperoneSetup::SetWorkingWallTagInfo
+	{
+		std::vector< uint8_t > pTagsBuffer_data;
+		const bool pTagsBuffer_present = reader.ReadArray( pTagsBuffer_data );
+		uint32_t unTagCount = reader.ReadValue< uint32_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRChaperoneSetup * >( pInterface )->SetWorkingWallTagInfo( pTagsBuffer_present ? pTagsBuffer_data.data() : NULL, unTagCount );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 92: // IVRChaperoneSetup::GetLiveWallTagInfo
+	{
+		const bool pTagsBuffer_present = reader.ReadVarint() != 0;
+		std::vector< uint32_t > punTagCount_data;
+		const bool punTagCount_present = reader.ReadArray( punTagCount_data );
+		std::vector< uint8_t > pTagsBuffer_data( pTagsBuffer_present && punTagCount_data.size() == 1 ? punTagCount_data[0] : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRChaperoneSetup * >( pInterface )->GetLiveWallTagInfo( pTagsBuffer_present ? pTagsBuffer_data.data() : NULL, punTagCount_present ? punTagCount_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 93: // IVRCompositor::SetTrackingSpace
+	{
+		vr::ETrackingUniverseOrigin eOrigin = reader.ReadValue< vr::ETrackingUniverseOrigin >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->SetTrackingSpace( eOrigin );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 94: // IVRCompositor::GetTrackingSpace
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::ETrackingUniverseOrigin result = static_cast< vr::IVRCompositor * >( pInterface )->GetTrackingSpace();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::ETrackingUniverseOrigin recorded = reader.ReadValue< vr::ETrackingUniverseOrigin >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 95: // IVRCompositor::WaitGetPoses
+	{
+		const bool pRenderPoseArray_present = reader.ReadVarint() != 0;
+		uint32_t unRenderPoseArrayCount = reader.ReadValue< uint32_t >();
+		const bool pGamePoseArray_present = reader.ReadVarint() != 0;
+		uint32_t unGamePoseArrayCount = reader.ReadValue< uint32_t >();
+		std::vector< struct vr::TrackedDevicePose_t > pRenderPoseArray_data( pRenderPoseArray_present ? (uint32_t)unRenderPoseArrayCount : 0 );
+		std::vector< struct vr::TrackedDevicePose_t > pGamePoseArray_data( pGamePoseArray_present ? (uint32_t)unGamePoseArrayCount : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRCompositorError result = static_cast< vr::IVRCompositor * >( pInterface )->WaitGetPoses( pRenderPoseArray_present ? pRenderPoseArray_data.data() : NULL, unRenderPoseArrayCount, pGamePoseArray_present ? pGamePoseArray_data.data() : NULL, unGamePoseArrayCount );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRCompositorError recorded = reader.ReadValue< vr::EVRCompositorError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 96: // IVRCompositor::GetLastPoses
+	{
+		const bool pRenderPoseArray_present = reader.ReadVarint() != 0;
+		uint32_t unRenderPoseArrayCount = reader.ReadValue< uint32_t >();
+		const bool pGamePoseArray_present = reader.ReadVarint() != 0;
+		uint32_t unGamePoseArrayCount = reader.ReadValue< uint32_t >();
+		std::vector< struct vr::TrackedDevicePose_t > pRenderPoseArray_data( pRenderPoseArray_present ? (uint32_t)unRenderPoseArrayCount : 0 );
+		std::vector< struct vr::TrackedDevicePose_t > pGamePoseArray_data( pGamePoseArray_present ? (uint32_t)unGamePoseArrayCount : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRCompositorError result = static_cast< vr::IVRCompositor * >( pInterface )->GetLastPoses( pRenderPoseArray_present ? pRenderPoseArray_data.data() : NULL, unRenderPoseArrayCount, pGamePoseArray_present ? pGamePoseArray_data.data() : NULL, unGamePoseArrayCount );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRCompositorError recorded = reader.ReadValue< vr::EVRCompositorError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 98: // IVRCompositor::ClearLastSubmittedFrame
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->ClearLastSubmittedFrame();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 99: // IVRCompositor::PostPresentHandoff
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->PostPresentHandoff();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 100: // IVRCompositor::GetFrameTiming
+	{
+		const bool pTiming_present = reader.ReadVarint() != 0;
+		uint32_t unFramesAgo = reader.ReadValue< uint32_t >();
+		std::vector< struct vr::Compositor_FrameTiming > pTiming_data( pTiming_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRCompositor * >( pInterface )->GetFrameTiming( pTiming_present ? pTiming_data.data() : NULL, unFramesAgo );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 101: // IVRCompositor::GetFrameTimeRemaining
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		float result = static_cast< vr::IVRCompositor * >( pInterface )->GetFrameTimeRemaining();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const float recorded = reader.ReadValue< float >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 102: // IVRCompositor::FadeToColor
+	{
+		float fSeconds = reader.ReadValue< float >();
+		float fRed = reader.ReadValue< float >();
+		float fGreen = reader.ReadValue< float >();
+		float fBlue = reader.ReadValue< float >();
+		float fAlpha = reader.ReadValue< float >();
+		bool bBackground = reader.ReadValue< bool >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->FadeToColor( fSeconds, fRed, fGreen, fBlue, fAlpha, bBackground );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 103: // IVRCompositor::FadeGrid
+	{
+		float fSeconds = reader.ReadValue< float >();
+		bool bFadeIn = reader.ReadValue< bool >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->FadeGrid( fSeconds, bFadeIn );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 105: // IVRCompositor::ClearSkyboxOverride
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->ClearSkyboxOverride();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 106: // IVRCompositor::CompositorBringToFront
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->CompositorBringToFront();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 107: // IVRCompositor::CompositorGoToBack
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->CompositorGoToBack();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 108: // IVRCompositor::CompositorQuit
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->CompositorQuit();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 109: // IVRCompositor::IsFullscreen
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRCompositor * >( pInterface )->IsFullscreen();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 110: // IVRCompositor::GetCurrentSceneFocusProcess
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRCompositor * >( pInterface )->GetCurrentSceneFocusProcess();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 111: // IVRCompositor::GetLastFrameRenderer
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRCompositor * >( pInterface )->GetLastFrameRenderer();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 112: // IVRCompositor::CanRenderScene
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRCompositor * >( pInterface )->CanRenderScene();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 113: // IVRCompositor::ShowMirrorWindow
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->ShowMirrorWindow();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 114: // IVRCompositor::HideMirrorWindow
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->HideMirrorWindow();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 115: // IVRCompositor::IsMirrorWindowVisible
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRCompositor * >( pInterface )->IsMirrorWindowVisible();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 116: // IVRCompositor::CompositorDumpImages
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRCompositor * >( pInterface )->CompositorDumpImages();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 117: // IVROverlay::FindOverlay
+	{
+		const char *pchOverlayKey = reader.ReadString();
+		const bool pOverlayHandle_present = reader.ReadVarint() != 0;
+		std::vector< vr::VROverlayHandle_t > pOverlayHandle_data( pOverlayHandle_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->FindOverlay( pchOverlayKey, pOverlayHandle_present ? pOverlayHandle_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		std::vector< vr::VROverlayHandle_t > pOverlayHandle_recorded;
+		reader.ReadArray( pOverlayHandle_recorded );
+		if ( pOverlayHandle_recorded.size() == 1 && pOverlayHandle_data.size() == 1 )
+			Replay_AddHandle( pOverlayHandle_recorded[0], pOverlayHandle_data[0] );
+		return reader.IsValid();
+	}
+
+	case 118: // IVROverlay::CreateOverlay
+	{
+		const char *pchOverlayKey = reader.ReadString();
+		const char *pchOverlayFriendlyName = reader.ReadString();
+		const bool pOverlayHandle_present = reader.ReadVarint() != 0;
+		std::vector< vr::VROverlayHandle_t > pOverlayHandle_data( pOverlayHandle_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->CreateOverlay( pchOverlayKey, pchOverlayFriendlyName, pOverlayHandle_present ? pOverlayHandle_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		std::vector< vr::VROverlayHandle_t > pOverlayHandle_recorded;
+		reader.ReadArray( pOverlayHandle_recorded );
+		if ( pOverlayHandle_recorded.size() == 1 && pOverlayHandle_data.size() == 1 )
+			Replay_AddHandle( pOverlayHandle_recorded[0], pOverlayHandle_data[0] );
+		return reader.IsValid();
+	}
+
+	case 119: // IVROverlay::DestroyOverlay
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->DestroyOverlay( ulOverlayHandle );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 120: // IVROverlay::SetHighQualityOverlay
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetHighQualityOverlay( ulOverlayHandle );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 121: // IVROverlay::GetHighQualityOverlay
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::VROverlayHandle_t result = static_cast< vr::IVROverlay * >( pInterface )->GetHighQualityOverlay();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::VROverlayHandle_t recorded = reader.ReadValue< vr::VROverlayHandle_t >();
+		Replay_AddHandle( recorded, result );
+		return reader.IsValid();
+	}
+
+	case 122: // IVROverlay::GetOverlayKey
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool pchValue_present = reader.ReadVarint() != 0;
+		uint32_t unBufferSize = reader.ReadValue< uint32_t >();
+		const bool pError_present = reader.ReadVarint() != 0;
+		std::vector< char > pchValue_data( pchValue_present ? unBufferSize : 0 );
+		std::vector< vr::EVROverlayError > pError_data( pError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayKey( ulOverlayHandle, pchValue_present ? pchValue_data.data() : NULL, unBufferSize, pError_present ? pError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 123: // IVROverlay::GetOverlayName
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool pchValue_present = reader.ReadVarint() != 0;
+		uint32_t unBufferSize = reader.ReadValue< uint32_t >();
+		const bool pError_present = reader.ReadVarint() != 0;
+		std::vector< char > pchValue_data( pchValue_present ? unBufferSize : 0 );
+		std::vector< vr::EVROverlayError > pError_data( pError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayName( ulOverlayHandle, pchValue_present ? pchValue_data.data() : NULL, unBufferSize, pError_present ? pError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 125: // IVROverlay::GetOverlayErrorNameFromEnum
+	{
+		vr::EVROverlayError error = reader.ReadValue< vr::EVROverlayError >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		const char * result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayErrorNameFromEnum( error );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const char *recorded = reader.ReadString();
+		*pbReturnDiffered = recorded && result ? strcmp( recorded, result ) != 0 : recorded != result;
+		return reader.IsValid();
+	}
+
+	case 126: // IVROverlay::SetOverlayFlag
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		vr::VROverlayFlags eOverlayFlag = reader.ReadValue< vr::VROverlayFlags >();
+		bool bEnabled = reader.ReadValue< bool >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayFlag( ulOverlayHandle, eOverlayFlag, bEnabled );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 127: // IVROverlay::GetOverlayFlag
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		vr::VROverlayFlags eOverlayFlag = reader.ReadValue< vr::VROverlayFlags >();
+		const bool pbEnabled_present = reader.ReadVarint() != 0;
+		std::vector< uint8_t > pbEnabled_data( pbEnabled_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayFlag( ulOverlayHandle, eOverlayFlag, pbEnabled_present ? reinterpret_cast< bool * >( pbEnabled_data.data() ) : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 128: // IVROverlay::SetOverlayColor
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		float fRed = reader.ReadValue< float >();
+		float fGreen = reader.ReadValue< float >();
+		float fBlue = reader.ReadValue< float >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayColor( ulOverlayHandle, fRed, fGreen, fBlue );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 129: // IVROverlay::GetOverlayColor
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool pfRed_present = reader.ReadVarint() != 0;
+		const bool pfGreen_present = reader.ReadVarint() != 0;
+		const bool pfBlue_present = reader.ReadVarint() != 0;
+		std::vector< float > pfRed_data( pfRed_present ? 1 : 0 );
+		std::vector< float > pfGreen_data( pfGreen_present ? 1 : 0 );
+		std::vector< float > pfBlue_data( pfBlue_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayColor( ulOverlayHandle, pfRed_present ? pfRed_data.data() : NULL, pfGreen_present ? pfGreen_data.data() : NULL, pfBlue_present ? pfBlue_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 130: // IVROverlay::SetOverlayAlpha
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		float fAlpha = reader.ReadValue< float >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayAlpha( ulOverlayHandle, fAlpha );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 131: // IVROverlay::GetOverlayAlpha
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool pfAlpha_present = reader.ReadVarint() != 0;
+		std::vector< float > pfAlpha_data( pfAlpha_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayAlpha( ulOverlayHandle, pfAlpha_present ? pfAlpha_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 132: // IVROverlay::SetOverlayWidthInMeters
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		float fWidthInMeters = reader.ReadValue< float >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayWidthInMeters( ulOverlayHandle, fWidthInMeters );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 133: // IVROverlay::GetOverlayWidthInMeters
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool pfWidthInMeters_present = reader.ReadVarint() != 0;
+		std::vector< float > pfWidthInMeters_data( pfWidthInMeters_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayWidthInMeters( ulOverlayHandle, pfWidthInMeters_present ? pfWidthInMeters_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 134: // IVROverlay::SetOverlayAutoCurveDistanceRangeInMeters
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		float fMinDistanceInMeters = reader.ReadValue< float >();
+		float fMaxDistanceInMeters = reader.ReadValue< float >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayAutoCurveDistanceRangeInMeters( ulOverlayHandle, fMinDistanceInMeters, fMaxDistanceInMeters );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 135: // IVROverlay::GetOverlayAutoCurveDistanceRangeInMeters
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool pfMinDistanceInMeters_present = reader.ReadVarint() != 0;
+		const bool pfMaxDistanceInMeters_present = reader.ReadVarint() != 0;
+		std::vector< float > pfMinDistanceInMeters_data( pfMinDistanceInMeters_present ? 1 : 0 );
+		std::vector< float > pfMaxDistanceInMeters_data( pfMaxDistanceInMeters_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayAutoCurveDistanceRangeInMeters( ulOverlayHandle, pfMinDistanceInMeters_present ? pfMinDistanceInMeters_data.data() : NULL, pfMaxDistanceInMeters_present ? pfMaxDistanceInMeters_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 136: // IVROverlay::SetOverlayTextureColorSpace
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		vr::EColorSpace eTextureColorSpace = reader.ReadValue< vr::EColorSpace >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayTextureColorSpace( ulOverlayHandle, eTextureColorSpace );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 137: // IVROverlay::GetOverlayTextureColorSpace
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool peTextureColorSpace_present = reader.ReadVarint() != 0;
+		std::vector< vr::EColorSpace > peTextureColorSpace_data( peTextureColorSpace_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayTextureColorSpace( ulOverlayHandle, peTextureColorSpace_present ? peTextureColorSpace_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 138: // IVROverlay::SetOverlayTextureBounds
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		std::vector< struct vr::VRTextureBounds_t > pOverlayTextureBounds_data;
+		const bool pOverlayTextureBounds_present = reader.ReadArray( pOverlayTextureBounds_data );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayTextureBounds( ulOverlayHandle, pOverlayTextureBounds_present ? pOverlayTextureBounds_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 139: // IVROverlay::GetOverlayTextureBounds
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool pOverlayTextureBounds_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::VRTextureBounds_t > pOverlayTextureBounds_data( pOverlayTextureBounds_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayTextureBounds( ulOverlayHandle, pOverlayTextureBounds_present ? pOverlayTextureBounds_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 140: // IVROverlay::GetOverlayTransformType
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool peTransformType_present = reader.ReadVarint() != 0;
+		std::vector< vr::VROverlayTransformType > peTransformType_data( peTransformType_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayTransformType( ulOverlayHandle, peTransformType_present ? peTransformType_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 141: // IVROverlay::SetOverlayTransformAbsolute
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		vr::ETrackingUniverseOrigin eTrackingOrigin = reader.ReadValue< vr::ETrackingUniverseOrigin >();
+		std::vector< struct vr::HmdMatrix34_t > pmatTrackingOriginToOverlayTransform_data;
+		const bool pmatTrackingOriginToOverlayTransform_present = reader.ReadArray( pmatTrackingOriginToOverlayTransform_data );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayTransformAbsolute( ulOverlayHandle, eTrackingOrigin, pmatTrackingOriginToOverlayTransform_present ? pmatTrackingOriginToOverlayTransform_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 142: // IVROverlay::GetOverlayTransformAbsolute
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool peTrackingOrigin_present = reader.ReadVarint() != 0;
+		const bool pmatTrackingOriginToOverlayTransform_present = reader.ReadVarint() != 0;
+		std::vector< vr::ETrackingUniverseOrigin > peTrackingOrigin_data( peTrackingOrigin_present ? 1 : 0 );
+		std::vector< struct vr::HmdMatrix34_t > pmatTrackingOriginToOverlayTransform_data( pmatTrackingOriginToOverlayTransform_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayTransformAbsolute( ulOverlayHandle, peTrackingOrigin_present ? peTrackingOrigin_data.data() : NULL, pmatTrackingOriginToOverlayTransform_present ? pmatTrackingOriginToOverlayTransform_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 143: // IVROverlay::SetOverlayTransformTrackedDeviceRelative
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		vr::TrackedDeviceIndex_t unTrackedDevice = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		std::vector< struct vr::HmdMatrix34_t > pmatTrackedDeviceToOverlayTransform_data;
+		const bool pmatTrackedDeviceToOverlayTransform_present = reader.ReadArray( pmatTrackedDeviceToOverlayTransform_data );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayTransformTrackedDeviceRelative( ulOverlayHandle, unTrackedDevice, pmatTrackedDeviceToOverlayTransform_present ? pmatTrackedDeviceToOverlayTransform_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 144: // IVROverlay::GetOverlayTransformTrackedDeviceRelative
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool punTrackedDevice_present = reader.ReadVarint() != 0;
+		const bool pmatTrackedDeviceToOverlayTransform_present = reader.ReadVarint() != 0;
+		std::vector< vr::TrackedDeviceIndex_t > punTrackedDevice_data( punTrackedDevice_present ? 1 : 0 );
+		std::vector< struct vr::HmdMatrix34_t > pmatTrackedDeviceToOverlayTransform_data( pmatTrackedDeviceToOverlayTransform_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayTransformTrackedDeviceRelative( ulOverlayHandle, punTrackedDevice_present ? punTrackedDevice_data.data() : NULL, pmatTrackedDeviceToOverlayTransform_present ? pmatTrackedDeviceToOverlayTransform_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 145: // IVROverlay::ShowOverlay
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->ShowOverlay( ulOverlayHandle );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 146: // IVROverlay::HideOverlay
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->HideOverlay( ulOverlayHandle );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 147: // IVROverlay::IsOverlayVisible
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVROverlay * >( pInterface )->IsOverlayVisible( ulOverlayHandle );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 148: // IVROverlay::GetTransformForOverlayCoordinates
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		vr::ETrackingUniverseOrigin eTrackingOrigin = reader.ReadValue< vr::ETrackingUniverseOrigin >();
+		struct vr::HmdVector2_t coordinatesInOverlay = reader.ReadValue< struct vr::HmdVector2_t >();
+		const bool pmatTransform_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::HmdMatrix34_t > pmatTransform_data( pmatTransform_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetTransformForOverlayCoordinates( ulOverlayHandle, eTrackingOrigin, coordinatesInOverlay, pmatTransform_present ? pmatTransform_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 149: // IVROverlay::PollNextOverlayEvent
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool pEvent_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::VREvent_t > pEvent_data( pEvent_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVROverlay * >( pInterface )->PollNextOverlayEvent( ulOverlayHandle, pEvent_present ? pEvent_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 150: // IVROverlay::GetOverlayInputMethod
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool peInputMethod_present = reader.ReadVarint() != 0;
+		std::vector< vr::VROverlayInputMethod > peInputMethod_data( peInputMethod_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayInputMethod( ulOverlayHandle, peInputMethod_present ? peInputMethod_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 151: // IVROverlay::SetOverlayInputMethod
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		vr::VROverlayInputMethod eInputMethod = reader.ReadValue< vr::VROverlayInputMethod >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayInputMethod( ulOverlayHandle, eInputMethod );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 152: // IVROverlay::GetOverlayMouseScale
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool pvecMouseScale_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::HmdVector2_t > pvecMouseScale_data( pvecMouseScale_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetOverlayMouseScale( ulOverlayHandle, pvecMouseScale_present ? pvecMouseScale_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 153: // IVROverlay::SetOverlayMouseScale
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		std::vector< struct vr::HmdVector2_t > pvecMouseScale_data;
+		const bool pvecMouseScale_present = reader.ReadArray( pvecMouseScale_data );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayMouseScale( ulOverlayHandle, pvecMouseScale_present ? pvecMouseScale_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 154: // IVROverlay::ComputeOverlayIntersection
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		std::vector< struct vr::VROverlayIntersectionParams_t > pParams_data;
+		const bool pParams_present = reader.ReadArray( pParams_data );
+		const bool pResults_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::VROverlayIntersectionResults_t > pResults_data( pResults_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVROverlay * >( pInterface )->ComputeOverlayIntersection( ulOverlayHandle, pParams_present ? pParams_data.data() : NULL, pResults_present ? pResults_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 155: // IVROverlay::HandleControllerOverlayInteractionAsMouse
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		vr::TrackedDeviceIndex_t unControllerDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVROverlay * >( pInterface )->HandleControllerOverlayInteractionAsMouse( ulOverlayHandle, unControllerDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 156: // IVROverlay::IsHoverTargetOverlay
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVROverlay * >( pInterface )->IsHoverTargetOverlay( ulOverlayHandle );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 157: // IVROverlay::GetGamepadFocusOverlay
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::VROverlayHandle_t result = static_cast< vr::IVROverlay * >( pInterface )->GetGamepadFocusOverlay();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::VROverlayHandle_t recorded = reader.ReadValue< vr::VROverlayHandle_t >();
+		Replay_AddHandle( recorded, result );
+		return reader.IsValid();
+	}
+
+	case 158: // IVROverlay::SetGamepadFocusOverlay
+	{
+		vr::VROverlayHandle_t ulNewFocusOverlay = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetGamepadFocusOverlay( ulNewFocusOverlay );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 159: // IVROverlay::SetOverlayNeighbor
+	{
+		vr::EOverlayDirection eDirection = reader.ReadValue< vr::EOverlayDirection >();
+		vr::VROverlayHandle_t ulFrom = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		vr::VROverlayHandle_t ulTo = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayNeighbor( eDirection, ulFrom, ulTo );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 160: // IVROverlay::MoveGamepadFocusToNeighbor
+	{
+		vr::EOverlayDirection eDirection = reader.ReadValue< vr::EOverlayDirection >();
+		vr::VROverlayHandle_t ulFrom = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->MoveGamepadFocusToNeighbor( eDirection, ulFrom );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 162: // IVROverlay::ClearOverlayTexture
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->ClearOverlayTexture( ulOverlayHandle );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 164: // IVROverlay::SetOverlayFromFile
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const char *pchFilePath = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetOverlayFromFile( ulOverlayHandle, pchFilePath );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 165: // IVROverlay::CreateDashboardOverlay
+	{
+		const char *pchOverlayKey = reader.ReadString();
+		const char *pchOverlayFriendlyName = reader.ReadString();
+		const bool pMainHandle_present = reader.ReadVarint() != 0;
+		const bool pThumbnailHandle_present = reader.ReadVarint() != 0;
+		std::vector< vr::VROverlayHandle_t > pMainHandle_data( pMainHandle_present ? 1 : 0 );
+		std::vector< vr::VROverlayHandle_t > pThumbnailHandle_data( pThumbnailHandle_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->CreateDashboardOverlay( pchOverlayKey, pchOverlayFriendlyName, pMainHandle_present ? pMainHandle_data.data() : NULL, pThumbnailHandle_present ? pThumbnailHandle_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		std::vector< vr::VROverlayHandle_t > pMainHandle_recorded;
+		reader.ReadArray( pMainHandle_recorded );
+		if ( pMainHandle_recorded.size() == 1 && pMainHandle_data.size() == 1 )
+			Replay_AddHandle( pMainHandle_recorded[0], pMainHandle_data[0] );
+		std::vector< vr::VROverlayHandle_t > pThumbnailHandle_recorded;
+		reader.ReadArray( pThumbnailHandle_recorded );
+		if ( pThumbnailHandle_recorded.size() == 1 && pThumbnailHandle_data.size() == 1 )
+			Replay_AddHandle( pThumbnailHandle_recorded[0], pThumbnailHandle_data[0] );
+		return reader.IsValid();
+	}
+
+	case 166: // IVROverlay::IsDashboardVisible
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVROverlay * >( pInterface )->IsDashboardVisible();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 167: // IVROverlay::IsActiveDashboardOverlay
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVROverlay * >( pInterface )->IsActiveDashboardOverlay( ulOverlayHandle );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 168: // IVROverlay::SetDashboardOverlaySceneProcess
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		uint32_t unProcessId = reader.ReadValue< uint32_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->SetDashboardOverlaySceneProcess( ulOverlayHandle, unProcessId );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 169: // IVROverlay::GetDashboardOverlaySceneProcess
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		const bool punProcessId_present = reader.ReadVarint() != 0;
+		std::vector< uint32_t > punProcessId_data( punProcessId_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->GetDashboardOverlaySceneProcess( ulOverlayHandle, punProcessId_present ? punProcessId_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 170: // IVROverlay::ShowDashboard
+	{
+		const char *pchOverlayToShow = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVROverlay * >( pInterface )->ShowDashboard( pchOverlayToShow );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 171: // IVROverlay::ShowKeyboard
+	{
+		vr::EGamepadTextInputMode eInputMode = reader.ReadValue< vr::EGamepadTextInputMode >();
+		vr::EGamepadTextInputLineMode eLineInputMode = reader.ReadValue< vr::EGamepadTextInputLineMode >();
+		const char *pchDescription = reader.ReadString();
+		uint32_t unCharMax = reader.ReadValue< uint32_t >();
+		const char *pchExistingText = reader.ReadString();
+		bool bUseMinimalMode = reader.ReadValue< bool >();
+		uint64_t uUserValue = reader.ReadValue< uint64_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->ShowKeyboard( eInputMode, eLineInputMode, pchDescription, unCharMax, pchExistingText, bUseMinimalMode, uUserValue );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 172: // IVROverlay::ShowKeyboardForOverlay
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		vr::EGamepadTextInputMode eInputMode = reader.ReadValue< vr::EGamepadTextInputMode >();
+		vr::EGamepadTextInputLineMode eLineInputMode = reader.ReadValue< vr::EGamepadTextInputLineMode >();
+		const char *pchDescription = reader.ReadString();
+		uint32_t unCharMax = reader.ReadValue< uint32_t >();
+		const char *pchExistingText = reader.ReadString();
+		bool bUseMinimalMode = reader.ReadValue< bool >();
+		uint64_t uUserValue = reader.ReadValue< uint64_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVROverlayError result = static_cast< vr::IVROverlay * >( pInterface )->ShowKeyboardForOverlay( ulOverlayHandle, eInputMode, eLineInputMode, pchDescription, unCharMax, pchExistingText, bUseMinimalMode, uUserValue );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVROverlayError recorded = reader.ReadValue< vr::EVROverlayError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 173: // IVROverlay::GetKeyboardText
+	{
+		const bool pchText_present = reader.ReadVarint() != 0;
+		uint32_t cchText = reader.ReadValue< uint32_t >();
+		std::vector< char > pchText_data( pchText_present ? cchText : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVROverlay * >( pInterface )->GetKeyboardText( pchText_present ? pchText_data.data() : NULL, cchText );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 174: // IVROverlay::HideKeyboard
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVROverlay * >( pInterface )->HideKeyboard();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 175: // IVROverlay::SetKeyboardTransformAbsolute
+	{
+		vr::ETrackingUniverseOrigin eTrackingOrigin = reader.ReadValue< vr::ETrackingUniverseOrigin >();
+		std::vector< struct vr::HmdMatrix34_t > pmatTrackingOriginToKeyboardTransform_data;
+		const bool pmatTrackingOriginToKeyboardTransform_present = reader.ReadArray( pmatTrackingOriginToKeyboardTransform_data );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVROverlay * >( pInterface )->SetKeyboardTransformAbsolute( eTrackingOrigin, pmatTrackingOriginToKeyboardTransform_present ? pmatTrackingOriginToKeyboardTransform_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 176: // IVROverlay::SetKeyboardPositionForOverlay
+	{
+		vr::VROverlayHandle_t ulOverlayHandle = (vr::VROverlayHandle_t)Replay_MapHandle( reader.ReadValue< vr::VROverlayHandle_t >() );
+		struct vr::HmdRect2_t avoidRect = reader.ReadValue< struct vr::HmdRect2_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVROverlay * >( pInterface )->SetKeyboardPositionForOverlay( ulOverlayHandle, avoidRect );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 181: // IVRRenderModels::GetRenderModelName
+	{
+		uint32_t unRenderModelIndex = reader.ReadValue< uint32_t >();
+		const bool pchRenderModelName_present = reader.ReadVarint() != 0;
+		uint32_t unRenderModelNameLen = reader.ReadValue< uint32_t >();
+		std::vector< char > pchRenderModelName_data( pchRenderModelName_present ? unRenderModelNameLen : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRRenderModels * >( pInterface )->GetRenderModelName( unRenderModelIndex, pchRenderModelName_present ? pchRenderModelName_data.data() : NULL, unRenderModelNameLen );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 182: // IVRRenderModels::GetRenderModelCount
+	{
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRRenderModels * >( pInterface )->GetRenderModelCount();
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 183: // IVRRenderModels::GetComponentCount
+	{
+		const char *pchRenderModelName = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRRenderModels * >( pInterface )->GetComponentCount( pchRenderModelName );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 184: // IVRRenderModels::GetComponentName
+	{
+		const char *pchRenderModelName = reader.ReadString();
+		uint32_t unComponentIndex = reader.ReadValue< uint32_t >();
+		const bool pchComponentName_present = reader.ReadVarint() != 0;
+		uint32_t unComponentNameLen = reader.ReadValue< uint32_t >();
+		std::vector< char > pchComponentName_data( pchComponentName_present ? unComponentNameLen : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRRenderModels * >( pInterface )->GetComponentName( pchRenderModelName, unComponentIndex, pchComponentName_present ? pchComponentName_data.data() : NULL, unComponentNameLen );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 185: // IVRRenderModels::GetComponentButtonMask
+	{
+		const char *pchRenderModelName = reader.ReadString();
+		const char *pchComponentName = reader.ReadString();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint64_t result = static_cast< vr::IVRRenderModels * >( pInterface )->GetComponentButtonMask( pchRenderModelName, pchComponentName );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint64_t recorded = reader.ReadValue< uint64_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 186: // IVRRenderModels::GetComponentRenderModelName
+	{
+		const char *pchRenderModelName = reader.ReadString();
+		const char *pchComponentName = reader.ReadString();
+		const bool pchComponentRenderModelName_present = reader.ReadVarint() != 0;
+		uint32_t unComponentRenderModelNameLen = reader.ReadValue< uint32_t >();
+		std::vector< char > pchComponentRenderModelName_data( pchComponentRenderModelName_present ? unComponentRenderModelNameLen : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		uint32_t result = static_cast< vr::IVRRenderModels * >( pInterface )->GetComponentRenderModelName( pchRenderModelName, pchComponentName, pchComponentRenderModelName_present ? pchComponentRenderModelName_data.data() : NULL, unComponentRenderModelNameLen );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const uint32_t recorded = reader.ReadValue< uint32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 187: // IVRRenderModels::GetComponentState
+	{
+		const char *pchRenderModelName = reader.ReadString();
+		const char *pchComponentName = reader.ReadString();
+		std::vector< vr::VRControllerState_t > pControllerState_data;
+		const bool pControllerState_present = reader.ReadArray( pControllerState_data );
+		const bool pComponentState_present = reader.ReadVarint() != 0;
+		std::vector< struct vr::RenderModel_ComponentState_t > pComponentState_data( pComponentState_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRRenderModels * >( pInterface )->GetComponentState( pchRenderModelName, pchComponentName, pControllerState_present ? pControllerState_data.data() : NULL, pComponentState_present ? pComponentState_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 189: // IVRNotifications::RemoveNotification
+	{
+		vr::VRNotificationId notificationId = (vr::VRNotificationId)Replay_MapHandle( reader.ReadValue< vr::VRNotificationId >() );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::EVRNotificationError result = static_cast< vr::IVRNotifications * >( pInterface )->RemoveNotification( notificationId );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::EVRNotificationError recorded = reader.ReadValue< vr::EVRNotificationError >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 190: // IVRSettings::GetSettingsErrorNameFromEnum
+	{
+		vr::EVRSettingsError eError = reader.ReadValue< vr::EVRSettingsError >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		const char * result = static_cast< vr::IVRSettings * >( pInterface )->GetSettingsErrorNameFromEnum( eError );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const char *recorded = reader.ReadString();
+		*pbReturnDiffered = recorded && result ? strcmp( recorded, result ) != 0 : recorded != result;
+		return reader.IsValid();
+	}
+
+	case 191: // IVRSettings::Sync
+	{
+		const bool peError_present = reader.ReadVarint() != 0;
+		std::vector< vr::EVRSettingsError > peError_data( peError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSettings * >( pInterface )->Sync( peError_present ? peError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 192: // IVRSettings::GetBool
+	{
+		const char *pchSection = reader.ReadString();
+		const char *pchSettingsKey = reader.ReadString();
+		bool bDefaultValue = reader.ReadValue< bool >();
+		const bool peError_present = reader.ReadVarint() != 0;
+		std::vector< vr::EVRSettingsError > peError_data( peError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRSettings * >( pInterface )->GetBool( pchSection, pchSettingsKey, bDefaultValue, peError_present ? peError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 193: // IVRSettings::SetBool
+	{
+		const char *pchSection = reader.ReadString();
+		const char *pchSettingsKey = reader.ReadString();
+		bool bValue = reader.ReadValue< bool >();
+		const bool peError_present = reader.ReadVarint() != 0;
+		std::vector< vr::EVRSettingsError > peError_data( peError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSettings * >( pInterface )->SetBool( pchSection, pchSettingsKey, bValue, peError_present ? peError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 194: // IVRSettings::GetInt32
+	{
+		const char *pchSection = reader.ReadString();
+		const char *pchSettingsKey = reader.ReadString();
+		int32_t nDefaultValue = reader.ReadValue< int32_t >();
+		const bool peError_present = reader.ReadVarint() != 0;
+		std::vector< vr::EVRSettingsError > peError_data( peError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		int32_t result = static_cast< vr::IVRSettings * >( pInterface )->GetInt32( pchSection, pchSettingsKey, nDefaultValue, peError_present ? peError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const int32_t recorded = reader.ReadValue< int32_t >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 195: // IVRSettings::SetInt32
+	{
+		const char *pchSection = reader.ReadString();
+		const char *pchSettingsKey = reader.ReadString();
+		int32_t nValue = reader.ReadValue< int32_t >();
+		const bool peError_present = reader.ReadVarint() != 0;
+		std::vector< vr::EVRSettingsError > peError_data( peError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSettings * >( pInterface )->SetInt32( pchSection, pchSettingsKey, nValue, peError_present ? peError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 196: // IVRSettings::GetFloat
+	{
+		const char *pchSection = reader.ReadString();
+		const char *pchSettingsKey = reader.ReadString();
+		float flDefaultValue = reader.ReadValue< float >();
+		const bool peError_present = reader.ReadVarint() != 0;
+		std::vector< vr::EVRSettingsError > peError_data( peError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		float result = static_cast< vr::IVRSettings * >( pInterface )->GetFloat( pchSection, pchSettingsKey, flDefaultValue, peError_present ? peError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const float recorded = reader.ReadValue< float >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 197: // IVRSettings::SetFloat
+	{
+		const char *pchSection = reader.ReadString();
+		const char *pchSettingsKey = reader.ReadString();
+		float flValue = reader.ReadValue< float >();
+		const bool peError_present = reader.ReadVarint() != 0;
+		std::vector< vr::EVRSettingsError > peError_data( peError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSettings * >( pInterface )->SetFloat( pchSection, pchSettingsKey, flValue, peError_present ? peError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 198: // IVRSettings::GetString
+	{
+		const char *pchSection = reader.ReadString();
+		const char *pchSettingsKey = reader.ReadString();
+		const bool pchValue_present = reader.ReadVarint() != 0;
+		uint32_t unValueLen = reader.ReadValue< uint32_t >();
+		const char *pchDefaultValue = reader.ReadString();
+		const bool peError_present = reader.ReadVarint() != 0;
+		std::vector< char > pchValue_data( pchValue_present ? unValueLen : 0 );
+		std::vector< vr::EVRSettingsError > peError_data( peError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSettings * >( pInterface )->GetString( pchSection, pchSettingsKey, pchValue_present ? pchValue_data.data() : NULL, unValueLen, pchDefaultValue, peError_present ? peError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 199: // IVRSettings::SetString
+	{
+		const char *pchSection = reader.ReadString();
+		const char *pchSettingsKey = reader.ReadString();
+		const char *pchValue = reader.ReadString();
+		const bool peError_present = reader.ReadVarint() != 0;
+		std::vector< vr::EVRSettingsError > peError_data( peError_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRSettings * >( pInterface )->SetString( pchSection, pchSettingsKey, pchValue, peError_present ? peError_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 200: // IVRTrackedCamera::HasCamera
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->HasCamera( nDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 201: // IVRTrackedCamera::GetCameraFirmwareDescription
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		const bool pBuffer_present = reader.ReadVarint() != 0;
+		uint32_t nBufferLen = reader.ReadValue< uint32_t >();
+		std::vector< char > pBuffer_data( pBuffer_present ? nBufferLen : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->GetCameraFirmwareDescription( nDeviceIndex, pBuffer_present ? pBuffer_data.data() : NULL, nBufferLen );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 202: // IVRTrackedCamera::GetCameraFrameDimensions
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		vr::ECameraVideoStreamFormat nVideoStreamFormat = reader.ReadValue< vr::ECameraVideoStreamFormat >();
+		const bool pWidth_present = reader.ReadVarint() != 0;
+		const bool pHeight_present = reader.ReadVarint() != 0;
+		std::vector< uint32_t > pWidth_data( pWidth_present ? 1 : 0 );
+		std::vector< uint32_t > pHeight_data( pHeight_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->GetCameraFrameDimensions( nDeviceIndex, nVideoStreamFormat, pWidth_present ? pWidth_data.data() : NULL, pHeight_present ? pHeight_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 203: // IVRTrackedCamera::SetCameraVideoStreamFormat
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		vr::ECameraVideoStreamFormat nVideoStreamFormat = reader.ReadValue< vr::ECameraVideoStreamFormat >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->SetCameraVideoStreamFormat( nDeviceIndex, nVideoStreamFormat );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 204: // IVRTrackedCamera::GetCameraVideoStreamFormat
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		vr::ECameraVideoStreamFormat result = static_cast< vr::IVRTrackedCamera * >( pInterface )->GetCameraVideoStreamFormat( nDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const vr::ECameraVideoStreamFormat recorded = reader.ReadValue< vr::ECameraVideoStreamFormat >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 205: // IVRTrackedCamera::EnableCameraForStreaming
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		bool bEnable = reader.ReadValue< bool >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->EnableCameraForStreaming( nDeviceIndex, bEnable );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 206: // IVRTrackedCamera::StartVideoStream
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->StartVideoStream( nDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 207: // IVRTrackedCamera::StopVideoStream
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->StopVideoStream( nDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 208: // IVRTrackedCamera::IsVideoStreamActive
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->IsVideoStreamActive( nDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 209: // IVRTrackedCamera::GetVideoStreamElapsedTime
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		float result = static_cast< vr::IVRTrackedCamera * >( pInterface )->GetVideoStreamElapsedTime( nDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const float recorded = reader.ReadValue< float >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 210: // IVRTrackedCamera::GetVideoStreamFrame
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		static_cast< vr::IVRTrackedCamera * >( pInterface )->GetVideoStreamFrame( nDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		return reader.IsValid();
+	}
+
+	case 212: // IVRTrackedCamera::SetAutoExposure
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		bool bEnable = reader.ReadValue< bool >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->SetAutoExposure( nDeviceIndex, bEnable );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 213: // IVRTrackedCamera::PauseVideoStream
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->PauseVideoStream( nDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 214: // IVRTrackedCamera::ResumeVideoStream
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->ResumeVideoStream( nDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 215: // IVRTrackedCamera::IsVideoStreamPaused
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->IsVideoStreamPaused( nDeviceIndex );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 216: // IVRTrackedCamera::GetCameraDistortion
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		float flInputU = reader.ReadValue< float >();
+		float flInputV = reader.ReadValue< float >();
+		const bool pflOutputU_present = reader.ReadVarint() != 0;
+		const bool pflOutputV_present = reader.ReadVarint() != 0;
+		std::vector< float > pflOutputU_data( pflOutputU_present ? 1 : 0 );
+		std::vector< float > pflOutputV_data( pflOutputV_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->GetCameraDistortion( nDeviceIndex, flInputU, flInputV, pflOutputU_present ? pflOutputU_data.data() : NULL, pflOutputV_present ? pflOutputV_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	case 217: // IVRTrackedCamera::GetCameraProjection
+	{
+		vr::TrackedDeviceIndex_t nDeviceIndex = reader.ReadValue< vr::TrackedDeviceIndex_t >();
+		float flWidthPixels = reader.ReadValue< float >();
+		float flHeightPixels = reader.ReadValue< float >();
+		float flZNear = reader.ReadValue< float >();
+		float flZFar = reader.ReadValue< float >();
+		const bool pProjection_present = reader.ReadVarint() != 0;
+		std::vector< vr::HmdMatrix44_t > pProjection_data( pProjection_present ? 1 : 0 );
+		if ( !reader.IsValid() )
+			return false;
+
+		const uint64_t ulStartTicks = Trace_GetTimestamp();
+		bool result = static_cast< vr::IVRTrackedCamera * >( pInterface )->GetCameraProjection( nDeviceIndex, flWidthPixels, flHeightPixels, flZNear, flZFar, pProjection_present ? pProjection_data.data() : NULL );
+		*pulTicks = Trace_GetTimestamp() - ulStartTicks;
+		const bool recorded = reader.ReadValue< bool >();
+		*pbReturnDiffered = memcmp( &recorded, &result, sizeof( result ) ) != 0;
+		return reader.IsValid();
+	}
+
+	default:
+		return false;
+	}
+}
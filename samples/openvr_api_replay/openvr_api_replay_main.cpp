@@ -0,0 +1,321 @@
+//========= Copyright Valve Corporation ============//
+//
+// Re-issues the calls in a capture written by the openvr_api profiler (VR_CAPTURE_FILE)
+// against whatever openvr_api library this is run with, at the times they were recorded,
+// and compares each method's latency with the recording. Run it against the real runtime
+// to check a runtime change, or against a stand-in library to test without a headset.
+//
+// Calls that passed textures or raw buffers were captured as timing only and are skipped.
+//
+#include "openvr_api_replay.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openvr.h>
+
+#include "shared/tracebuffer.h"
+
+// within this much of a call's time the replay spins instead of sleeping, since sleeps are coarse
+static const uint64_t k_ulSpinNs = 2000000;
+
+static std::unordered_map< uint64_t, uint64_t > s_mapHandles;
+
+/** Latencies of one captured method, in nanoseconds */
+struct ReplayStats_t
+{
+	uint64_t ulCalls;
+	uint64_t ulSkipped;
+	uint64_t ulFailed;
+	uint64_t ulReturnDiffered;
+	uint64_t ulRecordedTotalNs;
+	std::vector< uint64_t > vecRecordedNs;
+	std::vector< uint64_t > vecReplayedNs;
+
+	ReplayStats_t() : ulCalls( 0 ), ulSkipped( 0 ), ulFailed( 0 ), ulReturnDiffered( 0 ), ulRecordedTotalNs( 0 ) {}
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+uint64_t Replay_MapHandle( uint64_t ulRecorded )
+{
+	std::unordered_map< uint64_t, uint64_t >::const_iterator i = s_mapHandles.find( ulRecorded );
+	return i == s_mapHandles.end() ? ulRecorded : i->second;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void Replay_AddHandle( uint64_t ulRecorded, uint64_t ulReplayed )
+{
+	s_mapHandles[ ulRecorded ] = ulReplayed;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Index of the method with this name on this interface version, or -1
+//-----------------------------------------------------------------------------
+static int FindReplayMethod( const ApiCaptureMethod_t &method )
+{
+	for ( uint32_t i = 0; i < g_unReplayMethodCount; i++ )
+	{
+		if ( method.sName == g_rReplayMethods[i].pchName && method.sInterfaceVersion == g_rpchReplayInterfaceVersions[ g_rReplayMethods[i].nInterface ] )
+			return (int)i;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Sorts vecNs in place
+//-----------------------------------------------------------------------------
+static double GetPercentileUs( std::vector< uint64_t > &vecNs, double flFraction )
+{
+	if ( vecNs.empty() )
+		return 0.0;
+
+	std::sort( vecNs.begin(), vecNs.end() );
+	const size_t unIndex = std::min( vecNs.size() - 1, (size_t)( vecNs.size() * flFraction ) );
+	return vecNs[ unIndex ] / 1000.0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static double GetMeanUs( const std::vector< uint64_t > &vecNs )
+{
+	if ( vecNs.empty() )
+		return 0.0;
+
+	uint64_t ulTotalNs = 0;
+	for ( uint64_t ulNs : vecNs )
+		ulTotalNs += ulNs;
+	return ulTotalNs / 1000.0 / vecNs.size();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Writes every replayed method, most recorded time first
+//-----------------------------------------------------------------------------
+static void WriteReport( FILE *f, const std::vector< ApiCaptureMethod_t > &vecMethods, std::vector< ReplayStats_t > &vecStats )
+{
+	std::vector< uint32_t > vecCalled;
+	for ( uint32_t i = 0; i < vecStats.size(); i++ )
+	{
+		if ( vecStats[i].ulCalls )
+			vecCalled.push_back( i );
+	}
+	std::sort( vecCalled.begin(), vecCalled.end(), [&vecStats]( uint32_t a, uint32_t b )
+	{
+		return vecStats[a].ulRecordedTotalNs > vecStats[b].ulRecordedTotalNs;
+	} );
+
+	fprintf( f, "%10s %8s %8s %10s %10s %10s %10s %10s %10s  %s\n", "calls", "skipped", "differed",
+		"rec mean", "rec p99", "rec max", "mean us", "p99 us", "max us", "method" );
+
+	for ( uint32_t unMethod : vecCalled )
+	{
+		ReplayStats_t &stats = vecStats[ unMethod ];
+		const double flRecordedMeanUs = GetMeanUs( stats.vecRecordedNs );
+		const double flReplayedMeanUs = GetMeanUs( stats.vecReplayedNs );
+		fprintf( f, "%10llu %8llu %8llu %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f  %s%s\n",
+			(unsigned long long)stats.ulCalls,
+			(unsigned long long)stats.ulSkipped,
+			(unsigned long long)stats.ulReturnDiffered,
+			flRecordedMeanUs,
+			GetPercentileUs( stats.vecRecordedNs, 0.99 ),
+			GetPercentileUs( stats.vecRecordedNs, 1.0 ),
+			flReplayedMeanUs,
+			GetPercentileUs( stats.vecReplayedNs, 0.99 ),
+			GetPercentileUs( stats.vecReplayedNs, 1.0 ),
+			vecMethods[ unMethod ].sName.c_str(),
+			stats.ulFailed ? " (malformed payloads)" : "" );
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+int main( int argc, char *argv[] )
+{
+	const char *pchCapture = NULL;
+	const char *pchReport = NULL;
+	bool bNoWait = false;
+	for ( int i = 1; i < argc; i++ )
+	{
+		if ( !strcmp( argv[i], "-nowait" ) )
+		{
+			bNoWait = true;
+		}
+		else if ( !strcmp( argv[i], "-report" ) && i + 1 < argc )
+		{
+			pchReport = argv[ ++i ];
+		}
+		else if ( argv[i][0] != '-' && !pchCapture )
+		{
+			pchCapture = argv[i];
+		}
+		else
+		{
+			pchCapture = NULL;
+			break;
+		}
+	}
+
+	if ( !pchCapture )
+	{
+		fprintf( stderr, "Usage: openvr_api_replay <capture> [-nowait] [-report <file>]\n" );
+		fprintf( stderr, "  -nowait  issue the calls back to back instead of at their recorded times\n" );
+		return 2;
+	}
+
+	CApiCaptureFile capture;
+	if ( !capture.Open( pchCapture ) )
+	{
+		fprintf( stderr, "Unable to read the capture %s\n", pchCapture );
+		return 1;
+	}
+
+	const std::vector< ApiCaptureMethod_t > &vecMethods = capture.GetMethods();
+	std::vector< int > vecReplayMethod( vecMethods.size() );
+	for ( size_t i = 0; i < vecMethods.size(); i++ )
+	{
+		vecReplayMethod[i] = FindReplayMethod( vecMethods[i] );
+		if ( vecReplayMethod[i] < 0 )
+			printf( "%s (%s) isn't in this build's openvr.h; its calls will be skipped\n", vecMethods[i].sName.c_str(), vecMethods[i].sInterfaceVersion.c_str() );
+	}
+
+	vr::EVRInitError eError = vr::VRInitError_None;
+	vr::VR_Init( &eError, (vr::EVRApplicationType)capture.GetApplicationType() );
+	if ( eError != vr::VRInitError_None )
+	{
+		fprintf( stderr, "Unable to init VR runtime: %s\n", vr::VR_GetVRInitErrorAsEnglishDescription( eError ) );
+		return 1;
+	}
+
+	const double flNsPerTick = 1000000000.0 / Trace_GetTimestampFrequency();
+	std::vector< void * > vecInterfaces( g_unReplayInterfaceCount, (void *)NULL );
+	std::vector< bool > vecInterfaceFetched( g_unReplayInterfaceCount, false );
+	std::vector< ReplayStats_t > vecStats( vecMethods.size() );
+
+	uint64_t ulRecords = 0;
+	uint64_t ulFirstStartNs = 0;
+	uint64_t ulLastEndNs = 0;
+	uint64_t ulWaited = 0;
+	uint64_t ulTotalLateNs = 0;
+	uint64_t ulMaxLateNs = 0;
+	const uint64_t ulReplayStartTicks = Trace_GetTimestamp();
+
+	ApiCaptureRecord_t record;
+	while ( capture.ReadRecord( record ) )
+	{
+		if ( ulRecords++ == 0 )
+			ulFirstStartNs = record.ulStartNs;
+		ulLastEndNs = std::max( ulLastEndNs, record.ulStartNs + record.ulDurationNs );
+
+		ReplayStats_t &stats = vecStats[ record.unMethod ];
+		stats.ulCalls++;
+		stats.ulRecordedTotalNs += record.ulDurationNs;
+		stats.vecRecordedNs.push_back( record.ulDurationNs );
+
+		const int nMethod = vecReplayMethod[ record.unMethod ];
+		if ( nMethod < 0 || !g_rReplayMethods[ nMethod ].bReplayable )
+		{
+			stats.ulSkipped++;
+			continue;
+		}
+
+		const int nInterface = g_rReplayMethods[ nMethod ].nInterface;
+		if ( !vecInterfaceFetched[ nInterface ] )
+		{
+			vr::EVRInitError eInterfaceError = vr::VRInitError_None;
+			vecInterfaces[ nInterface ] = vr::VR_GetGenericInterface( g_rpchReplayInterfaceVersions[ nInterface ], &eInterfaceError );
+			vecInterfaceFetched[ nInterface ] = true;
+			if ( !vecInterfaces[ nInterface ] )
+				printf( "Unable to get %s; its calls will be skipped\n", g_rpchReplayInterfaceVersions[ nInterface ] );
+		}
+		if ( !vecInterfaces[ nInterface ] )
+		{
+			stats.ulSkipped++;
+			continue;
+		}
+
+		// records from different threads can be slightly out of order, so only wait for later ones
+		if ( !bNoWait )
+		{
+			const uint64_t ulTargetNs = record.ulStartNs > ulFirstStartNs ? record.ulStartNs - ulFirstStartNs : 0;
+			for ( ;; )
+			{
+				const uint64_t ulNowNs = (uint64_t)( ( Trace_GetTimestamp() - ulReplayStartTicks ) * flNsPerTick );
+				if ( ulNowNs >= ulTargetNs )
+				{
+					const uint64_t ulLateNs = ulNowNs - ulTargetNs;
+					ulWaited++;
+					ulTotalLateNs += ulLateNs;
+					ulMaxLateNs = std::max( ulMaxLateNs, ulLateNs );
+					break;
+				}
+				if ( ulTargetNs - ulNowNs > k_ulSpinNs )
+					std::this_thread::sleep_for( std::chrono::nanoseconds( ulTargetNs - ulNowNs - k_ulSpinNs ) );
+				else
+					std::this_thread::yield();
+			}
+		}
+
+		CApiCaptureReader reader( record.vecPayload.empty() ? NULL : &record.vecPayload[0], record.vecPayload.size() );
+		uint64_t ulTicks = 0;
+		bool bReturnDiffered = false;
+		if ( !Replay_Call( (uint32_t)nMethod, vecInterfaces[ nInterface ], reader, &ulTicks, &bReturnDiffered ) )
+		{
+			stats.ulFailed++;
+			stats.ulSkipped++;
+			continue;
+		}
+
+		stats.vecReplayedNs.push_back( (uint64_t)( ulTicks * flNsPerTick ) );
+		if ( bReturnDiffered )
+			stats.ulReturnDiffered++;
+	}
+
+	const double flReplaySeconds = ( Trace_GetTimestamp() - ulReplayStartTicks ) * flNsPerTick / 1000000000.0;
+	vr::VR_Shutdown();
+
+	FILE *f = stdout;
+	if ( pchReport )
+	{
+#if defined( _WIN32 )
+		if ( fopen_s( &f, pchReport, "w" ) != 0 )
+			f = NULL;
+#else
+		f = fopen( pchReport, "w" );
+#endif
+		if ( f == NULL )
+		{
+			fprintf( stderr, "Unable to write %s\n", pchReport );
+			return 1;
+		}
+	}
+
+	fprintf( f, "Replayed %llu calls from %s: recorded over %.2f s, replayed in %.2f s\n", (unsigned long long)ulRecords, pchCapture,
+		ulRecords ? ( ulLastEndNs - ulFirstStartNs ) / 1000000000.0 : 0.0, flReplaySeconds );
+	if ( !bNoWait )
+		fprintf( f, "Calls started a mean %.1f us and at most %.1f us after their recorded time\n", ulWaited ? ulTotalLateNs / 1000.0 / ulWaited : 0.0, ulMaxLateNs / 1000.0 );
+	fprintf( f, "\"rec\" columns are the recording, the others this replay. Differed counts calls whose return value changed.\n\n" );
+	WriteReport( f, vecMethods, vecStats );
+
+	if ( f != stdout )
+		fclose( f );
+	return 0;
+}
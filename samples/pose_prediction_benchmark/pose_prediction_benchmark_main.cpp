@@ -0,0 +1,423 @@
+//========= Copyright Valve Corporation ============//
+//
+// Measures how far poses extrapolated from a driver's DriverPose_t land from where the
+// device really was, over a log of the poses a driver reported (see driverposelog.h;
+// motion_to_photon_sim -recordposes writes one). Each logged pose is predicted ahead by
+// every horizon in turn, the way fPredictedSecondsToPhotonsFromNow asks the runtime to,
+// and compared with the logged poses either side of the time it was predicted to.
+//
+// The runtime's own predictor is not part of the SDK, so the models here are the plain
+// extrapolations a DriverPose_t supports: none (the pose as reported), velocity, and
+// velocity plus acceleration. Angular velocity and acceleration are taken to be in
+// driver world space. What this measures is how much a driver's derivatives are worth
+// at each horizon, and how quickly the error grows with motion-to-photon latency.
+//
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openvr_driver.h>
+
+#include "shared/driverposelog.h"
+
+enum EPredictionModel
+{
+	PredictionModel_None,
+	PredictionModel_Velocity,
+	PredictionModel_Acceleration,
+	PredictionModel_Count
+};
+
+static const char *k_rpchPredictionModels[ PredictionModel_Count ] = { "none", "velocity", "acceleration" };
+
+static const double k_flPi = 3.14159265358979323846;
+
+/** A pose in app world space: the head's position in meters and orientation */
+struct WorldPose_t
+{
+	double rflPosition[ 3 ];
+	vr::HmdQuaternion_t qRotation;
+};
+
+/** Errors at one horizon for one class of device and one model */
+struct PredictionErrors_t
+{
+	std::vector< double > vecPositionMm;
+	std::vector< double > vecRotationDegrees;
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static vr::HmdQuaternion_t MultiplyQuaternions( const vr::HmdQuaternion_t &a, const vr::HmdQuaternion_t &b )
+{
+	vr::HmdQuaternion_t q;
+	q.w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z;
+	q.x = a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y;
+	q.y = a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x;
+	q.z = a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w;
+	return q;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: q * v * q^-1, for a unit q
+//-----------------------------------------------------------------------------
+static void RotateVector( const vr::HmdQuaternion_t &q, const double rflIn[ 3 ], double rflOut[ 3 ] )
+{
+	vr::HmdQuaternion_t v = { 0.0, rflIn[0], rflIn[1], rflIn[2] };
+	vr::HmdQuaternion_t qConjugate = { q.w, -q.x, -q.y, -q.z };
+	const vr::HmdQuaternion_t r = MultiplyQuaternions( MultiplyQuaternions( q, v ), qConjugate );
+	rflOut[0] = r.x;
+	rflOut[1] = r.y;
+	rflOut[2] = r.z;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: The rotation by |rflRotation| radians about rflRotation
+//-----------------------------------------------------------------------------
+static vr::HmdQuaternion_t QuaternionFromRotationVector( const double rflRotation[ 3 ] )
+{
+	const double flAngle = sqrt( rflRotation[0] * rflRotation[0] + rflRotation[1] * rflRotation[1] + rflRotation[2] * rflRotation[2] );
+	vr::HmdQuaternion_t q = { 1.0, 0.0, 0.0, 0.0 };
+	if ( flAngle < 1e-12 )
+		return q;
+
+	const double flScale = sin( flAngle * 0.5 ) / flAngle;
+	q.w = cos( flAngle * 0.5 );
+	q.x = rflRotation[0] * flScale;
+	q.y = rflRotation[1] * flScale;
+	q.z = rflRotation[2] * flScale;
+	return q;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static vr::HmdQuaternion_t NormalizeQuaternion( const vr::HmdQuaternion_t &q )
+{
+	const double flLength = sqrt( q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z );
+	if ( flLength < 1e-12 )
+	{
+		vr::HmdQuaternion_t identity = { 1.0, 0.0, 0.0, 0.0 };
+		return identity;
+	}
+	vr::HmdQuaternion_t r = { q.w / flLength, q.x / flLength, q.y / flLength, q.z / flLength };
+	return r;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: The angle between two orientations, in radians
+//-----------------------------------------------------------------------------
+static double GetRotationError( const vr::HmdQuaternion_t &a, const vr::HmdQuaternion_t &b )
+{
+	const double flDot = fabs( a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z );
+	return 2.0 * acos( std::min( 1.0, flDot ) );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Normalized lerp, which over the few milliseconds between samples
+//			is as good as a slerp
+//-----------------------------------------------------------------------------
+static vr::HmdQuaternion_t InterpolateQuaternions( const vr::HmdQuaternion_t &a, const vr::HmdQuaternion_t &b, double flFraction )
+{
+	const double flSign = ( a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z ) < 0.0 ? -1.0 : 1.0;
+	vr::HmdQuaternion_t q;
+	q.w = a.w + ( flSign * b.w - a.w ) * flFraction;
+	q.x = a.x + ( flSign * b.x - a.x ) * flFraction;
+	q.y = a.y + ( flSign * b.y - a.y ) * flFraction;
+	q.z = a.z + ( flSign * b.z - a.z ) * flFraction;
+	return NormalizeQuaternion( q );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Extrapolates a driver pose flSeconds past its own time with the
+//			chosen model, then takes it to the head in app world space as the
+//			runtime would
+//-----------------------------------------------------------------------------
+static WorldPose_t PredictPose( const vr::DriverPose_t &pose, double flSeconds, EPredictionModel eModel )
+{
+	double rflPosition[ 3 ];
+	double rflRotation[ 3 ];
+	for ( uint32_t i = 0; i < 3; i++ )
+	{
+		rflPosition[i] = pose.vecPosition[i];
+		rflRotation[i] = 0.0;
+		if ( eModel >= PredictionModel_Velocity )
+		{
+			rflPosition[i] += pose.vecVelocity[i] * flSeconds;
+			rflRotation[i] = pose.vecAngularVelocity[i] * flSeconds;
+		}
+		if ( eModel >= PredictionModel_Acceleration )
+		{
+			rflPosition[i] += 0.5 * pose.vecAcceleration[i] * flSeconds * flSeconds;
+			rflRotation[i] += 0.5 * pose.vecAngularAcceleration[i] * flSeconds * flSeconds;
+		}
+	}
+	const vr::HmdQuaternion_t qDriver = NormalizeQuaternion( MultiplyQuaternions( QuaternionFromRotationVector( rflRotation ), pose.qRotation ) );
+
+	// head = worldFromDriver * driver * driverFromHead
+	double rflHeadOffset[ 3 ];
+	RotateVector( qDriver, pose.vecDriverFromHeadTranslation, rflHeadOffset );
+	for ( uint32_t i = 0; i < 3; i++ )
+		rflPosition[i] += rflHeadOffset[i];
+
+	WorldPose_t world;
+	RotateVector( pose.qWorldFromDriverRotation, rflPosition, world.rflPosition );
+	for ( uint32_t i = 0; i < 3; i++ )
+		world.rflPosition[i] += pose.vecWorldFromDriverTranslation[i];
+	world.qRotation = MultiplyQuaternions( MultiplyQuaternions( pose.qWorldFromDriverRotation, qDriver ), pose.qDriverFromHeadRotation );
+	return world;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: When the pose in a sample is from, which is not when it was reported
+//-----------------------------------------------------------------------------
+static double GetPoseTime( const DriverPoseSample_t &sample )
+{
+	return sample.flTime + sample.pose.poseTimeOffset;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Where the device really was at flTime, interpolated between the
+//			logged poses either side. Fails past the end of the log, across a
+//			gap longer than flMaxGap or next to an invalid pose.
+//-----------------------------------------------------------------------------
+static bool GetActualPose( const std::vector< DriverPoseSample_t > &vecPoses, double flTime, double flMaxGap, WorldPose_t *pPose )
+{
+	std::vector< DriverPoseSample_t >::const_iterator iAfter = std::lower_bound( vecPoses.begin(), vecPoses.end(), flTime,
+		[]( const DriverPoseSample_t &sample, double flTime ) { return GetPoseTime( sample ) < flTime; } );
+	if ( iAfter == vecPoses.begin() || iAfter == vecPoses.end() )
+		return false;
+
+	const DriverPoseSample_t &before = *( iAfter - 1 );
+	const DriverPoseSample_t &after = *iAfter;
+	const double flGap = GetPoseTime( after ) - GetPoseTime( before );
+	if ( flGap > flMaxGap || !before.pose.poseIsValid || !after.pose.poseIsValid )
+		return false;
+
+	const double flFraction = flGap > 0.0 ? ( flTime - GetPoseTime( before ) ) / flGap : 0.0;
+	const WorldPose_t a = PredictPose( before.pose, 0.0, PredictionModel_None );
+	const WorldPose_t b = PredictPose( after.pose, 0.0, PredictionModel_None );
+	for ( uint32_t i = 0; i < 3; i++ )
+		pPose->rflPosition[i] = a.rflPosition[i] + ( b.rflPosition[i] - a.rflPosition[i] ) * flFraction;
+	pPose->qRotation = InterpolateQuaternions( a.qRotation, b.qRotation, flFraction );
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static const char *GetDeviceClassName( vr::ETrackedDeviceClass eClass )
+{
+	switch ( eClass )
+	{
+	case vr::TrackedDeviceClass_HMD: return "HMD";
+	case vr::TrackedDeviceClass_Controller: return "Controller";
+	case vr::TrackedDeviceClass_TrackingReference: return "TrackingReference";
+	case vr::TrackedDeviceClass_Other: return "Other";
+	default: return "Unknown";
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Sorts vecValues in place
+//-----------------------------------------------------------------------------
+static double GetPercentile( std::vector< double > &vecValues, double flFraction )
+{
+	if ( vecValues.empty() )
+		return 0.0;
+
+	std::sort( vecValues.begin(), vecValues.end() );
+	const size_t unIndex = std::min( vecValues.size() - 1, (size_t)( vecValues.size() * flFraction ) );
+	return vecValues[ unIndex ];
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static void PrintUsage()
+{
+	fprintf( stderr, "Usage: pose_prediction_benchmark [options] <pose log>\n" );
+	fprintf( stderr, "  -horizons <from:to:step>  prediction horizons in ms (0:50:5)\n" );
+	fprintf( stderr, "  -model <name>             only this model: none, velocity or acceleration\n" );
+	fprintf( stderr, "  -maxgap <ms>              skip predictions that land in a gap this long in the log (50)\n" );
+	fprintf( stderr, "  -report <file>            write the report there instead of stdout\n" );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+int main( int argc, char *argv[] )
+{
+	double flFromMs = 0.0;
+	double flToMs = 50.0;
+	double flStepMs = 5.0;
+	double flMaxGapMs = 50.0;
+	int nOnlyModel = -1;
+	const char *pchReport = NULL;
+	const char *pchLog = NULL;
+
+	for ( int i = 1; i < argc; i++ )
+	{
+		const bool bHasValue = i + 1 < argc;
+		if ( !strcmp( argv[i], "-horizons" ) && bHasValue )
+		{
+			if ( sscanf( argv[ ++i ], "%lf:%lf:%lf", &flFromMs, &flToMs, &flStepMs ) != 3 )
+			{
+				PrintUsage();
+				return 2;
+			}
+		}
+		else if ( !strcmp( argv[i], "-model" ) && bHasValue )
+		{
+			++i;
+			for ( int nModel = 0; nModel < PredictionModel_Count; nModel++ )
+			{
+				if ( !strcmp( argv[i], k_rpchPredictionModels[ nModel ] ) )
+					nOnlyModel = nModel;
+			}
+			if ( nOnlyModel < 0 )
+			{
+				PrintUsage();
+				return 2;
+			}
+		}
+		else if ( !strcmp( argv[i], "-maxgap" ) && bHasValue )
+			flMaxGapMs = atof( argv[ ++i ] );
+		else if ( !strcmp( argv[i], "-report" ) && bHasValue )
+			pchReport = argv[ ++i ];
+		else if ( argv[i][0] != '-' && !pchLog )
+			pchLog = argv[i];
+		else
+		{
+			PrintUsage();
+			return 2;
+		}
+	}
+	if ( !pchLog || flStepMs <= 0.0 || flToMs < flFromMs || flFromMs < 0.0 || flMaxGapMs <= 0.0 )
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	std::vector< DriverPoseLogDevice_t > vecDevices;
+	if ( !DriverPoseLog_Read( pchLog, vecDevices ) )
+	{
+		fprintf( stderr, "Unable to read the pose log %s\n", pchLog );
+		return 1;
+	}
+
+	std::vector< double > vecHorizonsMs;
+	for ( uint32_t unStep = 0; flFromMs + unStep * flStepMs <= flToMs + 1e-9; unStep++ )
+		vecHorizonsMs.push_back( flFromMs + unStep * flStepMs );
+
+	// one set of errors per class, horizon and model, classes in the order the log lists them
+	std::vector< vr::ETrackedDeviceClass > vecClasses;
+	std::vector< std::vector< PredictionErrors_t > > vecErrors;
+	uint64_t ulPoses = 0;
+	for ( const DriverPoseLogDevice_t &device : vecDevices )
+	{
+		if ( device.vecPoses.empty() )
+			continue;
+
+		size_t unClass = std::find( vecClasses.begin(), vecClasses.end(), device.eClass ) - vecClasses.begin();
+		if ( unClass == vecClasses.size() )
+		{
+			vecClasses.push_back( device.eClass );
+			vecErrors.push_back( std::vector< PredictionErrors_t >( vecHorizonsMs.size() * PredictionModel_Count ) );
+		}
+		std::vector< PredictionErrors_t > &vecClassErrors = vecErrors[ unClass ];
+
+		for ( const DriverPoseSample_t &sample : device.vecPoses )
+		{
+			if ( !sample.pose.poseIsValid )
+				continue;
+			ulPoses++;
+
+			// as if the pose were asked for the moment it was reported
+			for ( size_t unHorizon = 0; unHorizon < vecHorizonsMs.size(); unHorizon++ )
+			{
+				const double flHorizon = vecHorizonsMs[ unHorizon ] / 1000.0;
+				WorldPose_t actual;
+				if ( !GetActualPose( device.vecPoses, sample.flTime + flHorizon, flMaxGapMs / 1000.0, &actual ) )
+					continue;
+
+				for ( int nModel = 0; nModel < PredictionModel_Count; nModel++ )
+				{
+					if ( nOnlyModel >= 0 && nModel != nOnlyModel )
+						continue;
+
+					const WorldPose_t predicted = PredictPose( sample.pose, flHorizon - sample.pose.poseTimeOffset, (EPredictionModel)nModel );
+					double flDistanceSquared = 0.0;
+					for ( uint32_t i = 0; i < 3; i++ )
+						flDistanceSquared += ( predicted.rflPosition[i] - actual.rflPosition[i] ) * ( predicted.rflPosition[i] - actual.rflPosition[i] );
+
+					PredictionErrors_t &errors = vecClassErrors[ unHorizon * PredictionModel_Count + nModel ];
+					errors.vecPositionMm.push_back( sqrt( flDistanceSquared ) * 1000.0 );
+					errors.vecRotationDegrees.push_back( GetRotationError( predicted.qRotation, actual.qRotation ) * 180.0 / k_flPi );
+				}
+			}
+		}
+	}
+
+	FILE *f = stdout;
+	if ( pchReport )
+	{
+#if defined( _WIN32 )
+		if ( fopen_s( &f, pchReport, "w" ) != 0 )
+			f = NULL;
+#else
+		f = fopen( pchReport, "w" );
+#endif
+		if ( f == NULL )
+		{
+			fprintf( stderr, "Unable to write %s\n", pchReport );
+			return 1;
+		}
+	}
+
+	fprintf( f, "%llu valid poses from %s, horizons %.1f to %.1f ms\n", (unsigned long long)ulPoses, pchLog, flFromMs, flToMs );
+	for ( size_t unClass = 0; unClass < vecClasses.size(); unClass++ )
+	{
+		fprintf( f, "\n%s\n", GetDeviceClassName( vecClasses[ unClass ] ) );
+		fprintf( f, "%8s %-12s %8s %9s %9s %9s %9s %9s %9s %9s %9s\n", "ms", "model", "samples",
+			"p50 mm", "p90 mm", "p99 mm", "max mm", "p50 deg", "p90 deg", "p99 deg", "max deg" );
+		for ( size_t unHorizon = 0; unHorizon < vecHorizonsMs.size(); unHorizon++ )
+		{
+			for ( int nModel = 0; nModel < PredictionModel_Count; nModel++ )
+			{
+				PredictionErrors_t &errors = vecErrors[ unClass ][ unHorizon * PredictionModel_Count + nModel ];
+				if ( errors.vecPositionMm.empty() )
+					continue;
+
+				fprintf( f, "%8.1f %-12s %8u %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f\n",
+					vecHorizonsMs[ unHorizon ], k_rpchPredictionModels[ nModel ], (uint32_t)errors.vecPositionMm.size(),
+					GetPercentile( errors.vecPositionMm, 0.5 ), GetPercentile( errors.vecPositionMm, 0.9 ),
+					GetPercentile( errors.vecPositionMm, 0.99 ), GetPercentile( errors.vecPositionMm, 1.0 ),
+					GetPercentile( errors.vecRotationDegrees, 0.5 ), GetPercentile( errors.vecRotationDegrees, 0.9 ),
+					GetPercentile( errors.vecRotationDegrees, 0.99 ), GetPercentile( errors.vecRotationDegrees, 1.0 ) );
+			}
+		}
+	}
+
+	if ( f != stdout )
+		fclose( f );
+	return 0;
+}
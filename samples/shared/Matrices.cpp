@@ -23,6 +23,48 @@
 const float DEG2RAD = 3.141593f / 180;
 const float EPSILON = 0.00001f;
 
+#if defined(MATRICES_SSE)
+// lane shuffles; x,y,z,w pick the source lane for each destination lane
+#define SSE_SWIZZLE(v, x, y, z, w)      _mm_shuffle_ps(v, v, _MM_SHUFFLE(w, z, y, x))
+#define SSE_SHUFFLE(a, b, x, y, z, w)   _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+
+// 2x2 matrices packed as (m00, m01, m10, m11)
+// A * B
+static inline __m128 sseMat2Mul(__m128 a, __m128 b)
+{
+    return _mm_add_ps(_mm_mul_ps(a, SSE_SWIZZLE(b, 0,3,0,3)),
+                      _mm_mul_ps(SSE_SWIZZLE(a, 1,0,3,2), SSE_SWIZZLE(b, 2,1,2,1)));
+}
+
+// adj(A) * B
+static inline __m128 sseMat2AdjMul(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(SSE_SWIZZLE(a, 3,3,0,0), b),
+                      _mm_mul_ps(SSE_SWIZZLE(a, 1,1,2,2), SSE_SWIZZLE(b, 2,3,0,1)));
+}
+
+// A * adj(B)
+static inline __m128 sseMat2MulAdj(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(a, SSE_SWIZZLE(b, 3,0,3,0)),
+                      _mm_mul_ps(SSE_SWIZZLE(a, 1,0,3,2), SSE_SWIZZLE(b, 2,1,2,1)));
+}
+
+// a x b in xyz, 0 in w
+static inline __m128 sseCross(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(SSE_SWIZZLE(a, 1,2,0,3), SSE_SWIZZLE(b, 2,0,1,3)),
+                      _mm_mul_ps(SSE_SWIZZLE(a, 2,0,1,3), SSE_SWIZZLE(b, 1,2,0,3)));
+}
+
+// keeps xyz of a and w of b
+static inline __m128 sseSelectXYZ(__m128 a, __m128 b)
+{
+    const __m128 mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+#endif
+
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -204,6 +246,25 @@ Matrix4& Matrix4::invert()
 ///////////////////////////////////////////////////////////////////////////////
 Matrix4& Matrix4::invertEuclidean()
 {
+#if defined(MATRICES_SSE)
+    __m128 c0 = _mm_loadu_ps(&m[0]);
+    __m128 c1 = _mm_loadu_ps(&m[4]);
+    __m128 c2 = _mm_loadu_ps(&m[8]);
+    __m128 c3 = _mm_loadu_ps(&m[12]);
+    __m128 r0 = c0, r1 = c1, r2 = c2, r3 = c3;
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    // R^T, then -R^T * T; the 4th row is left as it was
+    __m128 t = _mm_mul_ps(r0, _mm_set1_ps(m[12]));
+    t = _mm_add_ps(t, _mm_mul_ps(r1, _mm_set1_ps(m[13])));
+    t = _mm_add_ps(t, _mm_mul_ps(r2, _mm_set1_ps(m[14])));
+    t = _mm_sub_ps(_mm_setzero_ps(), t);
+
+    _mm_storeu_ps(&m[0],  sseSelectXYZ(r0, c0));
+    _mm_storeu_ps(&m[4],  sseSelectXYZ(r1, c1));
+    _mm_storeu_ps(&m[8],  sseSelectXYZ(r2, c2));
+    _mm_storeu_ps(&m[12], sseSelectXYZ(t,  c3));
+#else
     // transpose 3x3 rotation matrix part
     // | R^T | 0 |
     // | ----+-- |
@@ -225,6 +286,7 @@ Matrix4& Matrix4::invertEuclidean()
     m[14] = -(m[2] * x + m[6] * y + m[10]* z);
 
     // last row should be unchanged (0,0,0,1)
+#endif
 
     return *this;
 }
@@ -249,6 +311,47 @@ Matrix4& Matrix4::invertEuclidean()
 ///////////////////////////////////////////////////////////////////////////////
 Matrix4& Matrix4::invertAffine()
 {
+#if defined(MATRICES_SSE)
+    __m128 c0 = _mm_loadu_ps(&m[0]);
+    __m128 c1 = _mm_loadu_ps(&m[4]);
+    __m128 c2 = _mm_loadu_ps(&m[8]);
+    __m128 c3 = _mm_loadu_ps(&m[12]);
+
+    // the rows of R^-1 are the cross products of the columns of R over det(R)
+    __m128 r0 = sseCross(c1, c2);
+    __m128 r1 = sseCross(c2, c0);
+    __m128 r2 = sseCross(c0, c1);
+    __m128 r3 = _mm_setzero_ps();
+
+    __m128 d = _mm_mul_ps(c0, r0);
+    float determinant = _mm_cvtss_f32(d) + _mm_cvtss_f32(SSE_SWIZZLE(d, 1,1,1,1)) + _mm_cvtss_f32(SSE_SWIZZLE(d, 2,2,2,2));
+    if(fabs(determinant) <= EPSILON)
+    {
+        // same as Matrix3::invert(), R^-1 becomes identity
+        r0 = _mm_setr_ps(1, 0, 0, 0);
+        r1 = _mm_setr_ps(0, 1, 0, 0);
+        r2 = _mm_setr_ps(0, 0, 1, 0);
+    }
+    else
+    {
+        __m128 invDeterminant = _mm_set1_ps(1.0f / determinant);
+        r0 = _mm_mul_ps(r0, invDeterminant);
+        r1 = _mm_mul_ps(r1, invDeterminant);
+        r2 = _mm_mul_ps(r2, invDeterminant);
+    }
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    // -R^-1 * T; the 4th row is left as it was
+    __m128 t = _mm_mul_ps(r0, _mm_set1_ps(m[12]));
+    t = _mm_add_ps(t, _mm_mul_ps(r1, _mm_set1_ps(m[13])));
+    t = _mm_add_ps(t, _mm_mul_ps(r2, _mm_set1_ps(m[14])));
+    t = _mm_sub_ps(_mm_setzero_ps(), t);
+
+    _mm_storeu_ps(&m[0],  sseSelectXYZ(r0, c0));
+    _mm_storeu_ps(&m[4],  sseSelectXYZ(r1, c1));
+    _mm_storeu_ps(&m[8],  sseSelectXYZ(r2, c2));
+    _mm_storeu_ps(&m[12], sseSelectXYZ(t,  c3));
+#else
     // R^-1
     Matrix3 r(m[0],m[1],m[2], m[4],m[5],m[6], m[8],m[9],m[10]);
     r.invert();
@@ -267,6 +370,7 @@ Matrix4& Matrix4::invertAffine()
     // last row should be unchanged (0,0,0,1)
     //m[3] = m[7] = m[11] = 0.0f;
     //m[15] = 1.0f;
+#endif
 
     return * this;
 }
@@ -348,6 +452,66 @@ Matrix4& Matrix4::invertProjective()
 ///////////////////////////////////////////////////////////////////////////////
 Matrix4& Matrix4::invertGeneral()
 {
+#if defined(MATRICES_SSE)
+    // Same adj(M) / det(M), computed blockwise from 2x2 sub-matrices.
+    // It rounds differently from the scalar path below. Relative to the largest
+    // element of the inverse, the two agree to about 4e-6 when the condition
+    // number is under 100, but ill-conditioned input magnifies the difference:
+    // on random matrices with elements in [-1,1] it reaches about 3e-3. Neither
+    // path is closer to the exact inverse than the other.
+    // The columns are handled as rows: inverting M^T gives (M^-1)^T, which is
+    // the same memory layout.
+    // M = | A B |   |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+    //     | C D |
+    __m128 r0 = _mm_loadu_ps(&m[0]);
+    __m128 r1 = _mm_loadu_ps(&m[4]);
+    __m128 r2 = _mm_loadu_ps(&m[8]);
+    __m128 r3 = _mm_loadu_ps(&m[12]);
+
+    __m128 a = _mm_movelh_ps(r0, r1);
+    __m128 b = _mm_movehl_ps(r1, r0);
+    __m128 c = _mm_movelh_ps(r2, r3);
+    __m128 d = _mm_movehl_ps(r3, r2);
+
+    // (|A|, |B|, |C|, |D|)
+    __m128 detSub = _mm_sub_ps(_mm_mul_ps(SSE_SHUFFLE(r0, r2, 0,2,0,2), SSE_SHUFFLE(r1, r3, 1,3,1,3)),
+                               _mm_mul_ps(SSE_SHUFFLE(r0, r2, 1,3,1,3), SSE_SHUFFLE(r1, r3, 0,2,0,2)));
+    __m128 detA = SSE_SWIZZLE(detSub, 0,0,0,0);
+    __m128 detB = SSE_SWIZZLE(detSub, 1,1,1,1);
+    __m128 detC = SSE_SWIZZLE(detSub, 2,2,2,2);
+    __m128 detD = SSE_SWIZZLE(detSub, 3,3,3,3);
+
+    __m128 dc = sseMat2AdjMul(d, c);   // adj(D)C
+    __m128 ab = sseMat2AdjMul(a, b);   // adj(A)B
+
+    // adjugates of the blocks of M^-1 * |M|
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), sseMat2Mul(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), sseMat2Mul(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), sseMat2MulAdj(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), sseMat2MulAdj(a, dc));
+
+    __m128 tr = _mm_mul_ps(ab, SSE_SWIZZLE(dc, 0,2,1,3));
+    tr = _mm_add_ps(tr, SSE_SWIZZLE(tr, 1,0,3,2));
+    tr = _mm_add_ps(tr, SSE_SWIZZLE(tr, 2,3,0,1));
+    __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+    if(fabs(_mm_cvtss_f32(determinant)) <= EPSILON)
+    {
+        return identity();
+    }
+
+    // adjugate signs folded into 1/|M|
+    __m128 invDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+    x = _mm_mul_ps(x, invDeterminant);
+    y = _mm_mul_ps(y, invDeterminant);
+    z = _mm_mul_ps(z, invDeterminant);
+    w = _mm_mul_ps(w, invDeterminant);
+
+    // undo the adjugate and reassemble the blocks in one shuffle
+    _mm_storeu_ps(&m[0],  SSE_SHUFFLE(x, y, 3,1,3,1));
+    _mm_storeu_ps(&m[4],  SSE_SHUFFLE(x, y, 2,0,2,0));
+    _mm_storeu_ps(&m[8],  SSE_SHUFFLE(z, w, 3,1,3,1));
+    _mm_storeu_ps(&m[12], SSE_SHUFFLE(z, w, 2,0,2,0));
+#else
     // get cofactors of minor matrices
     float cofactor0 = getCofactor(m[5],m[6],m[7], m[9],m[10],m[11], m[13],m[14],m[15]);
     float cofactor1 = getCofactor(m[4],m[6],m[7], m[8],m[10],m[11], m[12],m[14],m[15]);
@@ -399,6 +563,7 @@ Matrix4& Matrix4::invertGeneral()
     m[13]=  invDeterminant * cofactor7;
     m[14]= -invDeterminant * cofactor11;
     m[15]=  invDeterminant * cofactor15;
+#endif
 
     return *this;
 }
@@ -23,6 +23,32 @@
 #include <iomanip>
 #include "Vectors.h"
 
+// Matrix4 multiplies, transforms and inverses use SSE2 (and AVX when the
+// compiler targets it) or NEON. Define MATRICES_NO_SIMD to build the scalar
+// reference implementation instead.
+#if !defined(MATRICES_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATRICES_SSE
+#include <emmintrin.h>
+#if defined(__AVX__)
+#define MATRICES_AVX
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM) || defined(_M_ARM64)
+#define MATRICES_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+// Matrix4 storage is 16-byte aligned so a column never straddles a cache line.
+// 32-bit MSVC cannot pass over-aligned types by value, so it keeps the natural
+// alignment there; the SIMD paths use unaligned loads and work either way.
+#if defined(_MSC_VER) && defined(_M_IX86)
+#define MATRICES_ALIGN16
+#else
+#define MATRICES_ALIGN16 alignas(16)
+#endif
+
 ///////////////////////////////////////////////////////////////////////////
 // 2x2 matrix
 ///////////////////////////////////////////////////////////////////////////
@@ -207,8 +233,8 @@ private:
                             float m3, float m4, float m5,
                             float m6, float m7, float m8);
 
-    float m[16];
-    float tm[16];                                       // transpose m
+    MATRICES_ALIGN16 float m[16];
+    MATRICES_ALIGN16 float tm[16];                      // transpose m
 
 };
 
@@ -798,10 +824,28 @@ inline Matrix4& Matrix4::operator-=(const Matrix4& rhs)
 
 inline Vector4 Matrix4::operator*(const Vector4& rhs) const
 {
+#if defined(MATRICES_SSE)
+    __m128 r = _mm_mul_ps(_mm_loadu_ps(&m[0]), _mm_set1_ps(rhs.x));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(&m[4]),  _mm_set1_ps(rhs.y)));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(&m[8]),  _mm_set1_ps(rhs.z)));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(&m[12]), _mm_set1_ps(rhs.w)));
+    Vector4 v;
+    _mm_storeu_ps(&v.x, r);
+    return v;
+#elif defined(MATRICES_NEON)
+    float32x4_t r = vmulq_n_f32(vld1q_f32(&m[0]), rhs.x);
+    r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(&m[4]),  rhs.y));
+    r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(&m[8]),  rhs.z));
+    r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(&m[12]), rhs.w));
+    Vector4 v;
+    vst1q_f32(&v.x, r);
+    return v;
+#else
     return Vector4(m[0]*rhs.x + m[4]*rhs.y + m[8]*rhs.z  + m[12]*rhs.w,
                    m[1]*rhs.x + m[5]*rhs.y + m[9]*rhs.z  + m[13]*rhs.w,
                    m[2]*rhs.x + m[6]*rhs.y + m[10]*rhs.z + m[14]*rhs.w,
                    m[3]*rhs.x + m[7]*rhs.y + m[11]*rhs.z + m[15]*rhs.w);
+#endif
 }
 
 
@@ -817,10 +861,60 @@ inline Vector3 Matrix4::operator*(const Vector3& rhs) const
 
 inline Matrix4 Matrix4::operator*(const Matrix4& n) const
 {
+    // each column of the product is a linear combination of the columns of
+    // this matrix, weighted by the matching column of n
+#if defined(MATRICES_AVX)
+    const __m256 c0 = _mm256_broadcast_ps((const __m128*)&m[0]);
+    const __m256 c1 = _mm256_broadcast_ps((const __m128*)&m[4]);
+    const __m256 c2 = _mm256_broadcast_ps((const __m128*)&m[8]);
+    const __m256 c3 = _mm256_broadcast_ps((const __m128*)&m[12]);
+    Matrix4 result;
+    for(int i = 0; i < 16; i += 8)  // two columns at a time
+    {
+        __m256 b = _mm256_loadu_ps(&n.m[i]);
+        __m256 r = _mm256_mul_ps(c0, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(0,0,0,0)));
+        r = _mm256_add_ps(r, _mm256_mul_ps(c1, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(1,1,1,1))));
+        r = _mm256_add_ps(r, _mm256_mul_ps(c2, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(2,2,2,2))));
+        r = _mm256_add_ps(r, _mm256_mul_ps(c3, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(3,3,3,3))));
+        _mm256_storeu_ps(&result.m[i], r);
+    }
+    return result;
+#elif defined(MATRICES_SSE)
+    const __m128 c0 = _mm_loadu_ps(&m[0]);
+    const __m128 c1 = _mm_loadu_ps(&m[4]);
+    const __m128 c2 = _mm_loadu_ps(&m[8]);
+    const __m128 c3 = _mm_loadu_ps(&m[12]);
+    Matrix4 result;
+    for(int i = 0; i < 16; i += 4)
+    {
+        __m128 r = _mm_mul_ps(c0, _mm_set1_ps(n.m[i]));
+        r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(n.m[i+1])));
+        r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(n.m[i+2])));
+        r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_set1_ps(n.m[i+3])));
+        _mm_storeu_ps(&result.m[i], r);
+    }
+    return result;
+#elif defined(MATRICES_NEON)
+    const float32x4_t c0 = vld1q_f32(&m[0]);
+    const float32x4_t c1 = vld1q_f32(&m[4]);
+    const float32x4_t c2 = vld1q_f32(&m[8]);
+    const float32x4_t c3 = vld1q_f32(&m[12]);
+    Matrix4 result;
+    for(int i = 0; i < 16; i += 4)
+    {
+        float32x4_t r = vmulq_n_f32(c0, n.m[i]);
+        r = vaddq_f32(r, vmulq_n_f32(c1, n.m[i+1]));
+        r = vaddq_f32(r, vmulq_n_f32(c2, n.m[i+2]));
+        r = vaddq_f32(r, vmulq_n_f32(c3, n.m[i+3]));
+        vst1q_f32(&result.m[i], r);
+    }
+    return result;
+#else
     return Matrix4(m[0]*n[0]  + m[4]*n[1]  + m[8]*n[2]  + m[12]*n[3],   m[1]*n[0]  + m[5]*n[1]  + m[9]*n[2]  + m[13]*n[3],   m[2]*n[0]  + m[6]*n[1]  + m[10]*n[2]  + m[14]*n[3],   m[3]*n[0]  + m[7]*n[1]  + m[11]*n[2]  + m[15]*n[3],
                    m[0]*n[4]  + m[4]*n[5]  + m[8]*n[6]  + m[12]*n[7],   m[1]*n[4]  + m[5]*n[5]  + m[9]*n[6]  + m[13]*n[7],   m[2]*n[4]  + m[6]*n[5]  + m[10]*n[6]  + m[14]*n[7],   m[3]*n[4]  + m[7]*n[5]  + m[11]*n[6]  + m[15]*n[7],
                    m[0]*n[8]  + m[4]*n[9]  + m[8]*n[10] + m[12]*n[11],  m[1]*n[8]  + m[5]*n[9]  + m[9]*n[10] + m[13]*n[11],  m[2]*n[8]  + m[6]*n[9]  + m[10]*n[10] + m[14]*n[11],  m[3]*n[8]  + m[7]*n[9]  + m[11]*n[10] + m[15]*n[11],
                    m[0]*n[12] + m[4]*n[13] + m[8]*n[14] + m[12]*n[15],  m[1]*n[12] + m[5]*n[13] + m[9]*n[14] + m[13]*n[15],  m[2]*n[12] + m[6]*n[13] + m[10]*n[14] + m[14]*n[15],  m[3]*n[12] + m[7]*n[13] + m[11]*n[14] + m[15]*n[15]);
+#endif
 }
 
 
@@ -883,7 +977,32 @@ inline Matrix4 operator*(float s, const Matrix4& rhs)
 
 inline Vector4 operator*(const Vector4& v, const Matrix4& m)
 {
+    // v' = M^T * v, so combine the rows of m instead of its columns
+#if defined(MATRICES_SSE)
+    __m128 r0 = _mm_loadu_ps(&m.m[0]);
+    __m128 r1 = _mm_loadu_ps(&m.m[4]);
+    __m128 r2 = _mm_loadu_ps(&m.m[8]);
+    __m128 r3 = _mm_loadu_ps(&m.m[12]);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    __m128 r = _mm_mul_ps(r0, _mm_set1_ps(v.x));
+    r = _mm_add_ps(r, _mm_mul_ps(r1, _mm_set1_ps(v.y)));
+    r = _mm_add_ps(r, _mm_mul_ps(r2, _mm_set1_ps(v.z)));
+    r = _mm_add_ps(r, _mm_mul_ps(r3, _mm_set1_ps(v.w)));
+    Vector4 result;
+    _mm_storeu_ps(&result.x, r);
+    return result;
+#elif defined(MATRICES_NEON)
+    float32x4x4_t rows = vld4q_f32(&m.m[0]);
+    float32x4_t r = vmulq_n_f32(rows.val[0], v.x);
+    r = vaddq_f32(r, vmulq_n_f32(rows.val[1], v.y));
+    r = vaddq_f32(r, vmulq_n_f32(rows.val[2], v.z));
+    r = vaddq_f32(r, vmulq_n_f32(rows.val[3], v.w));
+    Vector4 result;
+    vst1q_f32(&result.x, r);
+    return result;
+#else
     return Vector4(v.x*m[0] + v.y*m[1] + v.z*m[2] + v.w*m[3],  v.x*m[4] + v.y*m[5] + v.z*m[6] + v.w*m[7],  v.x*m[8] + v.y*m[9] + v.z*m[10] + v.w*m[11], v.x*m[12] + v.y*m[13] + v.z*m[14] + v.w*m[15]);
+#endif
 }
 
 
@@ -0,0 +1,216 @@
+///////////////////////////////////////////////////////////////////////////////
+// RigidTransform.h
+// ================
+// Rotation + translation transforms between coordinate frames
+//
+// The rotation is stored as a column major 3x3 matrix, the same order as the
+// upper-left block of Matrix4, and the translation as a Vector3. Because the
+// rotation is orthonormal the inverse is closed form (R^T, -R^T * T) and never
+// needs the general 4x4 inverse.
+//
+// The frames are part of the type. RigidTransform<To, From> maps points in
+// From space into To space, so only transforms whose frames line up compose:
+//   RigidTransform<World, Eye> = RigidTransform<World, Head> * RigidTransform<Head, Eye>
+// Leave the frames out to get an untyped transform.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef MATH_RIGIDTRANSFORM_H
+#define MATH_RIGIDTRANSFORM_H
+
+#include "Matrices.h"
+#include "Vectors.h"
+
+struct AnyFrame {};
+
+template <class To = AnyFrame, class From = AnyFrame>
+class RigidTransform
+{
+public:
+    // constructors
+    RigidTransform();                                   // init with identity
+    explicit RigidTransform(const Vector3& translation); // pure translation
+    RigidTransform(const float rotation[9], const Vector3& translation);
+
+    // conversions from OpenVR types. These are templates so this header does
+    // not need to pick between openvr.h and openvr_driver.h.
+    template <class HmdMatrix34>
+    static RigidTransform fromHmdMatrix34(const HmdMatrix34& mat);      // vr::HmdMatrix34_t, must be rigid
+    template <class DriverPose>
+    static RigidTransform fromDriverPose(const DriverPose& pose);       // vr::DriverPose_t, world from head
+    static RigidTransform fromQuaternion(double w, double x, double y, double z,
+                                         double tx, double ty, double tz);
+
+    RigidTransform<From, To> inverse() const;           // closed form inverse
+    Matrix4     toMatrix4() const;                      // promote, e.g. to combine with a projection
+
+    const float* getRotation() const  { return r; }
+    const Vector3& getTranslation() const { return t; }
+
+    // operators
+    template <class Inner>
+    RigidTransform<To, Inner> operator*(const RigidTransform<From, Inner>& rhs) const; // composition
+    Vector3     operator*(const Vector3& point) const;  // transform a point
+    Vector3     rotate(const Vector3& dir) const;       // transform a direction (no translation)
+
+    friend Matrix4 operator*(const Matrix4& lhs, const RigidTransform& rhs) { return lhs * rhs.toMatrix4(); }
+
+private:
+    template <class, class> friend class RigidTransform;
+
+    float r[9];
+    Vector3 t;
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// inline functions for RigidTransform
+///////////////////////////////////////////////////////////////////////////
+template <class To, class From>
+inline RigidTransform<To, From>::RigidTransform()
+{
+    r[0] = r[4] = r[8] = 1.0f;
+    r[1] = r[2] = r[3] = r[5] = r[6] = r[7] = 0.0f;
+}
+
+
+
+template <class To, class From>
+inline RigidTransform<To, From>::RigidTransform(const Vector3& translation) : t(translation)
+{
+    r[0] = r[4] = r[8] = 1.0f;
+    r[1] = r[2] = r[3] = r[5] = r[6] = r[7] = 0.0f;
+}
+
+
+
+template <class To, class From>
+inline RigidTransform<To, From>::RigidTransform(const float rotation[9], const Vector3& translation) : t(translation)
+{
+    for(int i = 0; i < 9; ++i)
+        r[i] = rotation[i];
+}
+
+
+
+template <class To, class From>
+template <class HmdMatrix34>
+inline RigidTransform<To, From> RigidTransform<To, From>::fromHmdMatrix34(const HmdMatrix34& mat)
+{
+    // HmdMatrix34_t is row major 3x4
+    RigidTransform xf;
+    xf.r[0] = mat.m[0][0];  xf.r[3] = mat.m[0][1];  xf.r[6] = mat.m[0][2];
+    xf.r[1] = mat.m[1][0];  xf.r[4] = mat.m[1][1];  xf.r[7] = mat.m[1][2];
+    xf.r[2] = mat.m[2][0];  xf.r[5] = mat.m[2][1];  xf.r[8] = mat.m[2][2];
+    xf.t.set(mat.m[0][3], mat.m[1][3], mat.m[2][3]);
+    return xf;
+}
+
+
+
+template <class To, class From>
+template <class DriverPose>
+inline RigidTransform<To, From> RigidTransform<To, From>::fromDriverPose(const DriverPose& pose)
+{
+    // world <- driver <- tracker <- head
+    const RigidTransform<To, AnyFrame> worldFromDriver = RigidTransform<To, AnyFrame>::fromQuaternion(
+        pose.qWorldFromDriverRotation.w, pose.qWorldFromDriverRotation.x, pose.qWorldFromDriverRotation.y, pose.qWorldFromDriverRotation.z,
+        pose.vecWorldFromDriverTranslation[0], pose.vecWorldFromDriverTranslation[1], pose.vecWorldFromDriverTranslation[2]);
+    const RigidTransform<AnyFrame, AnyFrame> driverFromTracker = RigidTransform<AnyFrame, AnyFrame>::fromQuaternion(
+        pose.qRotation.w, pose.qRotation.x, pose.qRotation.y, pose.qRotation.z,
+        pose.vecPosition[0], pose.vecPosition[1], pose.vecPosition[2]);
+    const RigidTransform<AnyFrame, From> trackerFromHead = RigidTransform<AnyFrame, From>::fromQuaternion(
+        pose.qDriverFromHeadRotation.w, pose.qDriverFromHeadRotation.x, pose.qDriverFromHeadRotation.y, pose.qDriverFromHeadRotation.z,
+        pose.vecDriverFromHeadTranslation[0], pose.vecDriverFromHeadTranslation[1], pose.vecDriverFromHeadTranslation[2]);
+    return worldFromDriver * driverFromTracker * trackerFromHead;
+}
+
+
+
+template <class To, class From>
+inline RigidTransform<To, From> RigidTransform<To, From>::fromQuaternion(double w, double x, double y, double z,
+                                                                        double tx, double ty, double tz)
+{
+    // normalize so slightly denormalized driver quaternions still give a rotation
+    double len2 = w*w + x*x + y*y + z*z;
+    double s = len2 > 0.0 ? 2.0 / len2 : 0.0;
+
+    RigidTransform xf;
+    xf.r[0] = (float)(1.0 - s * (y*y + z*z));
+    xf.r[1] = (float)(s * (x*y + w*z));
+    xf.r[2] = (float)(s * (x*z - w*y));
+    xf.r[3] = (float)(s * (x*y - w*z));
+    xf.r[4] = (float)(1.0 - s * (x*x + z*z));
+    xf.r[5] = (float)(s * (y*z + w*x));
+    xf.r[6] = (float)(s * (x*z + w*y));
+    xf.r[7] = (float)(s * (y*z - w*x));
+    xf.r[8] = (float)(1.0 - s * (x*x + y*y));
+    xf.t.set((float)tx, (float)ty, (float)tz);
+    return xf;
+}
+
+
+
+template <class To, class From>
+inline RigidTransform<From, To> RigidTransform<To, From>::inverse() const
+{
+    // [ R | T ]-1  =  [ R^T | -R^T * T ]
+    RigidTransform<From, To> xf;
+    xf.r[0] = r[0];  xf.r[3] = r[1];  xf.r[6] = r[2];
+    xf.r[1] = r[3];  xf.r[4] = r[4];  xf.r[7] = r[5];
+    xf.r[2] = r[6];  xf.r[5] = r[7];  xf.r[8] = r[8];
+    xf.t.set(-(r[0]*t.x + r[1]*t.y + r[2]*t.z),
+             -(r[3]*t.x + r[4]*t.y + r[5]*t.z),
+             -(r[6]*t.x + r[7]*t.y + r[8]*t.z));
+    return xf;
+}
+
+
+
+template <class To, class From>
+inline Matrix4 RigidTransform<To, From>::toMatrix4() const
+{
+    return Matrix4(r[0], r[1], r[2], 0.0f,
+                   r[3], r[4], r[5], 0.0f,
+                   r[6], r[7], r[8], 0.0f,
+                   t.x,  t.y,  t.z,  1.0f);
+}
+
+
+
+template <class To, class From>
+template <class Inner>
+inline RigidTransform<To, Inner> RigidTransform<To, From>::operator*(const RigidTransform<From, Inner>& n) const
+{
+    // [ Ra | Ta ] * [ Rb | Tb ]  =  [ Ra*Rb | Ra*Tb + Ta ]
+    RigidTransform<To, Inner> xf;
+    for(int c = 0; c < 3; ++c)
+    {
+        const float* col = &n.r[c*3];
+        xf.r[c*3]   = r[0]*col[0] + r[3]*col[1] + r[6]*col[2];
+        xf.r[c*3+1] = r[1]*col[0] + r[4]*col[1] + r[7]*col[2];
+        xf.r[c*3+2] = r[2]*col[0] + r[5]*col[1] + r[8]*col[2];
+    }
+    xf.t = rotate(n.t) + t;
+    return xf;
+}
+
+
+
+template <class To, class From>
+inline Vector3 RigidTransform<To, From>::operator*(const Vector3& p) const
+{
+    return rotate(p) + t;
+}
+
+
+
+template <class To, class From>
+inline Vector3 RigidTransform<To, From>::rotate(const Vector3& v) const
+{
+    return Vector3(r[0]*v.x + r[3]*v.y + r[6]*v.z,
+                   r[1]*v.x + r[4]*v.y + r[7]*v.z,
+                   r[2]*v.x + r[5]*v.y + r[8]*v.z);
+}
+// END OF RIGIDTRANSFORM INLINE ///////////////////////////////////////////////
+#endif
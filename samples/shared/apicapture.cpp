@@ -0,0 +1,337 @@
+//========= Copyright Valve Corporation ============//
+#include "apicapture.h"
+
+// sanity limit on header strings, so a corrupt file fails instead of allocating gigabytes
+static const uint64_t k_ulMaxCaptureString = 4096;
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CApiCaptureBuffer::WriteBytes( const void *pData, size_t unSize )
+{
+	const uint8_t *pBytes = static_cast< const uint8_t * >( pData );
+	m_vecData.insert( m_vecData.end(), pBytes, pBytes + unSize );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Seven bits per byte, low bits first, high bit set on all but the last
+//-----------------------------------------------------------------------------
+void CApiCaptureBuffer::WriteVarint( uint64_t ulValue )
+{
+	while ( ulValue >= 0x80 )
+	{
+		m_vecData.push_back( (uint8_t)( ulValue | 0x80 ) );
+		ulValue >>= 7;
+	}
+	m_vecData.push_back( (uint8_t)ulValue );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CApiCaptureBuffer::WriteString( const char *pchValue, size_t unMaxLength )
+{
+	if ( !pchValue )
+	{
+		WriteVarint( 0 );
+		return;
+	}
+
+	size_t unLength = 0;
+	while ( unLength < unMaxLength && pchValue[ unLength ] )
+		unLength++;
+
+	WriteVarint( (uint64_t)unLength + 1 );
+	WriteBytes( pchValue, unLength );
+	m_vecData.push_back( 0 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool CApiCaptureReader::ReadBytes( void *pData, size_t unSize )
+{
+	if ( !m_bValid || unSize > m_unSize - m_unOffset )
+	{
+		m_bValid = false;
+		return false;
+	}
+
+	if ( unSize )
+		memcpy( pData, m_pData + m_unOffset, unSize );
+	m_unOffset += unSize;
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+uint64_t CApiCaptureReader::ReadVarint()
+{
+	uint64_t ulValue = 0;
+	for ( uint32_t unShift = 0; unShift < 64; unShift += 7 )
+	{
+		if ( !m_bValid || m_unOffset >= m_unSize )
+			break;
+
+		const uint8_t unByte = m_pData[ m_unOffset++ ];
+		ulValue |= (uint64_t)( unByte & 0x7f ) << unShift;
+		if ( !( unByte & 0x80 ) )
+			return ulValue;
+	}
+
+	m_bValid = false;
+	return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+const char *CApiCaptureReader::ReadString()
+{
+	const uint64_t ulLength = ReadVarint();
+	if ( ulLength == 0 || !m_bValid )
+		return NULL;
+
+	// the terminator is stored, so the string can be used in place
+	if ( ulLength > m_unSize - m_unOffset || m_pData[ m_unOffset + ulLength - 1 ] != 0 )
+	{
+		m_bValid = false;
+		return NULL;
+	}
+
+	const char *pchValue = reinterpret_cast< const char * >( m_pData + m_unOffset );
+	m_unOffset += (size_t)ulLength;
+	return pchValue;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CApiCaptureWriter::CApiCaptureWriter()
+	: m_pFile( NULL )
+	, m_ulLastStartNs( 0 )
+{
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CApiCaptureWriter::~CApiCaptureWriter()
+{
+	Close();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool CApiCaptureWriter::Open( const std::string &strFilename, uint32_t unApplicationType, const std::vector< ApiCaptureMethod_t > &vecMethods )
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( m_pFile )
+		return false;
+
+#if defined( _WIN32 )
+	if ( fopen_s( &m_pFile, strFilename.c_str(), "wb" ) != 0 )
+		m_pFile = NULL;
+#else
+	m_pFile = fopen( strFilename.c_str(), "wb" );
+#endif
+	if ( m_pFile == NULL )
+		return false;
+
+	CApiCaptureBuffer header;
+	header.WriteBytes( k_rchApiCaptureMagic, sizeof( k_rchApiCaptureMagic ) );
+	header.WriteVarint( k_unApiCaptureVersion );
+	header.WriteVarint( unApplicationType );
+	header.WriteVarint( vecMethods.size() );
+	for ( const ApiCaptureMethod_t &method : vecMethods )
+	{
+		header.WriteString( method.sName.c_str() );
+		header.WriteString( method.sInterfaceVersion.c_str() );
+	}
+	fwrite( header.GetData(), 1, header.GetSize(), m_pFile );
+
+	m_ulLastStartNs = 0;
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CApiCaptureWriter::Flush()
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( m_pFile )
+		fflush( m_pFile );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CApiCaptureWriter::Close()
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( m_pFile )
+		fclose( m_pFile );
+	m_pFile = NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CApiCaptureWriter::WriteRecord( uint32_t unMethod, uint64_t ulStartNs, uint64_t ulDurationNs, const CApiCaptureBuffer &payload )
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( !m_pFile )
+		return;
+
+	const int64_t nDeltaNs = (int64_t)( ulStartNs - m_ulLastStartNs );
+	m_ulLastStartNs = ulStartNs;
+
+	m_recordHeader.Clear();
+	m_recordHeader.WriteVarint( unMethod );
+	m_recordHeader.WriteVarint( ( (uint64_t)nDeltaNs << 1 ) ^ (uint64_t)( nDeltaNs >> 63 ) );
+	m_recordHeader.WriteVarint( ulDurationNs );
+	m_recordHeader.WriteVarint( payload.GetSize() );
+	fwrite( m_recordHeader.GetData(), 1, m_recordHeader.GetSize(), m_pFile );
+	if ( payload.GetSize() )
+		fwrite( payload.GetData(), 1, payload.GetSize(), m_pFile );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CApiCaptureFile::CApiCaptureFile()
+	: m_pFile( NULL )
+	, m_ulLastStartNs( 0 )
+	, m_unApplicationType( 0 )
+{
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CApiCaptureFile::~CApiCaptureFile()
+{
+	if ( m_pFile )
+		fclose( m_pFile );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool CApiCaptureFile::ReadVarint( uint64_t *pulValue )
+{
+	uint64_t ulValue = 0;
+	for ( uint32_t unShift = 0; unShift < 64; unShift += 7 )
+	{
+		const int nByte = fgetc( m_pFile );
+		if ( nByte == EOF )
+			return false;
+
+		ulValue |= (uint64_t)( nByte & 0x7f ) << unShift;
+		if ( !( nByte & 0x80 ) )
+		{
+			*pulValue = ulValue;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool CApiCaptureFile::ReadString( std::string &strValue )
+{
+	uint64_t ulLength;
+	if ( !ReadVarint( &ulLength ) || ulLength == 0 || ulLength > k_ulMaxCaptureString )
+		return false;
+
+	strValue.resize( (size_t)ulLength );
+	if ( fread( &strValue[0], 1, (size_t)ulLength, m_pFile ) != ulLength )
+		return false;
+	strValue.resize( (size_t)ulLength - 1 );
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool CApiCaptureFile::Open( const std::string &strFilename )
+{
+#if defined( _WIN32 )
+	if ( fopen_s( &m_pFile, strFilename.c_str(), "rb" ) != 0 )
+		m_pFile = NULL;
+#else
+	m_pFile = fopen( strFilename.c_str(), "rb" );
+#endif
+	if ( m_pFile == NULL )
+		return false;
+
+	char rchMagic[ sizeof( k_rchApiCaptureMagic ) ];
+	uint64_t ulVersion, ulApplicationType, ulMethods;
+	if ( fread( rchMagic, 1, sizeof( rchMagic ), m_pFile ) != sizeof( rchMagic ) || memcmp( rchMagic, k_rchApiCaptureMagic, sizeof( rchMagic ) ) != 0 )
+		return false;
+	if ( !ReadVarint( &ulVersion ) || ulVersion > k_unApiCaptureVersion )
+		return false;
+	if ( !ReadVarint( &ulApplicationType ) || !ReadVarint( &ulMethods ) || ulMethods > UINT16_MAX )
+		return false;
+
+	m_unApplicationType = (uint32_t)ulApplicationType;
+	m_vecMethods.resize( (size_t)ulMethods );
+	for ( ApiCaptureMethod_t &method : m_vecMethods )
+	{
+		if ( !ReadString( method.sName ) || !ReadString( method.sInterfaceVersion ) )
+			return false;
+	}
+
+	m_ulLastStartNs = 0;
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool CApiCaptureFile::ReadRecord( ApiCaptureRecord_t &record )
+{
+	if ( !m_pFile )
+		return false;
+
+	uint64_t ulMethod, ulDelta, ulDurationNs, ulPayloadSize;
+	if ( !ReadVarint( &ulMethod ) || !ReadVarint( &ulDelta ) || !ReadVarint( &ulDurationNs ) || !ReadVarint( &ulPayloadSize ) )
+		return false;
+	if ( ulMethod >= m_vecMethods.size() || ulPayloadSize > UINT32_MAX )
+		return false;
+
+	record.vecPayload.resize( (size_t)ulPayloadSize );
+	if ( ulPayloadSize && fread( &record.vecPayload[0], 1, (size_t)ulPayloadSize, m_pFile ) != ulPayloadSize )
+		return false;
+
+	const int64_t nDeltaNs = (int64_t)( ulDelta >> 1 ) ^ -(int64_t)( ulDelta & 1 );
+	m_ulLastStartNs += (uint64_t)nDeltaNs;
+
+	record.unMethod = (uint32_t)ulMethod;
+	record.ulStartNs = m_ulLastStartNs;
+	record.ulDurationNs = ulDurationNs;
+	return true;
+}
@@ -0,0 +1,172 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+
+// A capture file is k_rchApiCaptureMagic, then a header, then one record per call until the end.
+// Header: varint version, varint application type, varint method count, and per method its
+// "IVRSystem::PollNextEvent" name and interface version string.
+// Record: varint method index, varint start ns as a zigzag encoded difference from the previous
+// record's (threads can append slightly out of order), varint duration ns, varint payload size,
+// payload. The payload is the call's arguments before the call, then its return value and
+// everything it wrote through pointers; see generate_wrappers.py.
+static const char k_rchApiCaptureMagic[ 8 ] = { 'V', 'R', 'C', 'A', 'P', 'T', 'U', 'R' };
+static const uint32_t k_unApiCaptureVersion = 1;
+
+/** One method as named in a capture file's header */
+struct ApiCaptureMethod_t
+{
+	std::string sName;
+	std::string sInterfaceVersion;
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Builds one record's payload. Values are their raw bytes; counts,
+//			strings and arrays are prefixed with a varint that is 0 for NULL.
+//-----------------------------------------------------------------------------
+class CApiCaptureBuffer
+{
+public:
+	void Clear() { m_vecData.clear(); }
+	const uint8_t *GetData() const { return m_vecData.empty() ? NULL : &m_vecData[0]; }
+	size_t GetSize() const { return m_vecData.size(); }
+
+	void WriteBytes( const void *pData, size_t unSize );
+	void WriteVarint( uint64_t ulValue );
+
+	/** Length plus one and the characters with their terminator, or 0 for NULL. unMaxLength
+	* bounds strings read out of buffers the runtime may not have terminated. */
+	void WriteString( const char *pchValue, size_t unMaxLength = SIZE_MAX );
+
+	template < typename T >
+	void WriteValue( const T &value ) { WriteBytes( &value, sizeof( T ) ); }
+
+	/** Count plus one and the elements, or 0 for NULL */
+	template < typename T >
+	void WriteArray( const T *pArray, uint32_t unCount )
+	{
+		WriteVarint( pArray ? (uint64_t)unCount + 1 : 0 );
+		if ( pArray )
+			WriteBytes( pArray, sizeof( T ) * unCount );
+	}
+
+private:
+	std::vector< uint8_t > m_vecData;
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Reads a payload written by CApiCaptureBuffer. Reading past the end
+//			returns zeros and leaves IsValid() false, so callers check once.
+//-----------------------------------------------------------------------------
+class CApiCaptureReader
+{
+public:
+	CApiCaptureReader( const uint8_t *pData, size_t unSize ) : m_pData( pData ), m_unSize( unSize ), m_unOffset( 0 ), m_bValid( true ) {}
+
+	bool IsValid() const { return m_bValid; }
+
+	bool ReadBytes( void *pData, size_t unSize );
+	uint64_t ReadVarint();
+
+	/** Points into the payload, so it lives as long as the payload does. NULL for a NULL string. */
+	const char *ReadString();
+
+	template < typename T >
+	T ReadValue()
+	{
+		T value;
+		if ( !ReadBytes( &value, sizeof( T ) ) )
+			memset( &value, 0, sizeof( T ) );
+		return value;
+	}
+
+	/** Returns false for a NULL array. Elements are copied out, since the payload isn't aligned. */
+	template < typename T >
+	bool ReadArray( std::vector< T > &vecArray )
+	{
+		const uint64_t ulCount = ReadVarint();
+		vecArray.clear();
+		if ( ulCount == 0 || !m_bValid )
+			return false;
+
+		if ( ulCount - 1 > ( m_unSize - m_unOffset ) / sizeof( T ) )
+		{
+			m_bValid = false;
+			return false;
+		}
+		vecArray.resize( (size_t)( ulCount - 1 ) );
+		return ReadBytes( vecArray.empty() ? NULL : &vecArray[0], vecArray.size() * sizeof( T ) );
+	}
+
+private:
+	const uint8_t *m_pData;
+	size_t m_unSize;
+	size_t m_unOffset;
+	bool m_bValid;
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Appends records to a capture file from any thread
+//-----------------------------------------------------------------------------
+class CApiCaptureWriter
+{
+public:
+	CApiCaptureWriter();
+	~CApiCaptureWriter();
+
+	bool Open( const std::string &strFilename, uint32_t unApplicationType, const std::vector< ApiCaptureMethod_t > &vecMethods );
+	bool IsOpen() const { return m_pFile != NULL; }
+	void Flush();
+	void Close();
+
+	/** ulStartNs is nanoseconds since Open */
+	void WriteRecord( uint32_t unMethod, uint64_t ulStartNs, uint64_t ulDurationNs, const CApiCaptureBuffer &payload );
+
+private:
+	std::mutex m_mutex;
+	FILE *m_pFile;
+	uint64_t m_ulLastStartNs;
+	CApiCaptureBuffer m_recordHeader;
+};
+
+/** One call read back from a capture file */
+struct ApiCaptureRecord_t
+{
+	uint32_t unMethod;
+	uint64_t ulStartNs;
+	uint64_t ulDurationNs;
+	std::vector< uint8_t > vecPayload;
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Reads a capture file back one record at a time
+//-----------------------------------------------------------------------------
+class CApiCaptureFile
+{
+public:
+	CApiCaptureFile();
+	~CApiCaptureFile();
+
+	/** Reads the header. Fails on a missing file, a bad magic or a newer version. */
+	bool Open( const std::string &strFilename );
+
+	uint32_t GetApplicationType() const { return m_unApplicationType; }
+	const std::vector< ApiCaptureMethod_t > &GetMethods() const { return m_vecMethods; }
+
+	/** Returns false at the end of the file, or at a truncated last record */
+	bool ReadRecord( ApiCaptureRecord_t &record );
+
+private:
+	bool ReadVarint( uint64_t *pulValue );
+	bool ReadString( std::string &strValue );
+
+	FILE *m_pFile;
+	uint64_t m_ulLastStartNs;
+	uint32_t m_unApplicationType;
+	std::vector< ApiCaptureMethod_t > m_vecMethods;
+};
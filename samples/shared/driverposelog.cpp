@@ -0,0 +1,234 @@
+//========= Copyright Valve Corporation ============//
+#include "driverposelog.h"
+
+#include <string.h>
+
+// sanity limit on device indices, so a corrupt log fails instead of allocating gigabytes
+static const uint64_t k_ulMaxLoggedDevices = 1024;
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static void WriteQuaternion( CApiCaptureBuffer &buffer, const vr::HmdQuaternion_t &q )
+{
+	buffer.WriteValue( q.w );
+	buffer.WriteValue( q.x );
+	buffer.WriteValue( q.y );
+	buffer.WriteValue( q.z );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static void ReadQuaternion( CApiCaptureReader &reader, vr::HmdQuaternion_t &q )
+{
+	q.w = reader.ReadValue< double >();
+	q.x = reader.ReadValue< double >();
+	q.y = reader.ReadValue< double >();
+	q.z = reader.ReadValue< double >();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CDriverPoseLogWriter::CDriverPoseLogWriter()
+	: m_pFile( NULL )
+{
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CDriverPoseLogWriter::~CDriverPoseLogWriter()
+{
+	Close();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool CDriverPoseLogWriter::Open( const std::string &strFilename )
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( m_pFile )
+		return false;
+
+#if defined( _WIN32 )
+	if ( fopen_s( &m_pFile, strFilename.c_str(), "wb" ) != 0 )
+		m_pFile = NULL;
+#else
+	m_pFile = fopen( strFilename.c_str(), "wb" );
+#endif
+	if ( m_pFile == NULL )
+		return false;
+
+	m_entry.Clear();
+	m_entry.WriteBytes( k_rchDriverPoseLogMagic, sizeof( k_rchDriverPoseLogMagic ) );
+	m_entry.WriteVarint( k_unDriverPoseLogVersion );
+	fwrite( m_entry.GetData(), 1, m_entry.GetSize(), m_pFile );
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CDriverPoseLogWriter::Close()
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( m_pFile )
+		fclose( m_pFile );
+	m_pFile = NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CDriverPoseLogWriter::WriteDevice( uint32_t unDevice, vr::ETrackedDeviceClass eClass )
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( !m_pFile )
+		return;
+
+	m_entry.Clear();
+	m_entry.WriteVarint( DriverPoseLogEntry_Device );
+	m_entry.WriteVarint( unDevice );
+	m_entry.WriteVarint( (uint32_t)eClass );
+	fwrite( m_entry.GetData(), 1, m_entry.GetSize(), m_pFile );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CDriverPoseLogWriter::WritePose( uint32_t unDevice, double flTime, const vr::DriverPose_t &pose )
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( !m_pFile )
+		return;
+
+	m_entry.Clear();
+	m_entry.WriteVarint( DriverPoseLogEntry_Pose );
+	m_entry.WriteVarint( unDevice );
+	m_entry.WriteValue( flTime );
+	m_entry.WriteValue( pose.poseTimeOffset );
+	WriteQuaternion( m_entry, pose.qWorldFromDriverRotation );
+	m_entry.WriteBytes( pose.vecWorldFromDriverTranslation, sizeof( pose.vecWorldFromDriverTranslation ) );
+	WriteQuaternion( m_entry, pose.qDriverFromHeadRotation );
+	m_entry.WriteBytes( pose.vecDriverFromHeadTranslation, sizeof( pose.vecDriverFromHeadTranslation ) );
+	m_entry.WriteBytes( pose.vecPosition, sizeof( pose.vecPosition ) );
+	m_entry.WriteBytes( pose.vecVelocity, sizeof( pose.vecVelocity ) );
+	m_entry.WriteBytes( pose.vecAcceleration, sizeof( pose.vecAcceleration ) );
+	WriteQuaternion( m_entry, pose.qRotation );
+	m_entry.WriteBytes( pose.vecAngularVelocity, sizeof( pose.vecAngularVelocity ) );
+	m_entry.WriteBytes( pose.vecAngularAcceleration, sizeof( pose.vecAngularAcceleration ) );
+	m_entry.WriteVarint( (uint32_t)pose.result );
+	m_entry.WriteVarint( ( pose.poseIsValid ? 1u : 0u ) | ( pose.willDriftInYaw ? 2u : 0u ) | ( pose.shouldApplyHeadModel ? 4u : 0u ) );
+	fwrite( m_entry.GetData(), 1, m_entry.GetSize(), m_pFile );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static DriverPoseLogDevice_t *GetLoggedDevice( std::vector< DriverPoseLogDevice_t > &vecDevices, uint64_t ulDevice )
+{
+	if ( ulDevice >= k_ulMaxLoggedDevices )
+		return NULL;
+
+	if ( ulDevice >= vecDevices.size() )
+	{
+		DriverPoseLogDevice_t empty;
+		empty.eClass = vr::TrackedDeviceClass_Invalid;
+		vecDevices.resize( (size_t)ulDevice + 1, empty );
+	}
+	return &vecDevices[ (size_t)ulDevice ];
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: The whole file is read at once; logs are a few hundred bytes per pose
+//-----------------------------------------------------------------------------
+bool DriverPoseLog_Read( const std::string &strFilename, std::vector< DriverPoseLogDevice_t > &vecDevices )
+{
+	vecDevices.clear();
+
+	FILE *f;
+#if defined( _WIN32 )
+	if ( fopen_s( &f, strFilename.c_str(), "rb" ) != 0 )
+		f = NULL;
+#else
+	f = fopen( strFilename.c_str(), "rb" );
+#endif
+	if ( f == NULL )
+		return false;
+
+	std::vector< uint8_t > vecData;
+	uint8_t rubChunk[ 64 * 1024 ];
+	size_t unRead;
+	while ( ( unRead = fread( rubChunk, 1, sizeof( rubChunk ), f ) ) > 0 )
+		vecData.insert( vecData.end(), rubChunk, rubChunk + unRead );
+	fclose( f );
+
+	CApiCaptureReader reader( vecData.empty() ? NULL : &vecData[0], vecData.size() );
+	char rchMagic[ sizeof( k_rchDriverPoseLogMagic ) ];
+	if ( !reader.ReadBytes( rchMagic, sizeof( rchMagic ) ) || memcmp( rchMagic, k_rchDriverPoseLogMagic, sizeof( rchMagic ) ) != 0 )
+		return false;
+	const uint64_t ulVersion = reader.ReadVarint();
+	if ( !reader.IsValid() || ulVersion > k_unDriverPoseLogVersion )
+		return false;
+
+	for ( ;; )
+	{
+		const uint64_t ulType = reader.ReadVarint();
+		const uint64_t ulDevice = reader.ReadVarint();
+		if ( !reader.IsValid() )
+			break;
+
+		DriverPoseLogDevice_t *pDevice = GetLoggedDevice( vecDevices, ulDevice );
+		if ( !pDevice )
+			return false;
+
+		if ( ulType == DriverPoseLogEntry_Device )
+		{
+			const uint64_t ulClass = reader.ReadVarint();
+			if ( reader.IsValid() )
+				pDevice->eClass = (vr::ETrackedDeviceClass)ulClass;
+			continue;
+		}
+		if ( ulType != DriverPoseLogEntry_Pose )
+			return false;
+
+		DriverPoseSample_t sample;
+		memset( &sample, 0, sizeof( sample ) );
+		vr::DriverPose_t &pose = sample.pose;
+		sample.flTime = reader.ReadValue< double >();
+		pose.poseTimeOffset = reader.ReadValue< double >();
+		ReadQuaternion( reader, pose.qWorldFromDriverRotation );
+		reader.ReadBytes( pose.vecWorldFromDriverTranslation, sizeof( pose.vecWorldFromDriverTranslation ) );
+		ReadQuaternion( reader, pose.qDriverFromHeadRotation );
+		reader.ReadBytes( pose.vecDriverFromHeadTranslation, sizeof( pose.vecDriverFromHeadTranslation ) );
+		reader.ReadBytes( pose.vecPosition, sizeof( pose.vecPosition ) );
+		reader.ReadBytes( pose.vecVelocity, sizeof( pose.vecVelocity ) );
+		reader.ReadBytes( pose.vecAcceleration, sizeof( pose.vecAcceleration ) );
+		ReadQuaternion( reader, pose.qRotation );
+		reader.ReadBytes( pose.vecAngularVelocity, sizeof( pose.vecAngularVelocity ) );
+		reader.ReadBytes( pose.vecAngularAcceleration, sizeof( pose.vecAngularAcceleration ) );
+		pose.result = (vr::ETrackingResult)reader.ReadVarint();
+		const uint64_t ulFlags = reader.ReadVarint();
+		if ( !reader.IsValid() )
+			break;
+
+		pose.poseIsValid = ( ulFlags & 1 ) != 0;
+		pose.willDriftInYaw = ( ulFlags & 2 ) != 0;
+		pose.shouldApplyHeadModel = ( ulFlags & 4 ) != 0;
+		pDevice->vecPoses.push_back( sample );
+	}
+	return true;
+}
@@ -0,0 +1,69 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <stdio.h>
+
+#include <openvr_driver.h>
+
+#include "apicapture.h"
+
+// A pose log is k_rchDriverPoseLogMagic, a varint version, then entries until the end. Each
+// entry is a varint type (EDriverPoseLogEntry) and its fields, encoded with CApiCaptureBuffer.
+// Fields are written one by one rather than as the raw struct, so logs don't depend on
+// the packing the recording side was built with.
+static const char k_rchDriverPoseLogMagic[ 8 ] = { 'V', 'R', 'P', 'O', 'S', 'L', 'O', 'G' };
+static const uint32_t k_unDriverPoseLogVersion = 1;
+
+enum EDriverPoseLogEntry
+{
+	DriverPoseLogEntry_Device = 0,	// varint device index, varint ETrackedDeviceClass
+	DriverPoseLogEntry_Pose = 1,	// varint device index, double seconds, the DriverPose_t fields
+};
+
+/** One logged pose. flTime is when the driver reported it; the pose itself is from
+* flTime + pose.poseTimeOffset. */
+struct DriverPoseSample_t
+{
+	double flTime;
+	vr::DriverPose_t pose;
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Appends the poses a driver reports to a log, from any thread. Meant
+//			to be called from a server host's TrackedDevicePoseUpdated.
+//-----------------------------------------------------------------------------
+class CDriverPoseLogWriter
+{
+public:
+	CDriverPoseLogWriter();
+	~CDriverPoseLogWriter();
+
+	bool Open( const std::string &strFilename );
+	bool IsOpen() const { return m_pFile != NULL; }
+	void Close();
+
+	void WriteDevice( uint32_t unDevice, vr::ETrackedDeviceClass eClass );
+
+	/** flTime is seconds on any clock, as long as it is the same one for the whole log */
+	void WritePose( uint32_t unDevice, double flTime, const vr::DriverPose_t &pose );
+
+private:
+	std::mutex m_mutex;
+	FILE *m_pFile;
+	CApiCaptureBuffer m_entry;
+};
+
+/** Everything a pose log holds for one device, poses in the order they were reported */
+struct DriverPoseLogDevice_t
+{
+	vr::ETrackedDeviceClass eClass;	// TrackedDeviceClass_Invalid if the log never said
+	std::vector< DriverPoseSample_t > vecPoses;
+};
+
+/** Reads a whole log into vecDevices, indexed by device. Fails on a missing file, a bad magic or a
+* newer version; a truncated last entry is dropped. */
+bool DriverPoseLog_Read( const std::string &strFilename, std::vector< DriverPoseLogDevice_t > &vecDevices );
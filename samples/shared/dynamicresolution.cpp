@@ -0,0 +1,142 @@
+//========= Copyright Valve Corporation ============//
+#include "dynamicresolution.h"
+
+#include <cmath>
+#include <cstring>
+
+// GPU timings arrive a few frames late, so ignore that many after a change
+static const uint32_t k_unSettleFrames = 6;
+
+// how long the next level up must be predicted to fit before moving to it
+static const uint32_t k_unFramesBeforeUp = 45;
+
+// the next level up has to fit with this much to spare, which keeps a level
+// that only just fits from bouncing
+static const double k_flUpHeadroom = 0.9;
+
+static const double k_flSmoothing = 0.25;
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CDynamicResolution::CDynamicResolution()
+	: m_flMinScale( 1.0f )
+	, m_flScaleStep( 0.0f )
+	, m_nLevels( 1 )
+	, m_nLevel( 0 )
+	, m_flGpuBudgetMs( 0.0 )
+	, m_flSmoothedGpuMs( -1.0 )
+	, m_unSettleFrames( 0 )
+	, m_unFramesWithHeadroom( 0 )
+{
+	ResetStats();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CDynamicResolution::Init( float flMinScale, float flMaxScale, uint32_t unLevels, double flGpuBudgetMs )
+{
+	m_flMinScale = flMinScale;
+	m_nLevels = unLevels < 2 ? 2 : (int)unLevels;
+	m_flScaleStep = ( flMaxScale - flMinScale ) / ( m_nLevels - 1 );
+	m_flGpuBudgetMs = flGpuBudgetMs;
+
+	int nLevel = m_flScaleStep > 0.0f ? (int)floorf( ( 1.0f - flMinScale ) / m_flScaleStep + 0.5f ) : 0;
+	if ( nLevel < 0 )
+		nLevel = 0;
+	if ( nLevel > m_nLevels - 1 )
+		nLevel = m_nLevels - 1;
+	SetLevel( nLevel );
+	ResetStats();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+float CDynamicResolution::GetScaleForLevel( int nLevel ) const
+{
+	return m_flMinScale + nLevel * m_flScaleStep;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool CDynamicResolution::Update( double flGpuMs )
+{
+	m_stats.unFrames++;
+	m_stats.flGpuMs += flGpuMs;
+	m_stats.flScale += GetScale();
+
+	if ( m_unSettleFrames > 0 )
+	{
+		m_unSettleFrames--;
+		return false;
+	}
+
+	if ( m_flSmoothedGpuMs < 0.0 )
+		m_flSmoothedGpuMs = flGpuMs;
+	else
+		m_flSmoothedGpuMs += k_flSmoothing * ( flGpuMs - m_flSmoothedGpuMs );
+
+	const float flScale = GetScale();
+
+	// a single frame over budget is already a dropped frame, so don't wait for the average
+	const double flCostMs = flGpuMs > m_flSmoothedGpuMs ? flGpuMs : m_flSmoothedGpuMs;
+	if ( flCostMs > m_flGpuBudgetMs && m_nLevel > 0 )
+	{
+		int nLevel = m_nLevel - 1;
+		while ( nLevel > 0 )
+		{
+			const float flRatio = GetScaleForLevel( nLevel ) / flScale;
+			if ( flCostMs * flRatio * flRatio <= m_flGpuBudgetMs )
+				break;
+			nLevel--;
+		}
+		m_stats.unLevelsDown += m_nLevel - nLevel;
+		SetLevel( nLevel );
+		return true;
+	}
+
+	if ( m_nLevel < m_nLevels - 1 )
+	{
+		const float flRatio = GetScaleForLevel( m_nLevel + 1 ) / flScale;
+		if ( m_flSmoothedGpuMs * flRatio * flRatio <= m_flGpuBudgetMs * k_flUpHeadroom )
+		{
+			if ( ++m_unFramesWithHeadroom >= k_unFramesBeforeUp )
+			{
+				m_stats.unLevelsUp++;
+				SetLevel( m_nLevel + 1 );
+				return true;
+			}
+			return false;
+		}
+	}
+
+	m_unFramesWithHeadroom = 0;
+	return false;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CDynamicResolution::SetLevel( int nLevel )
+{
+	m_nLevel = nLevel;
+	m_flSmoothedGpuMs = -1.0;
+	m_unSettleFrames = k_unSettleFrames;
+	m_unFramesWithHeadroom = 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CDynamicResolution::ResetStats()
+{
+	memset( &m_stats, 0, sizeof( m_stats ) );
+}
@@ -0,0 +1,55 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <cstdint>
+
+/** Running totals since the last ResetStats() */
+struct ResolutionStats_t
+{
+	uint32_t unFrames;
+	uint32_t unLevelsDown;
+	uint32_t unLevelsUp;
+	double flGpuMs;
+	double flScale;
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Picks a render resolution scale from measured GPU frame times.
+//			The scale moves between flMinScale and flMaxScale in fixed steps
+//			(fidelity levels). An overrun drops straight to the highest level
+//			predicted to fit, assuming cost scales with pixel count; going up
+//			is one level at a time and only after the frame time has stayed
+//			low for a while, so the scale doesn't oscillate.
+//-----------------------------------------------------------------------------
+class CDynamicResolution
+{
+public:
+	CDynamicResolution();
+
+	/** unLevels >= 2 levels spaced evenly from flMinScale to flMaxScale. Starts at the level
+	* closest to a scale of 1. flGpuBudgetMs is how much of a frame the GPU may spend. */
+	void Init( float flMinScale, float flMaxScale, uint32_t unLevels, double flGpuBudgetMs );
+
+	/** Feeds one frame's GPU time. Returns true if the level changed. */
+	bool Update( double flGpuMs );
+
+	int GetLevel() const { return m_nLevel; }
+	float GetScale() const { return GetScaleForLevel( m_nLevel ); }
+	float GetScaleForLevel( int nLevel ) const;
+
+	const ResolutionStats_t & GetStats() const { return m_stats; }
+	void ResetStats();
+
+private:
+	void SetLevel( int nLevel );
+
+	float m_flMinScale;
+	float m_flScaleStep;
+	int m_nLevels;
+	int m_nLevel;
+	double m_flGpuBudgetMs;
+	double m_flSmoothedGpuMs;	// < 0 until the first sample at the current level
+	uint32_t m_unSettleFrames;	// frames left whose timings may still be from the previous level
+	uint32_t m_unFramesWithHeadroom;
+	ResolutionStats_t m_stats;
+};
@@ -0,0 +1,97 @@
+//========= Copyright Valve Corporation ============//
+#include "framescheduler.h"
+
+#include <cmath>
+#include <cstring>
+
+// frames measured before the first delay
+static const uint32_t k_unWarmupFrames = 30;
+
+// smoothing for the running mean and deviation; costs above the prediction
+// are taken on much faster so a heavier scene is not scheduled too late twice
+static const double k_flSmoothing = 0.05;
+static const double k_flOverrunSmoothing = 0.5;
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CFrameScheduler::CFrameScheduler( double flSafetyMarginMs )
+	: m_flSafetyMarginMs( flSafetyMarginMs )
+	, m_flMeanMs( 0.0 )
+	, m_flDeviationMs( 0.0 )
+	, m_unSamples( 0 )
+	, m_bLastFrameDelayed( false )
+	, m_flLastPredictedMs( 0.0 )
+{
+	ResetStats();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: CPU and GPU are added since the GPU can't finish before the CPU
+//			has submitted
+//-----------------------------------------------------------------------------
+void CFrameScheduler::AddFrameCost( double flCpuMs, double flGpuMs )
+{
+	const double flCostMs = flCpuMs + flGpuMs;
+
+	if ( m_bLastFrameDelayed )
+	{
+		m_stats.flMeasuredMs += flCostMs;
+		if ( flCostMs > m_flLastPredictedMs )
+			m_stats.unOverBudgetFrames++;
+		m_bLastFrameDelayed = false;
+	}
+
+	if ( m_unSamples++ == 0 )
+	{
+		m_flMeanMs = flCostMs;
+		m_flDeviationMs = 0.0;
+		return;
+	}
+
+	const double flSmoothing = flCostMs > GetPredictedCostMs() ? k_flOverrunSmoothing : k_flSmoothing;
+	m_flDeviationMs += flSmoothing * ( fabs( flCostMs - m_flMeanMs ) - m_flDeviationMs );
+	m_flMeanMs += flSmoothing * ( flCostMs - m_flMeanMs );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+double CFrameScheduler::GetPredictedCostMs() const
+{
+	return m_flMeanMs + 3.0 * m_flDeviationMs + m_flSafetyMarginMs;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+double CFrameScheduler::GetStartDelayMs( double flTimeRemainingMs )
+{
+	m_stats.unFrames++;
+	if ( m_unSamples < k_unWarmupFrames )
+		return 0.0;
+
+	const double flPredictedMs = GetPredictedCostMs();
+	const double flDelayMs = flTimeRemainingMs - flPredictedMs;
+	if ( flDelayMs <= 0.0 )
+		return 0.0;
+
+	m_stats.unDelayedFrames++;
+	m_stats.flDelayMs += flDelayMs;
+	m_stats.flPredictedMs += flPredictedMs;
+	m_bLastFrameDelayed = true;
+	m_flLastPredictedMs = flPredictedMs;
+	return flDelayMs;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CFrameScheduler::ResetStats()
+{
+	memset( &m_stats, 0, sizeof( m_stats ) );
+}
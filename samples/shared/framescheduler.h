@@ -0,0 +1,50 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <cstdint>
+
+/** Running totals of the scheduling decisions since the last ResetStats() */
+struct FrameScheduleStats_t
+{
+	uint32_t unFrames;
+	uint32_t unDelayedFrames;
+	uint32_t unOverBudgetFrames;	// delayed frames that then took longer than predicted
+	double flDelayMs;
+	double flPredictedMs;
+	double flMeasuredMs;
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Decides how late a frame can start. It learns what a frame costs
+//			(CPU time up to submission plus GPU render time) and, given how
+//			long is left before the frame is due, returns how long the caller
+//			can wait so that input and poses are sampled as late as possible
+//			while still leaving the predicted cost plus a margin.
+//-----------------------------------------------------------------------------
+class CFrameScheduler
+{
+public:
+	explicit CFrameScheduler( double flSafetyMarginMs = 1.0 );
+
+	/** Feeds back what the last frame actually cost */
+	void AddFrameCost( double flCpuMs, double flGpuMs );
+
+	/** Mean cost plus three deviations plus the safety margin */
+	double GetPredictedCostMs() const;
+
+	/** Returns how long to wait before starting a frame that is due in flTimeRemainingMs.
+	* Always 0 until enough frames have been measured to trust the prediction. */
+	double GetStartDelayMs( double flTimeRemainingMs );
+
+	const FrameScheduleStats_t & GetStats() const { return m_stats; }
+	void ResetStats();
+
+private:
+	double m_flSafetyMarginMs;
+	double m_flMeanMs;
+	double m_flDeviationMs;
+	uint32_t m_unSamples;
+	bool m_bLastFrameDelayed;
+	double m_flLastPredictedMs;
+	FrameScheduleStats_t m_stats;
+};
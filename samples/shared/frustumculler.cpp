@@ -0,0 +1,347 @@
+//========= Copyright Valve Corporation ============//
+#include "frustumculler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+//-----------------------------------------------------------------------------
+// Purpose: Moves a plane by a rigid transform
+//-----------------------------------------------------------------------------
+static FrustumPlane_t TransformPlane( const FrustumPlane_t &plane, const Matrix4 &mat )
+{
+	const float *m = mat.get();
+	FrustumPlane_t out;
+	out.a = m[0] * plane.a + m[4] * plane.b + m[8] * plane.c;
+	out.b = m[1] * plane.a + m[5] * plane.b + m[9] * plane.c;
+	out.c = m[2] * plane.a + m[6] * plane.b + m[10] * plane.c;
+	out.d = plane.d - ( out.a * m[12] + out.b * m[13] + out.c * m[14] );
+	return out;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static FrustumPlane_t MakePlane( float a, float b, float c, float d )
+{
+	float flScale = 1.0f / sqrtf( a * a + b * b + c * c );
+	FrustumPlane_t plane = { a * flScale, b * flScale, c * flScale, d * flScale };
+	return plane;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Half the sum of |normal| components; a cube of side s centred on a
+//			point is inside a plane if its centre is no more than s * this
+//			behind it.
+//-----------------------------------------------------------------------------
+static float CubeRadiusScale( const FrustumPlane_t &plane )
+{
+	return 0.5f * ( fabsf( plane.a ) + fabsf( plane.b ) + fabsf( plane.c ) );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Builds one eye's planes and corners in head space
+//-----------------------------------------------------------------------------
+static void BuildEyeFrustum( const EyeFrustum_t &eye, float flNear, float flFar, FrustumPlane_t *pPlanes, Vector3 *pCorners )
+{
+	const FrustumPlane_t rEyePlanes[ 6 ] =
+	{
+		MakePlane( 1.0f, 0.0f, eye.flLeft, 0.0f ),
+		MakePlane( -1.0f, 0.0f, -eye.flRight, 0.0f ),
+		MakePlane( 0.0f, 1.0f, eye.flTop, 0.0f ),
+		MakePlane( 0.0f, -1.0f, -eye.flBottom, 0.0f ),
+		MakePlane( 0.0f, 0.0f, -1.0f, -flNear ),
+		MakePlane( 0.0f, 0.0f, 1.0f, flFar ),
+	};
+	for ( int i = 0; i < 6; i++ )
+		pPlanes[i] = TransformPlane( rEyePlanes[i], eye.matEyeToHead );
+
+	const float rflDepth[ 2 ] = { flNear, flFar };
+	for ( int i = 0; i < 8; i++ )
+	{
+		float z = rflDepth[ i >> 2 ];
+		float x = ( i & 1 ) ? eye.flRight : eye.flLeft;
+		float y = ( i & 2 ) ? eye.flBottom : eye.flTop;
+		Vector4 vCorner = eye.matEyeToHead * Vector4( x * z, y * z, -z, 1.0f );
+		pCorners[i].set( vCorner.x, vCorner.y, vCorner.z );
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CFrustumCuller::CFrustumCuller()
+{
+	memset( m_rHeadPlanes, 0, sizeof( m_rHeadPlanes ) );
+	memset( &m_stats, 0, sizeof( m_stats ) );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Builds the combined stereo frustum. Any plane that has every corner
+//			of both eye frusta on its inside contains both (convex) frusta, so
+//			each side takes one eye's plane and pushes it out just far enough
+//			to also hold the other eye's corners.
+//-----------------------------------------------------------------------------
+void CFrustumCuller::SetStereoFrustum( const EyeFrustum_t &left, const EyeFrustum_t &right, float flNear, float flFar )
+{
+	FrustumPlane_t rCandidates[ 2 ][ 6 ];
+	Vector3 rCorners[ 16 ];
+	BuildEyeFrustum( left, flNear, flFar, rCandidates[0], rCorners );
+	BuildEyeFrustum( right, flNear, flFar, rCandidates[1], rCorners + 8 );
+
+	for ( int nSide = 0; nSide < 6; nSide++ )
+	{
+		float flBestPush = 0.0f;
+		for ( int nEye = 0; nEye < 2; nEye++ )
+		{
+			FrustumPlane_t plane = rCandidates[ nEye ][ nSide ];
+
+			float flPush = 0.0f;
+			for ( int i = 0; i < 16; i++ )
+			{
+				float flDist = plane.a * rCorners[i].x + plane.b * rCorners[i].y + plane.c * rCorners[i].z + plane.d;
+				flPush = std::max< float >( flPush, -flDist );
+			}
+
+			if ( nEye == 0 || flPush < flBestPush )
+			{
+				flBestPush = flPush;
+				plane.d += flPush;
+				m_rHeadPlanes[ nSide ] = plane;
+			}
+		}
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Bins the instances into a grid of roughly unInstancesPerCell each
+//-----------------------------------------------------------------------------
+void CFrustumCuller::SetInstances( const float *pflInstances, uint32_t unCount, uint32_t unInstancesPerCell )
+{
+	m_vecInstances.clear();
+	m_vecCells.clear();
+	if ( unCount == 0 )
+		return;
+
+	Vector3 vMin( pflInstances[0], pflInstances[1], pflInstances[2] );
+	Vector3 vMax( vMin );
+	for ( uint32_t i = 0; i < unCount; i++ )
+	{
+		const float *pfl = pflInstances + i * 4;
+		vMin.set( std::min( vMin.x, pfl[0] ), std::min( vMin.y, pfl[1] ), std::min( vMin.z, pfl[2] ) );
+		vMax.set( std::max( vMax.x, pfl[0] + pfl[3] ), std::max( vMax.y, pfl[1] + pfl[3] ), std::max( vMax.z, pfl[2] + pfl[3] ) );
+	}
+
+	// cubic cells sized so the bounding box holds about unCount / unInstancesPerCell of them
+	int rnDims[ 3 ] = { 1, 1, 1 };
+	Vector3 vExtent = vMax - vMin;
+	if ( unInstancesPerCell > 0 && unCount > unInstancesPerCell )
+	{
+		const float flMinExtent = 1e-3f;
+		float flVolume = std::max( vExtent.x, flMinExtent ) * std::max( vExtent.y, flMinExtent ) * std::max( vExtent.z, flMinExtent );
+		float flCellSize = cbrtf( flVolume * unInstancesPerCell / unCount );
+		const float rflExtent[ 3 ] = { vExtent.x, vExtent.y, vExtent.z };
+		for ( int i = 0; i < 3; i++ )
+			rnDims[i] = std::min( 1024, std::max( 1, (int)ceilf( rflExtent[i] / flCellSize ) ) );
+	}
+	const float rflCellScale[ 3 ] =
+	{
+		vExtent.x > 0.0f ? rnDims[0] / vExtent.x : 0.0f,
+		vExtent.y > 0.0f ? rnDims[1] / vExtent.y : 0.0f,
+		vExtent.z > 0.0f ? rnDims[2] / vExtent.z : 0.0f,
+	};
+
+	// counting sort by the cell holding each cube's min corner
+	std::vector< uint32_t > vecCellOf( unCount );
+	std::vector< uint32_t > vecCellStart( (size_t)rnDims[0] * rnDims[1] * rnDims[2] + 1, 0 );
+	for ( uint32_t i = 0; i < unCount; i++ )
+	{
+		const float *pfl = pflInstances + i * 4;
+		int x = std::min( rnDims[0] - 1, (int)( ( pfl[0] - vMin.x ) * rflCellScale[0] ) );
+		int y = std::min( rnDims[1] - 1, (int)( ( pfl[1] - vMin.y ) * rflCellScale[1] ) );
+		int z = std::min( rnDims[2] - 1, (int)( ( pfl[2] - vMin.z ) * rflCellScale[2] ) );
+		vecCellOf[i] = ( z * rnDims[1] + y ) * rnDims[0] + x;
+		vecCellStart[ vecCellOf[i] + 1 ]++;
+	}
+	for ( size_t i = 1; i < vecCellStart.size(); i++ )
+		vecCellStart[i] += vecCellStart[ i - 1 ];
+
+	m_vecInstances.resize( (size_t)unCount * 4 );
+	std::vector< uint32_t > vecCellFill( vecCellStart.begin(), vecCellStart.end() - 1 );
+	for ( uint32_t i = 0; i < unCount; i++ )
+		memcpy( &m_vecInstances[ (size_t)vecCellFill[ vecCellOf[i] ]++ * 4 ], pflInstances + i * 4, sizeof( float ) * 4 );
+
+	// cell bounds come from their members, so cubes poking into neighbouring cells are still covered
+	for ( size_t nCell = 0; nCell + 1 < vecCellStart.size(); nCell++ )
+	{
+		Cell_t cell;
+		cell.unFirst = vecCellStart[ nCell ];
+		cell.unCount = vecCellStart[ nCell + 1 ] - cell.unFirst;
+		if ( cell.unCount == 0 )
+			continue;
+
+		const float *pfl = &m_vecInstances[ (size_t)cell.unFirst * 4 ];
+		cell.vMin.set( pfl[0], pfl[1], pfl[2] );
+		cell.vMax = cell.vMin;
+		for ( uint32_t i = 0; i < cell.unCount; i++, pfl += 4 )
+		{
+			cell.vMin.set( std::min( cell.vMin.x, pfl[0] ), std::min( cell.vMin.y, pfl[1] ), std::min( cell.vMin.z, pfl[2] ) );
+			cell.vMax.set( std::max( cell.vMax.x, pfl[0] + pfl[3] ), std::max( cell.vMax.y, pfl[1] + pfl[3] ), std::max( cell.vMax.z, pfl[2] + pfl[3] ) );
+		}
+		m_vecCells.push_back( cell );
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Culls against the stereo frustum placed at matHeadToWorld
+//-----------------------------------------------------------------------------
+uint32_t CFrustumCuller::Cull( const Matrix4 &matHeadToWorld, float *pflVisible )
+{
+	std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+	FrustumPlane_t rPlanes[ 6 ];
+	for ( int i = 0; i < 6; i++ )
+		rPlanes[i] = TransformPlane( m_rHeadPlanes[i], matHeadToWorld );
+
+	memset( &m_stats, 0, sizeof( m_stats ) );
+	m_stats.unInstances = GetInstanceCount();
+	m_stats.unCells = (uint32_t)m_vecCells.size();
+
+	uint32_t unVisible = 0;
+	for ( std::vector< Cell_t >::const_iterator i = m_vecCells.begin(); i != m_vecCells.end(); i++ )
+	{
+		Vector3 vCenter = ( i->vMin + i->vMax ) * 0.5f;
+		Vector3 vHalf = ( i->vMax - i->vMin ) * 0.5f;
+
+		bool bOutside = false;
+		bool bStraddles = false;
+		for ( int p = 0; p < 6 && !bOutside; p++ )
+		{
+			const FrustumPlane_t &plane = rPlanes[p];
+			float flDist = plane.a * vCenter.x + plane.b * vCenter.y + plane.c * vCenter.z + plane.d;
+			float flRadius = fabsf( plane.a ) * vHalf.x + fabsf( plane.b ) * vHalf.y + fabsf( plane.c ) * vHalf.z;
+			bOutside = flDist < -flRadius;
+			bStraddles = bStraddles || flDist < flRadius;
+		}
+
+		if ( bOutside )
+		{
+			m_stats.unCellsRejected++;
+		}
+		else if ( !bStraddles )
+		{
+			m_stats.unCellsAccepted++;
+			memcpy( pflVisible + (size_t)unVisible * 4, &m_vecInstances[ (size_t)i->unFirst * 4 ], sizeof( float ) * 4 * i->unCount );
+			unVisible += i->unCount;
+		}
+		else
+		{
+			unVisible += CullInstances( rPlanes, i->unFirst, i->unCount, pflVisible + (size_t)unVisible * 4 );
+		}
+	}
+
+	m_stats.unVisible = unVisible;
+	m_stats.flMilliseconds = std::chrono::duration< double, std::milli >( std::chrono::high_resolution_clock::now() - startTime ).count();
+	return unVisible;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Tests each cube's bounding box against all six planes and copies
+//			out the ones that are not completely behind any of them
+//-----------------------------------------------------------------------------
+uint32_t CFrustumCuller::CullInstances( const FrustumPlane_t *pPlanes, uint32_t unFirst, uint32_t unCount, float *pflVisible ) const
+{
+	float rflRadiusScale[ 6 ];
+	for ( int p = 0; p < 6; p++ )
+		rflRadiusScale[p] = CubeRadiusScale( pPlanes[p] );
+
+	const float *pflIn = &m_vecInstances[ (size_t)unFirst * 4 ];
+	uint32_t unVisible = 0;
+	uint32_t i = 0;
+
+#if defined( MATRICES_SSE ) || defined( MATRICES_NEON )
+	for ( ; i + 4 <= unCount; i += 4, pflIn += 16 )
+	{
+#if defined( MATRICES_SSE )
+		__m128 x = _mm_loadu_ps( pflIn );
+		__m128 y = _mm_loadu_ps( pflIn + 4 );
+		__m128 z = _mm_loadu_ps( pflIn + 8 );
+		__m128 s = _mm_loadu_ps( pflIn + 12 );
+		_MM_TRANSPOSE4_PS( x, y, z, s );
+
+		__m128 half = _mm_mul_ps( s, _mm_set1_ps( 0.5f ) );
+		x = _mm_add_ps( x, half );
+		y = _mm_add_ps( y, half );
+		z = _mm_add_ps( z, half );
+
+		__m128 inside = _mm_castsi128_ps( _mm_set1_epi32( -1 ) );
+		for ( int p = 0; p < 6; p++ )
+		{
+			__m128 dist = _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, _mm_set1_ps( pPlanes[p].a ) ), _mm_mul_ps( y, _mm_set1_ps( pPlanes[p].b ) ) ),
+				_mm_add_ps( _mm_mul_ps( z, _mm_set1_ps( pPlanes[p].c ) ), _mm_set1_ps( pPlanes[p].d ) ) );
+			__m128 radius = _mm_mul_ps( s, _mm_set1_ps( rflRadiusScale[p] ) );
+			inside = _mm_and_ps( inside, _mm_cmpge_ps( _mm_add_ps( dist, radius ), _mm_setzero_ps() ) );
+		}
+		int nMask = _mm_movemask_ps( inside );
+#else
+		// vld4q deinterleaves straight into x, y, z, scale
+		float32x4x4_t cubes = vld4q_f32( pflIn );
+		float32x4_t half = vmulq_n_f32( cubes.val[3], 0.5f );
+		float32x4_t x = vaddq_f32( cubes.val[0], half );
+		float32x4_t y = vaddq_f32( cubes.val[1], half );
+		float32x4_t z = vaddq_f32( cubes.val[2], half );
+
+		uint32x4_t inside = vdupq_n_u32( 0xFFFFFFFF );
+		for ( int p = 0; p < 6; p++ )
+		{
+			float32x4_t dist = vdupq_n_f32( pPlanes[p].d );
+			dist = vmlaq_n_f32( dist, x, pPlanes[p].a );
+			dist = vmlaq_n_f32( dist, y, pPlanes[p].b );
+			dist = vmlaq_n_f32( dist, z, pPlanes[p].c );
+			dist = vmlaq_n_f32( dist, cubes.val[3], rflRadiusScale[p] );
+			inside = vandq_u32( inside, vcgeq_f32( dist, vdupq_n_f32( 0.0f ) ) );
+		}
+		int nMask = ( vgetq_lane_u32( inside, 0 ) & 1 ) | ( vgetq_lane_u32( inside, 1 ) & 2 ) |
+			( vgetq_lane_u32( inside, 2 ) & 4 ) | ( vgetq_lane_u32( inside, 3 ) & 8 );
+#endif
+
+		if ( nMask == 0xF )
+		{
+			memcpy( pflVisible + (size_t)unVisible * 4, pflIn, sizeof( float ) * 16 );
+			unVisible += 4;
+		}
+		else if ( nMask != 0 )
+		{
+			for ( int j = 0; j < 4; j++ )
+			{
+				if ( nMask & ( 1 << j ) )
+					memcpy( pflVisible + (size_t)unVisible++ * 4, pflIn + j * 4, sizeof( float ) * 4 );
+			}
+		}
+	}
+#endif
+
+	for ( ; i < unCount; i++, pflIn += 4 )
+	{
+		float flHalf = pflIn[3] * 0.5f;
+		bool bInside = true;
+		for ( int p = 0; p < 6 && bInside; p++ )
+		{
+			float flDist = pPlanes[p].a * ( pflIn[0] + flHalf ) + pPlanes[p].b * ( pflIn[1] + flHalf ) + pPlanes[p].c * ( pflIn[2] + flHalf ) + pPlanes[p].d;
+			bInside = flDist + pflIn[3] * rflRadiusScale[p] >= 0.0f;
+		}
+		if ( bInside )
+			memcpy( pflVisible + (size_t)unVisible++ * 4, pflIn, sizeof( float ) * 4 );
+	}
+
+	return unVisible;
+}
@@ -0,0 +1,82 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Matrices.h"
+
+/** One eye's view volume. The tangents are as returned by IVRSystem::GetProjectionRaw:
+* x/-z runs from flLeft to flRight and y/-z runs from flTop to flBottom in eye space. */
+struct EyeFrustum_t
+{
+	float flLeft;
+	float flRight;
+	float flTop;
+	float flBottom;
+	Matrix4 matEyeToHead;	// must be rigid, e.g. from IVRSystem::GetEyeToHeadTransform
+};
+
+/** Inside where a*x + b*y + c*z + d >= 0. (a, b, c) is unit length. */
+struct FrustumPlane_t
+{
+	float a, b, c, d;
+};
+
+/** Counters from the most recent Cull() */
+struct CullStats_t
+{
+	uint32_t unInstances;
+	uint32_t unVisible;
+	uint32_t unCells;
+	uint32_t unCellsRejected;		// outside the frustum, none of their instances were tested
+	uint32_t unCellsAccepted;		// inside the frustum, all of their instances were kept untested
+	double flMilliseconds;
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Culls instanced unit cubes against one frustum that covers both
+//			eyes, so a stereo frame is culled once and both eyes draw the same
+//			visible list. Instances are binned into a uniform grid; whole cells
+//			are accepted or rejected first and only the instances in cells that
+//			straddle the frustum are tested, four at a time.
+//-----------------------------------------------------------------------------
+class CFrustumCuller
+{
+public:
+	CFrustumCuller();
+
+	/** Builds a six plane head space frustum that contains both eyes' frusta between
+	* flNear and flFar. Each side comes from whichever eye needs the smaller push
+	* outwards to also contain the other eye. */
+	void SetStereoFrustum( const EyeFrustum_t &left, const EyeFrustum_t &right, float flNear, float flFar );
+
+	/** Copies the instances to cull. Each instance is four floats (x, y, z, scale) placing
+	* a unit cube at [xyz, xyz + scale]. unInstancesPerCell sizes the grid; 0 disables it. */
+	void SetInstances( const float *pflInstances, uint32_t unCount, uint32_t unInstancesPerCell = 64 );
+
+	uint32_t GetInstanceCount() const { return (uint32_t)( m_vecInstances.size() / 4 ); }
+
+	/** Writes the visible instances, in the same four float layout, to pflVisible which must
+	* have room for GetInstanceCount() instances. matHeadToWorld must be rigid.
+	* Returns the number of visible instances. */
+	uint32_t Cull( const Matrix4 &matHeadToWorld, float *pflVisible );
+
+	const CullStats_t & GetStats() const { return m_stats; }
+
+private:
+	struct Cell_t
+	{
+		Vector3 vMin;
+		Vector3 vMax;
+		uint32_t unFirst;
+		uint32_t unCount;
+	};
+
+	uint32_t CullInstances( const FrustumPlane_t *pPlanes, uint32_t unFirst, uint32_t unCount, float *pflVisible ) const;
+
+	FrustumPlane_t m_rHeadPlanes[ 6 ];
+	std::vector< float > m_vecInstances;	// grouped by cell
+	std::vector< Cell_t > m_vecCells;
+	CullStats_t m_stats;
+};
@@ -0,0 +1,249 @@
+//========= Copyright Valve Corporation ============//
+#include "imageloader.h"
+#include "pathtools.h"
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// Purpose: Starts the worker threads
+//-----------------------------------------------------------------------------
+CImageLoader::CImageLoader( unsigned nThreads )
+	: m_nQueuedJobs( 0 )
+	, m_bShutdown( false )
+	, m_nNextWorker( 0 )
+	, m_unNextSequence( 0 )
+	, m_nOutstanding( 0 )
+{
+	if ( nThreads == 0 )
+		nThreads = std::max< unsigned >( 1u, std::thread::hardware_concurrency() );
+
+	for ( unsigned i = 0; i < nThreads; i++ )
+		m_vecWorkers.push_back( std::unique_ptr< Worker_t >( new Worker_t ) );
+
+	for ( unsigned i = 0; i < nThreads; i++ )
+		m_vecThreads.push_back( std::thread( &CImageLoader::WorkerThread, this, i ) );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Finishes all queued jobs and joins the worker threads
+//-----------------------------------------------------------------------------
+CImageLoader::~CImageLoader()
+{
+	{
+		std::lock_guard< std::mutex > lock( m_idleMutex );
+		m_bShutdown = true;
+	}
+	m_idleCondition.notify_all();
+
+	for ( std::vector< std::thread >::iterator i = m_vecThreads.begin(); i != m_vecThreads.end(); i++ )
+		i->join();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Queues a single image
+//-----------------------------------------------------------------------------
+std::shared_future< ImageHandle_t > CImageLoader::Load( const ImageRequest_t & request )
+{
+	Job_t job;
+	job.request = request;
+	job.pPromise = std::make_shared< std::promise< ImageHandle_t > >();
+	std::shared_future< ImageHandle_t > future = job.pPromise->get_future().share();
+	Push( job );
+	return future;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Queues a batch of images. The batch is dealt out to the workers in
+//			priority order so every worker starts on the most important images.
+//			The returned futures are in the same order as the requests.
+//-----------------------------------------------------------------------------
+std::vector< std::shared_future< ImageHandle_t > > CImageLoader::LoadBatch( const std::vector< ImageRequest_t > & requests )
+{
+	std::vector< size_t > order( requests.size() );
+	for ( size_t i = 0; i < order.size(); i++ )
+		order[i] = i;
+
+	std::stable_sort( order.begin(), order.end(), [&requests]( size_t a, size_t b )
+	{
+		return requests[a].nPriority > requests[b].nPriority;
+	} );
+
+	std::vector< std::shared_future< ImageHandle_t > > futures( requests.size() );
+	for ( size_t i = 0; i < order.size(); i++ )
+		futures[ order[i] ] = Load( requests[ order[i] ] );
+
+	return futures;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Returns the highest-priority completed image, if there is one
+//-----------------------------------------------------------------------------
+ImageHandle_t CImageLoader::PopCompleted()
+{
+	std::lock_guard< std::mutex > lock( m_completedMutex );
+	if ( m_completed.empty() )
+		return ImageHandle_t();
+
+	ImageHandle_t pImage = m_completed.top().first;
+	m_completed.pop();
+	m_nOutstanding--;
+	return pImage;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Waits for the next completed image
+//-----------------------------------------------------------------------------
+ImageHandle_t CImageLoader::WaitForCompleted()
+{
+	std::unique_lock< std::mutex > lock( m_completedMutex );
+	m_completedCondition.wait( lock, [this] { return !m_completed.empty() || m_nOutstanding == 0; } );
+	if ( m_completed.empty() )
+		return ImageHandle_t();
+
+	ImageHandle_t pImage = m_completed.top().first;
+	m_completed.pop();
+	m_nOutstanding--;
+	return pImage;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+size_t CImageLoader::GetOutstandingCount() const
+{
+	std::lock_guard< std::mutex > lock( m_completedMutex );
+	return m_nOutstanding;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Hands a job to the next worker round-robin and wakes one sleeper
+//-----------------------------------------------------------------------------
+void CImageLoader::Push( Job_t & job )
+{
+	{
+		std::lock_guard< std::mutex > lock( m_completedMutex );
+		m_nOutstanding++;
+	}
+
+	unsigned nWorker;
+	{
+		std::lock_guard< std::mutex > lock( m_idleMutex );
+		job.unSequence = m_unNextSequence++;
+		nWorker = m_nNextWorker;
+		m_nNextWorker = ( m_nNextWorker + 1 ) % m_vecWorkers.size();
+		m_nQueuedJobs++;
+	}
+
+	{
+		Worker_t *pWorker = m_vecWorkers[ nWorker ].get();
+		std::lock_guard< std::mutex > lock( pWorker->mutex );
+		pWorker->jobs.push_back( job );
+	}
+	m_idleCondition.notify_one();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Takes the oldest job from our own queue, or steals the newest job
+//			from another worker's queue so the two ends rarely contend.
+//-----------------------------------------------------------------------------
+bool CImageLoader::PopJob( unsigned nWorker, Job_t & job )
+{
+	{
+		Worker_t *pWorker = m_vecWorkers[ nWorker ].get();
+		std::lock_guard< std::mutex > lock( pWorker->mutex );
+		if ( !pWorker->jobs.empty() )
+		{
+			job = pWorker->jobs.front();
+			pWorker->jobs.pop_front();
+			m_nQueuedJobs--;
+			return true;
+		}
+	}
+
+	for ( size_t i = 1; i < m_vecWorkers.size(); i++ )
+	{
+		Worker_t *pVictim = m_vecWorkers[ ( nWorker + i ) % m_vecWorkers.size() ].get();
+		std::lock_guard< std::mutex > lock( pVictim->mutex );
+		if ( !pVictim->jobs.empty() )
+		{
+			job = pVictim->jobs.back();
+			pVictim->jobs.pop_back();
+			m_nQueuedJobs--;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Runs jobs until the loader is destroyed and the queues are empty
+//-----------------------------------------------------------------------------
+void CImageLoader::WorkerThread( unsigned nWorker )
+{
+	for ( ;; )
+	{
+		Job_t job;
+		if ( PopJob( nWorker, job ) )
+		{
+			ImageHandle_t pImage = Decode( job.request );
+			{
+				std::lock_guard< std::mutex > lock( m_completedMutex );
+				m_completed.push( std::make_pair( pImage, job.unSequence ) );
+			}
+			m_completedCondition.notify_all();
+			job.pPromise->set_value( pImage );
+			continue;
+		}
+
+		std::unique_lock< std::mutex > lock( m_idleMutex );
+		m_idleCondition.wait( lock, [this] { return m_bShutdown || m_nQueuedJobs > 0; } );
+		if ( m_bShutdown && m_nQueuedJobs == 0 )
+			return;
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Reads and decodes one image on the calling thread
+//-----------------------------------------------------------------------------
+ImageHandle_t CImageLoader::Decode( const ImageRequest_t & request )
+{
+	std::shared_ptr< ImageData_t > pImage = std::make_shared< ImageData_t >();
+	pImage->sName = request.sFilename;
+	pImage->nWidth = 0;
+	pImage->nHeight = 0;
+	pImage->eFormat = request.eFormat;
+	pImage->nPriority = request.nPriority;
+	pImage->unUserData = request.unUserData;
+
+	const unsigned char *pData = request.buffer.empty() ? NULL : &request.buffer[0];
+	size_t nSize = request.buffer.size();
+
+	// decode straight out of the mapped file rather than copying it into memory first
+	CMappedFile file;
+	if ( !pData )
+	{
+		if ( !file.Open( request.sFilename ) )
+		{
+			pImage->nError = 78;
+			return pImage;
+		}
+		pData = file.Data();
+		nSize = file.Size();
+	}
+
+	lodepng::State state;
+	state.decoder.pixel_format = request.eFormat;
+	pImage->nError = lodepng::decode( pImage->pixels, pImage->nWidth, pImage->nHeight, state, pData, nSize );
+	return pImage;
+}
@@ -0,0 +1,121 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lodepng.h"
+
+/** A decoded image. nError is the lodepng error code, or 78 if the file could not be read. */
+struct ImageData_t
+{
+	std::string sName;
+	std::vector<unsigned char> pixels;
+	unsigned nWidth;
+	unsigned nHeight;
+	LodePNGPixelFormat eFormat;
+	int nPriority;
+	uint64_t unUserData;	// from the request
+	unsigned nError;
+};
+
+typedef std::shared_ptr< const ImageData_t > ImageHandle_t;
+
+/** Describes one image to decode. If buffer is empty the image is read from sFilename,
+* otherwise sFilename is only used as the image's name. Higher priorities are decoded and
+* handed back to the caller first. */
+struct ImageRequest_t
+{
+	ImageRequest_t() : eFormat( LPF_RAW ), nPriority( 0 ), unUserData( 0 ) {}
+	ImageRequest_t( const std::string & sFile, int nPri = 0, LodePNGPixelFormat eFmt = LPF_RAW )
+		: sFilename( sFile ), eFormat( eFmt ), nPriority( nPri ), unUserData( 0 ) {}
+
+	std::string sFilename;
+	std::vector<unsigned char> buffer;
+	LodePNGPixelFormat eFormat;	// LPF_RAW decodes to plain RGBA8
+	int nPriority;
+	uint64_t unUserData;		// handed back untouched in the image, e.g. the caller's index for it
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Decodes batches of PNG files on a work-stealing thread pool.
+//			Each request returns a future; completed images are also queued so
+//			that the GL thread can upload them in priority order with
+//			PopCompleted() without blocking on any particular image.
+//-----------------------------------------------------------------------------
+class CImageLoader
+{
+public:
+	/** nThreads == 0 uses one worker per hardware thread */
+	explicit CImageLoader( unsigned nThreads = 0 );
+	~CImageLoader();
+
+	std::shared_future< ImageHandle_t > Load( const ImageRequest_t & request );
+	std::vector< std::shared_future< ImageHandle_t > > LoadBatch( const std::vector< ImageRequest_t > & requests );
+
+	/** Returns the highest-priority completed image that has not been popped yet,
+	* or an empty handle if none is ready. Never blocks. */
+	ImageHandle_t PopCompleted();
+
+	/** Like PopCompleted but blocks until an image is ready. Returns an empty handle
+	* once every submitted image has been popped. */
+	ImageHandle_t WaitForCompleted();
+
+	/** Number of submitted images that have not been popped yet */
+	size_t GetOutstandingCount() const;
+
+	unsigned GetThreadCount() const { return (unsigned)m_vecWorkers.size(); }
+
+private:
+	struct Job_t
+	{
+		ImageRequest_t request;
+		uint64_t unSequence;
+		std::shared_ptr< std::promise< ImageHandle_t > > pPromise;
+	};
+
+	struct Worker_t
+	{
+		std::mutex mutex;
+		std::deque< Job_t > jobs;
+	};
+
+	struct CompletedOrder_t
+	{
+		bool operator()( const std::pair< ImageHandle_t, uint64_t > & a, const std::pair< ImageHandle_t, uint64_t > & b ) const
+		{
+			if ( a.first->nPriority != b.first->nPriority )
+				return a.first->nPriority < b.first->nPriority;
+			return a.second > b.second;
+		}
+	};
+
+	void WorkerThread( unsigned nWorker );
+	bool PopJob( unsigned nWorker, Job_t & job );
+	void Push( Job_t & job );
+	static ImageHandle_t Decode( const ImageRequest_t & request );
+
+	std::vector< std::unique_ptr< Worker_t > > m_vecWorkers;
+	std::vector< std::thread > m_vecThreads;
+
+	std::mutex m_idleMutex;
+	std::condition_variable m_idleCondition;
+	std::atomic< size_t > m_nQueuedJobs;
+	bool m_bShutdown;
+	unsigned m_nNextWorker;
+	uint64_t m_unNextSequence;
+
+	mutable std::mutex m_completedMutex;
+	std::condition_variable m_completedCondition;
+	std::priority_queue< std::pair< ImageHandle_t, uint64_t >, std::vector< std::pair< ImageHandle_t, uint64_t > >, CompletedOrder_t > m_completed;
+	size_t m_nOutstanding;
+};
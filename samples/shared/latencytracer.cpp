@@ -0,0 +1,265 @@
+//========= Copyright Valve Corporation ============//
+#include "latencytracer.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "tracebuffer.h"
+
+/** What WriteReport prints for each frame, measured between two stages */
+struct LatencyInterval_t
+{
+	const char *pchName;
+	ELatencyStage eFrom;
+	ELatencyStage eTo;
+};
+
+static const LatencyInterval_t k_rLatencyIntervals[] =
+{
+	{ "pose age", LatencyStage_PoseUpdated, LatencyStage_PosesReturned },
+	{ "app", LatencyStage_PosesReturned, LatencyStage_Submitted },
+	{ "compositor", LatencyStage_Submitted, LatencyStage_Presented },
+	{ "poses to photons", LatencyStage_PosesReturned, LatencyStage_Presented },
+	{ "motion to photons", LatencyStage_PoseUpdated, LatencyStage_Presented },
+};
+static const uint32_t k_unLatencyIntervals = sizeof( k_rLatencyIntervals ) / sizeof( k_rLatencyIntervals[0] );
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CLatencyTracer::CLatencyTracer( uint32_t unCapacity )
+	: m_unCapacity( std::max< uint32_t >( 1, unCapacity ) )
+	, m_pPoses( new PoseSample_t[ std::max< uint32_t >( 1, unCapacity ) ] )
+	, m_pFrames( new LatencyFrame_t[ std::max< uint32_t >( 1, unCapacity ) ] )
+	, m_unLastPoseId( 0 )
+{
+	for ( uint32_t i = 0; i < m_unCapacity; i++ )
+	{
+		m_pPoses[i].unPoseId.store( 0, std::memory_order_relaxed );
+		m_pPoses[i].ulTicks.store( 0, std::memory_order_relaxed );
+		m_pFrames[i].unFrame.store( 0, std::memory_order_relaxed );
+		m_pFrames[i].unPoseId.store( 0, std::memory_order_relaxed );
+		for ( uint32_t unStage = 0; unStage < LatencyStage_Count; unStage++ )
+			m_pFrames[i].rulTicks[ unStage ].store( 0, std::memory_order_relaxed );
+	}
+	for ( uint32_t i = 0; i < k_unMaxLatencyDevices; i++ )
+		m_runLatestPoseIds[i].store( 0, std::memory_order_relaxed );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: The slot's id is cleared while it is rewritten, so a reader that
+//			sees the same id before and after reading the ticks has them whole
+//-----------------------------------------------------------------------------
+uint32_t CLatencyTracer::PoseUpdated( uint32_t unDevice, uint64_t ulTicks )
+{
+	uint32_t unPoseId = m_unLastPoseId.fetch_add( 1, std::memory_order_relaxed ) + 1;
+	if ( unPoseId == 0 )
+		unPoseId = m_unLastPoseId.fetch_add( 1, std::memory_order_relaxed ) + 1;
+
+	PoseSample_t &sample = m_pPoses[ unPoseId % m_unCapacity ];
+	sample.unPoseId.store( 0, std::memory_order_relaxed );
+	std::atomic_thread_fence( std::memory_order_release );
+	sample.ulTicks.store( ulTicks, std::memory_order_relaxed );
+	sample.unPoseId.store( unPoseId, std::memory_order_release );
+
+	if ( unDevice < k_unMaxLatencyDevices )
+		m_runLatestPoseIds[ unDevice ].store( unPoseId, std::memory_order_release );
+	return unPoseId;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+uint32_t CLatencyTracer::GetLatestPoseId( uint32_t unDevice ) const
+{
+	return unDevice < k_unMaxLatencyDevices ? m_runLatestPoseIds[ unDevice ].load( std::memory_order_acquire ) : 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: 0 if the sample has already been overwritten
+//-----------------------------------------------------------------------------
+uint64_t CLatencyTracer::GetPoseTicks( uint32_t unPoseId ) const
+{
+	if ( unPoseId == 0 )
+		return 0;
+
+	const PoseSample_t &sample = m_pPoses[ unPoseId % m_unCapacity ];
+	if ( sample.unPoseId.load( std::memory_order_acquire ) != unPoseId )
+		return 0;
+	const uint64_t ulTicks = sample.ulTicks.load( std::memory_order_relaxed );
+	std::atomic_thread_fence( std::memory_order_acquire );
+	return sample.unPoseId.load( std::memory_order_relaxed ) == unPoseId ? ulTicks : 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: NULL if the frame was never started or has been overwritten
+//-----------------------------------------------------------------------------
+CLatencyTracer::LatencyFrame_t *CLatencyTracer::FindFrame( uint32_t unFrameIndex )
+{
+	LatencyFrame_t &frame = m_pFrames[ unFrameIndex % m_unCapacity ];
+	return frame.unFrame.load( std::memory_order_acquire ) == unFrameIndex + 1 ? &frame : NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CLatencyTracer::PosesReturned( uint32_t unFrameIndex, uint32_t unPoseId, uint64_t ulTicks )
+{
+	LatencyFrame_t &frame = m_pFrames[ unFrameIndex % m_unCapacity ];
+	frame.unFrame.store( 0, std::memory_order_relaxed );
+	std::atomic_thread_fence( std::memory_order_release );
+	frame.unPoseId.store( unPoseId, std::memory_order_relaxed );
+	frame.rulTicks[ LatencyStage_PoseUpdated ].store( GetPoseTicks( unPoseId ), std::memory_order_relaxed );
+	frame.rulTicks[ LatencyStage_PosesReturned ].store( ulTicks, std::memory_order_relaxed );
+	frame.rulTicks[ LatencyStage_Submitted ].store( 0, std::memory_order_relaxed );
+	frame.rulTicks[ LatencyStage_Presented ].store( 0, std::memory_order_relaxed );
+	frame.unFrame.store( unFrameIndex + 1, std::memory_order_release );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CLatencyTracer::Submitted( uint32_t unFrameIndex, uint64_t ulTicks )
+{
+	if ( LatencyFrame_t *pFrame = FindFrame( unFrameIndex ) )
+		pFrame->rulTicks[ LatencyStage_Submitted ].store( ulTicks, std::memory_order_release );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CLatencyTracer::Presented( uint32_t unFrameIndex, uint64_t ulTicks )
+{
+	if ( LatencyFrame_t *pFrame = FindFrame( unFrameIndex ) )
+	{
+		uint64_t ulNotPresented = 0;
+		pFrame->rulTicks[ LatencyStage_Presented ].compare_exchange_strong( ulNotPresented, ulTicks, std::memory_order_release );
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Frames still being written are read as they are; this is meant for
+//			once the pipeline has stopped, or for a rough look while it runs
+//-----------------------------------------------------------------------------
+void CLatencyTracer::WriteReport( FILE *f, bool bPerFrame ) const
+{
+	struct ReportFrame_t
+	{
+		uint32_t unFrameIndex;
+		uint32_t unPoseId;
+		uint64_t rulTicks[ LatencyStage_Count ];
+	};
+
+	std::vector< ReportFrame_t > vecFrames;
+	for ( uint32_t i = 0; i < m_unCapacity; i++ )
+	{
+		const LatencyFrame_t &frame = m_pFrames[i];
+		const uint32_t unFrame = frame.unFrame.load( std::memory_order_acquire );
+		if ( unFrame == 0 )
+			continue;
+
+		ReportFrame_t reportFrame;
+		reportFrame.unFrameIndex = unFrame - 1;
+		reportFrame.unPoseId = frame.unPoseId.load( std::memory_order_relaxed );
+		for ( uint32_t unStage = 0; unStage < LatencyStage_Count; unStage++ )
+			reportFrame.rulTicks[ unStage ] = frame.rulTicks[ unStage ].load( std::memory_order_acquire );
+		vecFrames.push_back( reportFrame );
+	}
+	std::sort( vecFrames.begin(), vecFrames.end(), []( const ReportFrame_t &a, const ReportFrame_t &b ) { return a.unFrameIndex < b.unFrameIndex; } );
+
+	// frames after the last presented one may still be on their way, so they don't count as lost
+	uint32_t unLastPresented = 0;
+	bool bAnyPresented = false;
+	for ( const ReportFrame_t &frame : vecFrames )
+	{
+		if ( frame.rulTicks[ LatencyStage_Presented ] )
+		{
+			unLastPresented = frame.unFrameIndex;
+			bAnyPresented = true;
+		}
+	}
+
+	const double flMsPerTick = 1000.0 / Trace_GetTimestampFrequency();
+	std::vector< double > rvecIntervalMs[ k_unLatencyIntervals ];
+	uint32_t unPresented = 0, unNotSubmitted = 0, unNotPresented = 0;
+
+	if ( bPerFrame )
+	{
+		fprintf( f, "%10s %10s", "frame", "pose id" );
+		for ( uint32_t i = 0; i < k_unLatencyIntervals; i++ )
+			fprintf( f, " %18s", k_rLatencyIntervals[i].pchName );
+		fprintf( f, "\n" );
+	}
+
+	for ( const ReportFrame_t &frame : vecFrames )
+	{
+		if ( !frame.rulTicks[ LatencyStage_Presented ] )
+		{
+			if ( bAnyPresented && frame.unFrameIndex < unLastPresented )
+			{
+				if ( frame.rulTicks[ LatencyStage_Submitted ] )
+					unNotPresented++;
+				else
+					unNotSubmitted++;
+			}
+			continue;
+		}
+
+		unPresented++;
+		if ( bPerFrame )
+			fprintf( f, "%10u %10u", frame.unFrameIndex, frame.unPoseId );
+		for ( uint32_t i = 0; i < k_unLatencyIntervals; i++ )
+		{
+			const uint64_t ulFrom = frame.rulTicks[ k_rLatencyIntervals[i].eFrom ];
+			const uint64_t ulTo = frame.rulTicks[ k_rLatencyIntervals[i].eTo ];
+			if ( !ulFrom || !ulTo || ulTo < ulFrom )
+			{
+				if ( bPerFrame )
+					fprintf( f, " %18s", "-" );
+				continue;
+			}
+
+			const double flMs = ( ulTo - ulFrom ) * flMsPerTick;
+			rvecIntervalMs[i].push_back( flMs );
+			if ( bPerFrame )
+				fprintf( f, " %18.3f", flMs );
+		}
+		if ( bPerFrame )
+			fprintf( f, "\n" );
+	}
+
+	if ( bPerFrame )
+		fprintf( f, "\n" );
+	fprintf( f, "%u frames presented, %u submitted but never presented, %u never submitted\n\n", unPresented, unNotPresented, unNotSubmitted );
+	fprintf( f, "%-18s %8s %10s %10s %10s %10s %10s\n", "ms", "frames", "mean", "p50", "p90", "p99", "max" );
+	for ( uint32_t i = 0; i < k_unLatencyIntervals; i++ )
+	{
+		std::vector< double > &vecMs = rvecIntervalMs[i];
+		if ( vecMs.empty() )
+		{
+			fprintf( f, "%-18s %8u %10s %10s %10s %10s %10s\n", k_rLatencyIntervals[i].pchName, 0, "-", "-", "-", "-", "-" );
+			continue;
+		}
+
+		std::sort( vecMs.begin(), vecMs.end() );
+		double flTotalMs = 0.0;
+		for ( double flMs : vecMs )
+			flTotalMs += flMs;
+		const size_t unLast = vecMs.size() - 1;
+		fprintf( f, "%-18s %8u %10.3f %10.3f %10.3f %10.3f %10.3f\n", k_rLatencyIntervals[i].pchName, (uint32_t)vecMs.size(),
+			flTotalMs / vecMs.size(),
+			vecMs[ std::min( unLast, (size_t)( vecMs.size() * 0.5 ) ) ],
+			vecMs[ std::min( unLast, (size_t)( vecMs.size() * 0.9 ) ) ],
+			vecMs[ std::min( unLast, (size_t)( vecMs.size() * 0.99 ) ) ],
+			vecMs[ unLast ] );
+	}
+}
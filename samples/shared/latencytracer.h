@@ -0,0 +1,79 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdio.h>
+
+/** The points a pose sample passes on its way to the display, in order */
+enum ELatencyStage
+{
+	LatencyStage_PoseUpdated = 0,	// the driver reported it through IServerDriverHost::TrackedDevicePoseUpdated
+	LatencyStage_PosesReturned = 1,	// WaitGetPoses handed it to the application
+	LatencyStage_Submitted = 2,		// the frame rendered with it went to Submit
+	LatencyStage_Presented = 3,		// the compositor presented that frame, per its Compositor_FrameTiming
+	LatencyStage_Count
+};
+
+// per device latest pose ids are kept for this many devices
+static const uint32_t k_unMaxLatencyDevices = 64;
+
+//-----------------------------------------------------------------------------
+// Purpose: Follows pose samples from the driver to the display. The driver side
+//			tags each sample with an id; the frame that renders with it carries
+//			the id, and each stage stamps the frame with Trace_GetTimestamp()
+//			ticks. Every method can be called from any thread without locking.
+//			The newest unCapacity samples and frames are kept.
+//-----------------------------------------------------------------------------
+class CLatencyTracer
+{
+public:
+	explicit CLatencyTracer( uint32_t unCapacity = 4096 );
+
+	/** Tags a new sample from unDevice. Returns its id, which is never 0. */
+	uint32_t PoseUpdated( uint32_t unDevice, uint64_t ulTicks );
+
+	/** The id of the newest sample from unDevice, or 0 if there hasn't been one */
+	uint32_t GetLatestPoseId( uint32_t unDevice ) const;
+
+	/** Starts frame unFrameIndex with the poses of sample unPoseId. unPoseId is 0 when the
+	* sample isn't known, as with a real runtime, and the frame then starts at this stage. */
+	void PosesReturned( uint32_t unFrameIndex, uint32_t unPoseId, uint64_t ulTicks );
+
+	/** The last Submit of a frame counts, since the frame isn't handed over until both eyes are */
+	void Submitted( uint32_t unFrameIndex, uint64_t ulTicks );
+
+	/** The first present of a frame counts; later ones are reprojections */
+	void Presented( uint32_t unFrameIndex, uint64_t ulTicks );
+
+	/** Writes the time between stages for every presented frame still kept, oldest first,
+	* when bPerFrame is set, then percentiles of each stage and how many frames never made it */
+	void WriteReport( FILE *f, bool bPerFrame ) const;
+
+private:
+	CLatencyTracer( const CLatencyTracer & );
+	CLatencyTracer & operator=( const CLatencyTracer & );
+
+	struct PoseSample_t
+	{
+		std::atomic< uint32_t > unPoseId;	// 0 while being written
+		std::atomic< uint64_t > ulTicks;
+	};
+
+	struct LatencyFrame_t
+	{
+		std::atomic< uint32_t > unFrame;	// frame index + 1, 0 while being written
+		std::atomic< uint32_t > unPoseId;
+		std::atomic< uint64_t > rulTicks[ LatencyStage_Count ];	// 0 until the stage is reached
+	};
+
+	uint64_t GetPoseTicks( uint32_t unPoseId ) const;
+	LatencyFrame_t *FindFrame( uint32_t unFrameIndex );
+
+	uint32_t m_unCapacity;
+	std::unique_ptr< PoseSample_t[] > m_pPoses;
+	std::unique_ptr< LatencyFrame_t[] > m_pFrames;
+	std::atomic< uint32_t > m_unLastPoseId;
+	std::atomic< uint32_t > m_runLatestPoseIds[ k_unMaxLatencyDevices ];
+};
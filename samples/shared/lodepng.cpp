@@ -32,6 +32,16 @@ Rename this file to lodepng.cpp to use it for C++, or to lodepng.c to use it for
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
+
+/*SIMD kernels for the GPU pixel format conversions, the scalar code is used for the remaining pixels*/
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LODEPNG_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LODEPNG_NEON
+#include <arm_neon.h>
+#endif
 
 #ifdef LODEPNG_COMPILE_CPP
 #include <fstream>
@@ -63,24 +73,56 @@ lodepng source code. Don't forget to remove "static" if you copypaste them
 from here.*/
 
 #ifdef LODEPNG_COMPILE_ALLOCATORS
+#if defined(_MSC_VER)
+#define LODEPNG_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define LODEPNG_THREAD_LOCAL __thread
+#else
+#define LODEPNG_THREAD_LOCAL
+#endif
+
+/*the custom allocator of the decode or encode call in progress on this thread, if any*/
+static LODEPNG_THREAD_LOCAL const LodePNGAllocator* lodepng_current_allocator = 0;
+
 static void* lodepng_malloc(size_t size)
 {
+  const LodePNGAllocator* allocator = lodepng_current_allocator;
+  if(allocator) return allocator->alloc(allocator->context, size);
   return malloc(size);
 }
 
 static void* lodepng_realloc(void* ptr, size_t new_size)
 {
+  const LodePNGAllocator* allocator = lodepng_current_allocator;
+  if(allocator) return allocator->realloc(allocator->context, ptr, new_size);
   return realloc(ptr, new_size);
 }
 
 static void lodepng_free(void* ptr)
 {
-  free(ptr);
+  const LodePNGAllocator* allocator = lodepng_current_allocator;
+  if(allocator) allocator->free(allocator->context, ptr);
+  else free(ptr);
+}
+
+/*makes the given allocator (null for the C ones) the current one, returns the previous one to restore later*/
+static const LodePNGAllocator* lodepng_set_allocator(const LodePNGAllocator* allocator)
+{
+  const LodePNGAllocator* previous = lodepng_current_allocator;
+  lodepng_current_allocator = allocator;
+  return previous;
 }
 #else /*LODEPNG_COMPILE_ALLOCATORS*/
 void* lodepng_malloc(size_t size);
 void* lodepng_realloc(void* ptr, size_t new_size);
 void lodepng_free(void* ptr);
+
+/*custom allocators from the settings are ignored when the allocator functions are user defined*/
+static const LodePNGAllocator* lodepng_set_allocator(const LodePNGAllocator* allocator)
+{
+  (void)allocator;
+  return 0;
+}
 #endif /*LODEPNG_COMPILE_ALLOCATORS*/
 
 /* ////////////////////////////////////////////////////////////////////////// */
@@ -3468,6 +3510,237 @@ unsigned lodepng_convert(unsigned char* out, const unsigned char* in,
   return 0; /*no error (this function currently never has one, but maybe OOM detection added later.)*/
 }
 
+/*half float of the linear value of each 8-bit sRGB value*/
+static const unsigned short SRGB8_TO_LINEAR_HALF[256]
+  = {0x0000, 0x0cf9, 0x10f9, 0x1376, 0x14f9, 0x1637, 0x1776, 0x185a, 0x18f9, 0x1998, 0x1a37, 0x1adb,
+     0x1b88, 0x1c1f, 0x1c7f, 0x1ce4, 0x1d4e, 0x1dbd, 0x1e32, 0x1eab, 0x1f2a, 0x1fae, 0x201c, 0x2063,
+     0x20ad, 0x20fa, 0x214a, 0x219d, 0x21f2, 0x224a, 0x22a6, 0x2304, 0x2365, 0x23c9, 0x2418, 0x244d,
+     0x2484, 0x24bc, 0x24f6, 0x2532, 0x256f, 0x25ad, 0x25ed, 0x262f, 0x2673, 0x26b8, 0x26ff, 0x2747,
+     0x2791, 0x27dd, 0x2815, 0x283d, 0x2865, 0x288f, 0x28b9, 0x28e4, 0x2910, 0x293d, 0x296a, 0x2999,
+     0x29c9, 0x29f9, 0x2a2a, 0x2a5d, 0x2a90, 0x2ac4, 0x2af9, 0x2b2f, 0x2b66, 0x2b9e, 0x2bd7, 0x2c08,
+     0x2c26, 0x2c44, 0x2c62, 0x2c81, 0x2ca0, 0x2cc0, 0x2ce0, 0x2d01, 0x2d22, 0x2d44, 0x2d66, 0x2d89,
+     0x2dad, 0x2dd0, 0x2df5, 0x2e1a, 0x2e3f, 0x2e65, 0x2e8b, 0x2eb2, 0x2ed9, 0x2f01, 0x2f2a, 0x2f53,
+     0x2f7c, 0x2fa7, 0x2fd1, 0x2ffc, 0x3014, 0x302a, 0x3040, 0x3057, 0x306e, 0x3085, 0x309d, 0x30b4,
+     0x30cc, 0x30e5, 0x30fd, 0x3116, 0x312f, 0x3149, 0x3162, 0x317c, 0x3197, 0x31b1, 0x31cc, 0x31e7,
+     0x3203, 0x321e, 0x323a, 0x3257, 0x3273, 0x3290, 0x32ad, 0x32cb, 0x32e8, 0x3306, 0x3325, 0x3343,
+     0x3362, 0x3381, 0x33a1, 0x33c1, 0x33e1, 0x3401, 0x3411, 0x3422, 0x3432, 0x3443, 0x3454, 0x3465,
+     0x3476, 0x3488, 0x3499, 0x34ab, 0x34bd, 0x34cf, 0x34e1, 0x34f4, 0x3506, 0x3519, 0x352c, 0x353f,
+     0x3552, 0x3565, 0x3578, 0x358c, 0x35a0, 0x35b4, 0x35c8, 0x35dc, 0x35f1, 0x3605, 0x361a, 0x362f,
+     0x3644, 0x3659, 0x366f, 0x3684, 0x369a, 0x36b0, 0x36c6, 0x36dc, 0x36f2, 0x3709, 0x3720, 0x3736,
+     0x374d, 0x3765, 0x377c, 0x3794, 0x37ab, 0x37c3, 0x37db, 0x37f3, 0x3806, 0x3812, 0x381f, 0x382b,
+     0x3838, 0x3844, 0x3851, 0x385e, 0x386b, 0x3877, 0x3885, 0x3892, 0x389f, 0x38ac, 0x38ba, 0x38c7,
+     0x38d5, 0x38e2, 0x38f0, 0x38fe, 0x390c, 0x391a, 0x3928, 0x3936, 0x3944, 0x3953, 0x3961, 0x3970,
+     0x397e, 0x398d, 0x399c, 0x39ab, 0x39ba, 0x39c9, 0x39d8, 0x39e7, 0x39f7, 0x3a06, 0x3a16, 0x3a25,
+     0x3a35, 0x3a45, 0x3a55, 0x3a65, 0x3a75, 0x3a85, 0x3a95, 0x3aa5, 0x3ab6, 0x3ac6, 0x3ad7, 0x3ae8,
+     0x3af9, 0x3b09, 0x3b1a, 0x3b2c, 0x3b3d, 0x3b4e, 0x3b5f, 0x3b71, 0x3b82, 0x3b94, 0x3ba6, 0x3bb8,
+     0x3bca, 0x3bdc, 0x3bee, 0x3c00};
+
+/*half float of each 8-bit value divided by 255, for alpha*/
+static const unsigned short UNORM8_TO_HALF[256]
+  = {0x0000, 0x1c04, 0x2004, 0x2206, 0x2404, 0x2505, 0x2606, 0x2707, 0x2804, 0x2885, 0x2905, 0x2986,
+     0x2a06, 0x2a87, 0x2b07, 0x2b88, 0x2c04, 0x2c44, 0x2c85, 0x2cc5, 0x2d05, 0x2d45, 0x2d86, 0x2dc6,
+     0x2e06, 0x2e46, 0x2e87, 0x2ec7, 0x2f07, 0x2f47, 0x2f88, 0x2fc8, 0x3004, 0x3024, 0x3044, 0x3064,
+     0x3085, 0x30a5, 0x30c5, 0x30e5, 0x3105, 0x3125, 0x3145, 0x3165, 0x3186, 0x31a6, 0x31c6, 0x31e6,
+     0x3206, 0x3226, 0x3246, 0x3266, 0x3287, 0x32a7, 0x32c7, 0x32e7, 0x3307, 0x3327, 0x3347, 0x3367,
+     0x3388, 0x33a8, 0x33c8, 0x33e8, 0x3404, 0x3414, 0x3424, 0x3434, 0x3444, 0x3454, 0x3464, 0x3474,
+     0x3485, 0x3495, 0x34a5, 0x34b5, 0x34c5, 0x34d5, 0x34e5, 0x34f5, 0x3505, 0x3515, 0x3525, 0x3535,
+     0x3545, 0x3555, 0x3565, 0x3575, 0x3586, 0x3596, 0x35a6, 0x35b6, 0x35c6, 0x35d6, 0x35e6, 0x35f6,
+     0x3606, 0x3616, 0x3626, 0x3636, 0x3646, 0x3656, 0x3666, 0x3676, 0x3687, 0x3697, 0x36a7, 0x36b7,
+     0x36c7, 0x36d7, 0x36e7, 0x36f7, 0x3707, 0x3717, 0x3727, 0x3737, 0x3747, 0x3757, 0x3767, 0x3777,
+     0x3788, 0x3798, 0x37a8, 0x37b8, 0x37c8, 0x37d8, 0x37e8, 0x37f8, 0x3804, 0x380c, 0x3814, 0x381c,
+     0x3824, 0x382c, 0x3834, 0x383c, 0x3844, 0x384c, 0x3854, 0x385c, 0x3864, 0x386c, 0x3874, 0x387c,
+     0x3885, 0x388d, 0x3895, 0x389d, 0x38a5, 0x38ad, 0x38b5, 0x38bd, 0x38c5, 0x38cd, 0x38d5, 0x38dd,
+     0x38e5, 0x38ed, 0x38f5, 0x38fd, 0x3905, 0x390d, 0x3915, 0x391d, 0x3925, 0x392d, 0x3935, 0x393d,
+     0x3945, 0x394d, 0x3955, 0x395d, 0x3965, 0x396d, 0x3975, 0x397d, 0x3986, 0x398e, 0x3996, 0x399e,
+     0x39a6, 0x39ae, 0x39b6, 0x39be, 0x39c6, 0x39ce, 0x39d6, 0x39de, 0x39e6, 0x39ee, 0x39f6, 0x39fe,
+     0x3a06, 0x3a0e, 0x3a16, 0x3a1e, 0x3a26, 0x3a2e, 0x3a36, 0x3a3e, 0x3a46, 0x3a4e, 0x3a56, 0x3a5e,
+     0x3a66, 0x3a6e, 0x3a76, 0x3a7e, 0x3a87, 0x3a8f, 0x3a97, 0x3a9f, 0x3aa7, 0x3aaf, 0x3ab7, 0x3abf,
+     0x3ac7, 0x3acf, 0x3ad7, 0x3adf, 0x3ae7, 0x3aef, 0x3af7, 0x3aff, 0x3b07, 0x3b0f, 0x3b17, 0x3b1f,
+     0x3b27, 0x3b2f, 0x3b37, 0x3b3f, 0x3b47, 0x3b4f, 0x3b57, 0x3b5f, 0x3b67, 0x3b6f, 0x3b77, 0x3b7f,
+     0x3b88, 0x3b90, 0x3b98, 0x3ba0, 0x3ba8, 0x3bb0, 0x3bb8, 0x3bc0, 0x3bc8, 0x3bd0, 0x3bd8, 0x3be0,
+     0x3be8, 0x3bf0, 0x3bf8, 0x3c00};
+
+/*converts a float in the range [0, 1] to a half float, rounding to nearest*/
+static unsigned short floatToHalf(float value)
+{
+  union { float f; unsigned u; } bits;
+  unsigned sign, mantissa, half;
+  int exponent;
+  bits.f = value;
+  sign = (bits.u >> 16) & 0x8000u;
+  exponent = (int)((bits.u >> 23) & 0xff) - 127 + 15;
+  mantissa = bits.u & 0x7fffffu;
+  if(exponent <= 0) /*zero or denormal half*/
+  {
+    unsigned shift;
+    if(exponent < -10) return (unsigned short)sign;
+    mantissa |= 0x800000u;
+    shift = (unsigned)(14 - exponent);
+    half = mantissa >> shift;
+    if((mantissa >> (shift - 1)) & 1) half++;
+    return (unsigned short)(sign | half);
+  }
+  if(exponent >= 31) return (unsigned short)(sign | 0x7c00u);
+  half = sign | ((unsigned)exponent << 10) | (mantissa >> 13);
+  if(mantissa & 0x1000u) half++; /*a carry into the exponent is still the correctly rounded value*/
+  return (unsigned short)half;
+}
+
+static float srgbToLinear(float value)
+{
+  return value <= 0.04045f ? value / 12.92f : (float)pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+/*RGBA8 to BGRA8 in place*/
+static void swizzleRGBA8ToBGRA8(unsigned char* buffer, size_t numpixels)
+{
+  size_t i = 0;
+#if defined(LODEPNG_SSE2)
+  const __m128i mask_ga = _mm_set1_epi32((int)0xff00ff00u);
+  const __m128i mask_low = _mm_set1_epi32(0x000000ff);
+  for(; i + 4 <= numpixels; i += 4)
+  {
+    __m128i p = _mm_loadu_si128((const __m128i*)&buffer[i * 4]);
+    __m128i b = _mm_and_si128(_mm_srli_epi32(p, 16), mask_low);
+    __m128i r = _mm_slli_epi32(_mm_and_si128(p, mask_low), 16);
+    _mm_storeu_si128((__m128i*)&buffer[i * 4], _mm_or_si128(_mm_and_si128(p, mask_ga), _mm_or_si128(b, r)));
+  }
+#elif defined(LODEPNG_NEON)
+  for(; i + 16 <= numpixels; i += 16)
+  {
+    uint8x16x4_t p = vld4q_u8(&buffer[i * 4]);
+    uint8x16_t r = p.val[0];
+    p.val[0] = p.val[2];
+    p.val[2] = r;
+    vst4q_u8(&buffer[i * 4], p);
+  }
+#endif
+  for(; i < numpixels; i++)
+  {
+    unsigned char r = buffer[i * 4 + 0];
+    buffer[i * 4 + 0] = buffer[i * 4 + 2];
+    buffer[i * 4 + 2] = r;
+  }
+}
+
+#if defined(LODEPNG_SSE2)
+/*premultiplies 2 RGBA pixels unpacked to 16-bit lanes, the alpha lanes are multiplied by 255 to stay the same*/
+static __m128i premultiplyLanes(__m128i v)
+{
+  const __m128i alpha_lanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+  __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+  __m128i t;
+  a = _mm_or_si128(_mm_andnot_si128(alpha_lanes, a), _mm_and_si128(alpha_lanes, _mm_set1_epi16(255)));
+  t = _mm_add_epi16(_mm_mullo_epi16(v, a), _mm_set1_epi16(128));
+  return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+#endif /*LODEPNG_SSE2*/
+
+/*RGBA8 to premultiplied RGBA8 in place, rounding c * a / 255 to nearest exactly like the SIMD kernels do*/
+static void premultiplyRGBA8(unsigned char* buffer, size_t numpixels)
+{
+  size_t i = 0;
+#if defined(LODEPNG_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  for(; i + 4 <= numpixels; i += 4)
+  {
+    __m128i p = _mm_loadu_si128((const __m128i*)&buffer[i * 4]);
+    __m128i lo = premultiplyLanes(_mm_unpacklo_epi8(p, zero));
+    __m128i hi = premultiplyLanes(_mm_unpackhi_epi8(p, zero));
+    _mm_storeu_si128((__m128i*)&buffer[i * 4], _mm_packus_epi16(lo, hi));
+  }
+#elif defined(LODEPNG_NEON)
+  for(; i + 16 <= numpixels; i += 16)
+  {
+    uint8x16x4_t p = vld4q_u8(&buffer[i * 4]);
+    unsigned c;
+    for(c = 0; c < 3; c++)
+    {
+      uint16x8_t lo = vmull_u8(vget_low_u8(p.val[c]), vget_low_u8(p.val[3]));
+      uint16x8_t hi = vmull_u8(vget_high_u8(p.val[c]), vget_high_u8(p.val[3]));
+      p.val[c] = vcombine_u8(vraddhn_u16(lo, vrshrq_n_u16(lo, 8)), vraddhn_u16(hi, vrshrq_n_u16(hi, 8)));
+    }
+    vst4q_u8(&buffer[i * 4], p);
+  }
+#endif
+  for(; i < numpixels; i++)
+  {
+    unsigned a = buffer[i * 4 + 3];
+    unsigned c;
+    for(c = 0; c < 3; c++)
+    {
+      unsigned t = buffer[i * 4 + c] * a + 128;
+      buffer[i * 4 + c] = (unsigned char)((t + (t >> 8)) >> 8);
+    }
+  }
+}
+
+/*
+Converts numpixels pixels in the given color mode to the pixel format. If the input has no padding
+bits this can be a whole image or a single scanline. The input is not modified.
+*/
+static void convertPixelFormat(unsigned char* out, const unsigned char* in, size_t numpixels,
+                               const LodePNGColorMode* mode_in, LodePNGPixelFormat format)
+{
+  size_t i;
+  if(format == LPF_RGBA16F_LINEAR)
+  {
+    unsigned short* half = (unsigned short*)out;
+    if(mode_in->bitdepth == 16)
+    {
+      for(i = 0; i < numpixels; i++)
+      {
+        unsigned short r = 0, g = 0, b = 0, a = 0;
+        getPixelColorRGBA16(&r, &g, &b, &a, in, i, mode_in);
+        half[i * 4 + 0] = floatToHalf(srgbToLinear(r / 65535.0f));
+        half[i * 4 + 1] = floatToHalf(srgbToLinear(g / 65535.0f));
+        half[i * 4 + 2] = floatToHalf(srgbToLinear(b / 65535.0f));
+        half[i * 4 + 3] = floatToHalf(a / 65535.0f);
+      }
+    }
+    else
+    {
+      /*get RGBA8 into the second half of the output first, then expand to half floats front to back: the
+      halfs written for pixel i never overlap RGBA8 pixels after i, so this is safe in place*/
+      unsigned char* rgba = out + numpixels * 4;
+      getPixelColorsRGBA8(rgba, numpixels, 1, in, mode_in);
+      for(i = 0; i < numpixels; i++)
+      {
+        unsigned char r = rgba[i * 4 + 0], g = rgba[i * 4 + 1], b = rgba[i * 4 + 2], a = rgba[i * 4 + 3];
+        half[i * 4 + 0] = SRGB8_TO_LINEAR_HALF[r];
+        half[i * 4 + 1] = SRGB8_TO_LINEAR_HALF[g];
+        half[i * 4 + 2] = SRGB8_TO_LINEAR_HALF[b];
+        half[i * 4 + 3] = UNORM8_TO_HALF[a];
+      }
+    }
+    return;
+  }
+
+  getPixelColorsRGBA8(out, numpixels, 1, in, mode_in);
+  if(format == LPF_BGRA8) swizzleRGBA8ToBGRA8(out, numpixels);
+  else if(format == LPF_RGBA8_PREMULTIPLIED) premultiplyRGBA8(out, numpixels);
+}
+
+unsigned lodepng_pixel_format_bytes(LodePNGPixelFormat format)
+{
+  switch(format)
+  {
+    case LPF_BGRA8: return 4;
+    case LPF_RGBA8_PREMULTIPLIED: return 4;
+    case LPF_RGBA16F_LINEAR: return 8;
+    default: return 0;
+  }
+}
+
+unsigned lodepng_convert_pixel_format(unsigned char* out, const unsigned char* in,
+                                      const LodePNGColorMode* mode_in, LodePNGPixelFormat format,
+                                      unsigned w, unsigned h)
+{
+  if(lodepng_pixel_format_bytes(format) == 0) return 91; /*not a pixel format to convert to*/
+  convertPixelFormat(out, in, (size_t)w * h, mode_in, format);
+  return 0;
+}
+
 #ifdef LODEPNG_COMPILE_ENCODER
 
 void lodepng_color_profile_init(LodePNGColorProfile* profile)
@@ -3816,7 +4089,11 @@ unsigned lodepng_inspect(unsigned* w, unsigned* h, LodePNGState* state,
   }
 
   /*when decoding a new PNG image, make sure all parameters created after previous decoding are reset*/
-  lodepng_info_cleanup(info);
+  {
+    const LodePNGAllocator* previous = lodepng_set_allocator(state->decoder.allocator);
+    lodepng_info_cleanup(info);
+    lodepng_set_allocator(previous);
+  }
   lodepng_info_init(info);
 
   if(in[0] != 137 || in[1] != 80 || in[2] != 78 || in[3] != 71
@@ -3964,6 +4241,42 @@ static unsigned unfilter(unsigned char* out, const unsigned char* in, unsigned w
   return 0;
 }
 
+/*
+Same as unfilter for a non-interlaced image, but converts each scanline to the color mode of mode_out
+(RGB or RGBA 8-bit) or to the pixel format right after unfiltering it, while it's still in the cache,
+instead of doing the conversion as another pass over the whole image afterwards.
+in is unfiltered in place, out gets the converted image.
+*/
+static unsigned unfilterConverted(unsigned char* out, unsigned char* in, unsigned w, unsigned h,
+                                  const LodePNGColorMode* mode_in, const LodePNGColorMode* mode_out,
+                                  LodePNGPixelFormat format)
+{
+  unsigned y;
+  unsigned char* prevline = 0;
+  unsigned bpp = lodepng_get_bpp(mode_in);
+  size_t bytewidth = (bpp + 7) / 8;
+  size_t linebytes = (w * bpp + 7) / 8;
+  size_t outlinebytes = format != LPF_RAW ? w * lodepng_pixel_format_bytes(format)
+                                          : lodepng_get_raw_size(w, 1, mode_out);
+
+  for(y = 0; y < h; y++)
+  {
+    unsigned char* line = &in[linebytes * y];
+    size_t inindex = (1 + linebytes) * y; /*the extra filterbyte added to each row*/
+    unsigned char filterType = in[inindex];
+
+    CERROR_TRY_RETURN(unfilterScanline(line, &in[inindex + 1], prevline, bytewidth, filterType, linebytes));
+
+    /*each scanline starts at a byte, so the padding bits of < 8 bpp images are simply not read*/
+    if(format != LPF_RAW) convertPixelFormat(&out[outlinebytes * y], line, w, mode_in, format);
+    else getPixelColorsRGBA8(&out[outlinebytes * y], w, mode_out->colortype == LCT_RGBA, line, mode_in);
+
+    prevline = line;
+  }
+
+  return 0;
+}
+
 /*
 in: Adam7 interlaced image, with no padding bits between scanlines, but between
  reduced images so that each reduced image starts at a byte.
@@ -4411,10 +4724,22 @@ static unsigned readChunk_pHYs(LodePNGInfo* info, const unsigned char* data, siz
 }
 #endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
 
-/*read a PNG, the result will be in the same color type as the PNG (hence "generic")*/
+/*whether decodeGeneric can convert to info_raw or the pixel format while unfiltering*/
+static unsigned canConvertScanlines(const LodePNGState* state)
+{
+  const LodePNGColorMode* mode_out = &state->info_raw;
+  if(state->info_png.interlace_method != 0) return 0;
+  if(state->decoder.pixel_format != LPF_RAW) return 1;
+  return state->decoder.color_convert && mode_out->bitdepth == 8
+      && (mode_out->colortype == LCT_RGBA || mode_out->colortype == LCT_RGB)
+      && !lodepng_color_mode_equal(mode_out, &state->info_png.color);
+}
+
+/*read a PNG, the result will be in the same color type as the PNG (hence "generic"), unless
+*converted is set to 1 by it: then it's already in the color type of info_raw or the pixel format*/
 static void decodeGeneric(unsigned char** out, unsigned* w, unsigned* h,
                           LodePNGState* state,
-                          const unsigned char* in, size_t insize)
+                          const unsigned char* in, size_t insize, unsigned* converted)
 {
   unsigned char IEND = 0;
   const unsigned char* chunk;
@@ -4431,6 +4756,7 @@ static void decodeGeneric(unsigned char** out, unsigned* w, unsigned* h,
 
   /*provide some proper output values if error will happen*/
   *out = 0;
+  *converted = 0;
 
   state->error = lodepng_inspect(w, h, state, in, insize); /*reads header and resets other parameters in state->info_png*/
   if(state->error) return;
@@ -4571,7 +4897,17 @@ static void decodeGeneric(unsigned char** out, unsigned* w, unsigned* h,
   }
   ucvector_cleanup(&idat);
 
-  if(!state->error)
+  if(!state->error && canConvertScanlines(state))
+  {
+    ucvector outv;
+    ucvector_init(&outv);
+    if(!ucvector_resize(&outv, lodepng_get_raw_size(*w, *h, &state->info_raw))) state->error = 83; /*alloc fail*/
+    if(!state->error) state->error = unfilterConverted(outv.data, scanlines.data, *w, *h, &state->info_png.color,
+                                                       &state->info_raw, state->decoder.pixel_format);
+    *out = outv.data;
+    *converted = 1;
+  }
+  else if(!state->error)
   {
     ucvector outv;
     ucvector_init(&outv);
@@ -4583,13 +4919,33 @@ static void decodeGeneric(unsigned char** out, unsigned* w, unsigned* h,
   ucvector_cleanup(&scanlines);
 }
 
-unsigned lodepng_decode(unsigned char** out, unsigned* w, unsigned* h,
-                        LodePNGState* state,
-                        const unsigned char* in, size_t insize)
+/*decodes and converts to the color type of info_raw, with the allocator of the state already current*/
+static unsigned decodeConverted(unsigned char** out, unsigned* w, unsigned* h,
+                                LodePNGState* state,
+                                const unsigned char* in, size_t insize)
 {
+  unsigned converted;
   *out = 0;
-  decodeGeneric(out, w, h, state, in, insize);
-  if(state->error) return state->error;
+  if(state->decoder.pixel_format != LPF_RAW)
+  {
+    if(!lodepng_pixel_format_bytes(state->decoder.pixel_format)) CERROR_RETURN_ERROR(state->error, 91);
+    /*describes the size of the pixels, the pixel format describes their contents*/
+    state->info_raw.colortype = LCT_RGBA;
+    state->info_raw.bitdepth = state->decoder.pixel_format == LPF_RGBA16F_LINEAR ? 16 : 8;
+  }
+  decodeGeneric(out, w, h, state, in, insize, &converted);
+  if(state->error || converted) return state->error;
+  if(state->decoder.pixel_format != LPF_RAW)
+  {
+    /*interlaced image: convert after deinterlacing, still in a single pass*/
+    unsigned char* data = *out;
+    *out = (unsigned char*)lodepng_malloc(lodepng_get_raw_size(*w, *h, &state->info_raw));
+    if(!(*out)) state->error = 83; /*alloc fail*/
+    else state->error = lodepng_convert_pixel_format(*out, data, &state->info_png.color,
+                                                     state->decoder.pixel_format, *w, *h);
+    lodepng_free(data);
+    return state->error;
+  }
   if(!state->decoder.color_convert || lodepng_color_mode_equal(&state->info_raw, &state->info_png.color))
   {
     /*same color type, no copying or converting of data needed*/
@@ -4628,6 +4984,16 @@ unsigned lodepng_decode(unsigned char** out, unsigned* w, unsigned* h,
   return state->error;
 }
 
+unsigned lodepng_decode(unsigned char** out, unsigned* w, unsigned* h,
+                        LodePNGState* state,
+                        const unsigned char* in, size_t insize)
+{
+  const LodePNGAllocator* previous = lodepng_set_allocator(state->decoder.allocator);
+  unsigned error = decodeConverted(out, w, h, state, in, insize);
+  lodepng_set_allocator(previous);
+  return error;
+}
+
 unsigned lodepng_decode_memory(unsigned char** out, unsigned* w, unsigned* h, const unsigned char* in,
                                size_t insize, LodePNGColorType colortype, unsigned bitdepth)
 {
@@ -4683,6 +5049,8 @@ void lodepng_decoder_settings_init(LodePNGDecoderSettings* settings)
   settings->remember_unknown_chunks = 0;
 #endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
   settings->ignore_crc = 0;
+  settings->pixel_format = LPF_RAW;
+  settings->allocator = 0;
   lodepng_decompress_settings_init(&settings->zlibsettings);
 }
 
@@ -4703,20 +5071,36 @@ void lodepng_state_init(LodePNGState* state)
   state->error = 1;
 }
 
+/*the allocator that owns the memory in info_raw and info_png of the state*/
+static const LodePNGAllocator* lodepng_state_allocator(const LodePNGState* state)
+{
+#ifdef LODEPNG_COMPILE_DECODER
+  return state->decoder.allocator;
+#else /*LODEPNG_COMPILE_DECODER*/
+  (void)state;
+  return 0;
+#endif /*LODEPNG_COMPILE_DECODER*/
+}
+
 void lodepng_state_cleanup(LodePNGState* state)
 {
+  const LodePNGAllocator* previous = lodepng_set_allocator(lodepng_state_allocator(state));
   lodepng_color_mode_cleanup(&state->info_raw);
   lodepng_info_cleanup(&state->info_png);
+  lodepng_set_allocator(previous);
 }
 
 void lodepng_state_copy(LodePNGState* dest, const LodePNGState* source)
 {
+  const LodePNGAllocator* previous;
   lodepng_state_cleanup(dest);
   *dest = *source;
   lodepng_color_mode_init(&dest->info_raw);
   lodepng_info_init(&dest->info_png);
-  dest->error = lodepng_color_mode_copy(&dest->info_raw, &source->info_raw); if(dest->error) return;
-  dest->error = lodepng_info_copy(&dest->info_png, &source->info_png); if(dest->error) return;
+  previous = lodepng_set_allocator(lodepng_state_allocator(dest));
+  dest->error = lodepng_color_mode_copy(&dest->info_raw, &source->info_raw);
+  if(!dest->error) dest->error = lodepng_info_copy(&dest->info_png, &source->info_png);
+  lodepng_set_allocator(previous);
 }
 
 #endif /* defined(LODEPNG_COMPILE_DECODER) || defined(LODEPNG_COMPILE_ENCODER) */
@@ -5508,9 +5892,10 @@ static unsigned addUnknownChunks(ucvector* out, unsigned char* data, size_t data
 }
 #endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
 
-unsigned lodepng_encode(unsigned char** out, size_t* outsize,
-                        const unsigned char* image, unsigned w, unsigned h,
-                        LodePNGState* state)
+/*encodes with the allocator of the encoder settings already current*/
+static unsigned encodeGeneric(unsigned char** out, size_t* outsize,
+                              const unsigned char* image, unsigned w, unsigned h,
+                              LodePNGState* state)
 {
   LodePNGInfo info;
   ucvector outv;
@@ -5701,6 +6086,16 @@ unsigned lodepng_encode(unsigned char** out, size_t* outsize,
   return state->error;
 }
 
+unsigned lodepng_encode(unsigned char** out, size_t* outsize,
+                        const unsigned char* image, unsigned w, unsigned h,
+                        LodePNGState* state)
+{
+  const LodePNGAllocator* previous = lodepng_set_allocator(state->encoder.allocator);
+  unsigned error = encodeGeneric(out, outsize, image, w, h, state);
+  lodepng_set_allocator(previous);
+  return error;
+}
+
 unsigned lodepng_encode_memory(unsigned char** out, size_t* outsize, const unsigned char* image,
                                unsigned w, unsigned h, LodePNGColorType colortype, unsigned bitdepth)
 {
@@ -5758,6 +6153,7 @@ void lodepng_encoder_settings_init(LodePNGEncoderSettings* settings)
   settings->auto_convert = 1;
   settings->force_palette = 0;
   settings->predefined_filters = 0;
+  settings->allocator = 0;
 #ifdef LODEPNG_COMPILE_ANCILLARY_CHUNKS
   settings->add_id = 0;
   settings->text_compression = 1;
@@ -5866,6 +6262,7 @@ const char* lodepng_error_text(unsigned code)
     case 89: return "text chunk keyword too short or long: must have size 1-79";
     /*the windowsize in the LodePNGCompressSettings. Requiring POT(==> & instead of %) makes encoding 12% faster.*/
     case 90: return "windowsize must be a power of two";
+    case 91: return "invalid pixel format given for lodepng_convert_pixel_format";
   }
   return "unknown error code";
 }
@@ -5951,6 +6348,156 @@ unsigned compress(std::vector<unsigned char>& out, const std::vector<unsigned ch
 #endif //LODEPNG_COMPILE_ZLIB
 
 
+#ifdef LODEPNG_COMPILE_ALLOCATORS
+
+/*every allocation is preceded by a header of this size storing the allocation size, which also keeps
+the returned pointers aligned for any type lodepng stores in them*/
+static const size_t ARENA_HEADER_SIZE = 16;
+
+static size_t arenaRoundUp(size_t size)
+{
+  return (size + ARENA_HEADER_SIZE - 1) & ~(ARENA_HEADER_SIZE - 1);
+}
+
+static size_t arenaSizeOf(const unsigned char* ptr)
+{
+  size_t size;
+  memcpy(&size, ptr - ARENA_HEADER_SIZE, sizeof(size));
+  return size;
+}
+
+Arena::Arena(size_t blocksize)
+  : current(0), blocksize(arenaRoundUp(blocksize)), last(0)
+{
+  allocator.alloc = alloc_callback;
+  allocator.realloc = realloc_callback;
+  allocator.free = free_callback;
+  allocator.context = this;
+}
+
+Arena::~Arena()
+{
+  for(size_t i = 0; i < blocks.size(); i++) ::free(blocks[i].data);
+}
+
+void Arena::reset()
+{
+  for(size_t i = 0; i < blocks.size(); i++) blocks[i].used = 0;
+  current = 0;
+  last = 0;
+}
+
+size_t Arena::bytes_used() const
+{
+  size_t total = 0;
+  for(size_t i = 0; i < blocks.size(); i++) total += blocks[i].used;
+  return total;
+}
+
+size_t Arena::bytes_reserved() const
+{
+  size_t total = 0;
+  for(size_t i = 0; i < blocks.size(); i++) total += blocks[i].size;
+  return total;
+}
+
+void* Arena::alloc(size_t size)
+{
+  size_t needed = ARENA_HEADER_SIZE + arenaRoundUp(size);
+  unsigned char* ptr;
+
+  /*move on to the next block that has room, blocks that were skipped stay unused until the next reset*/
+  while(current < blocks.size() && blocks[current].size - blocks[current].used < needed) current++;
+  if(current == blocks.size())
+  {
+    Block block;
+    block.size = needed > blocksize ? needed : blocksize;
+    block.used = 0;
+    block.data = (unsigned char*)malloc(block.size);
+    if(!block.data) return 0;
+    blocks.push_back(block);
+  }
+
+  ptr = blocks[current].data + blocks[current].used + ARENA_HEADER_SIZE;
+  memcpy(ptr - ARENA_HEADER_SIZE, &size, sizeof(size));
+  blocks[current].used += needed;
+  last = ptr;
+  return ptr;
+}
+
+void* Arena::realloc(void* ptr, size_t new_size)
+{
+  unsigned char* data = (unsigned char*)ptr;
+  unsigned char* result;
+  size_t old_size;
+
+  if(!data) return alloc(new_size);
+  if(!owns(data)) return ::realloc(data, new_size);
+
+  old_size = arenaSizeOf(data);
+  if(data == last)
+  {
+    /*the most recent allocation is at the end of the current block and can be resized in place*/
+    Block& block = blocks[current];
+    size_t start = (size_t)(data - block.data);
+    size_t needed = arenaRoundUp(new_size);
+    if(block.size - start >= needed)
+    {
+      block.used = start + needed;
+      memcpy(data - ARENA_HEADER_SIZE, &new_size, sizeof(new_size));
+      return data;
+    }
+  }
+
+  result = (unsigned char*)alloc(new_size);
+  if(result) memcpy(result, data, old_size < new_size ? old_size : new_size);
+  return result;
+}
+
+void Arena::free(void* ptr)
+{
+  unsigned char* data = (unsigned char*)ptr;
+  if(!data) return;
+  if(!owns(data))
+  {
+    ::free(data);
+    return;
+  }
+  if(data == last)
+  {
+    /*give back the space of the most recent allocation, e.g. temporary buffers freed right away*/
+    blocks[current].used = (size_t)(data - blocks[current].data) - ARENA_HEADER_SIZE;
+    last = 0;
+  }
+}
+
+bool Arena::owns(const void* ptr) const
+{
+  const unsigned char* data = (const unsigned char*)ptr;
+  for(size_t i = 0; i < blocks.size(); i++)
+  {
+    if(data >= blocks[i].data && data < blocks[i].data + blocks[i].size) return true;
+  }
+  return false;
+}
+
+void* Arena::alloc_callback(void* context, size_t size)
+{
+  return ((Arena*)context)->alloc(size);
+}
+
+void* Arena::realloc_callback(void* context, void* ptr, size_t new_size)
+{
+  return ((Arena*)context)->realloc(ptr, new_size);
+}
+
+void Arena::free_callback(void* context, void* ptr)
+{
+  ((Arena*)context)->free(ptr);
+}
+
+#endif //LODEPNG_COMPILE_ALLOCATORS
+
 #ifdef LODEPNG_COMPILE_PNG
 
 State::State()
@@ -6006,12 +6553,14 @@ unsigned decode(std::vector<unsigned char>& out, unsigned& w, unsigned& h,
 {
   unsigned char* buffer = NULL;
   unsigned error = lodepng_decode(&buffer, &w, &h, &state, in, insize);
+  const LodePNGAllocator* previous = lodepng_set_allocator(state.decoder.allocator);
   if(buffer && !error)
   {
     size_t buffersize = lodepng_get_raw_size(w, h, &state.info_raw);
     out.insert(out.end(), &buffer[0], &buffer[buffersize]);
   }
   lodepng_free(buffer);
+  lodepng_set_allocator(previous);
   return error;
 }
 
@@ -6065,8 +6614,10 @@ unsigned encode(std::vector<unsigned char>& out,
   unsigned error = lodepng_encode(&buffer, &buffersize, in, w, h, &state);
   if(buffer)
   {
+    const LodePNGAllocator* previous = lodepng_set_allocator(state.encoder.allocator);
     out.insert(out.end(), &buffer[0], &buffer[buffersize]);
     lodepng_free(buffer);
+    lodepng_set_allocator(previous);
   }
   return error;
 }
@@ -82,6 +82,25 @@ source files with custom allocators.*/
 #endif
 #endif
 
+/*
+Custom allocator that can be given to the decoder and encoder settings. While a
+lodepng_decode or lodepng_encode call that has one set is running, every
+lodepng_malloc, lodepng_realloc and lodepng_free on that thread goes to it instead
+of to C's malloc, realloc and free. This only has effect with the built in
+allocators (LODEPNG_COMPILE_ALLOCATORS).
+Memory that outlives the call (the out buffer, and palettes and texts in the
+LodePNGState) comes from the same allocator. lodepng_state_cleanup, lodepng_inspect
+and the C++ wrapper free it through the allocator of the state again, but if you
+decode with the C API you must free the out buffer with the allocator yourself.
+*/
+typedef struct LodePNGAllocator
+{
+  void* (*alloc)(void* context, size_t size);
+  void* (*realloc)(void* context, void* ptr, size_t new_size);
+  void (*free)(void* context, void* ptr);
+  void* context; /*passed as first argument to the functions above*/
+} LodePNGAllocator;
+
 #ifdef LODEPNG_COMPILE_PNG
 /*The PNG color types (also used for raw).*/
 typedef enum LodePNGColorType
@@ -507,6 +526,32 @@ unsigned lodepng_convert(unsigned char* out, const unsigned char* in,
                          LodePNGColorMode* mode_out, const LodePNGColorMode* mode_in,
                          unsigned w, unsigned h);
 
+/*
+Pixel formats for uploading to the GPU as is, beyond what the PNG color types can describe.
+They always have 4 channels in the order given by the name.
+*/
+typedef enum LodePNGPixelFormat
+{
+  LPF_RAW = 0, /*no special format, the raw image uses the color mode of info_raw*/
+  LPF_BGRA8, /*8-bit BGRA, e.g. for GL_BGRA or DXGI_FORMAT_B8G8R8A8_UNORM*/
+  LPF_RGBA8_PREMULTIPLIED, /*8-bit RGBA with the color channels multiplied by alpha*/
+  /*RGBA as native endian 16-bit half floats, with the colors converted from sRGB to linear and
+  straight alpha, e.g. for GL_RGBA16F textures sampled in linear color space*/
+  LPF_RGBA16F_LINEAR
+} LodePNGPixelFormat;
+
+/*returns the amount of bytes per pixel of the pixel format, or 0 for LPF_RAW*/
+unsigned lodepng_pixel_format_bytes(LodePNGPixelFormat format);
+
+/*
+Same as lodepng_convert, but converts to one of the GPU pixel formats in a single pass,
+with SSE2 or NEON kernels where available. The out buffer must have size
+w * h * lodepng_pixel_format_bytes(format). Returns error 91 if format is LPF_RAW.
+*/
+unsigned lodepng_convert_pixel_format(unsigned char* out, const unsigned char* in,
+                                      const LodePNGColorMode* mode_in, LodePNGPixelFormat format,
+                                      unsigned w, unsigned h);
+
 #ifdef LODEPNG_COMPILE_DECODER
 /*
 Settings for the decoder. This contains settings for the PNG and the Zlib
@@ -520,6 +565,17 @@ typedef struct LodePNGDecoderSettings
 
   unsigned color_convert; /*whether to convert the PNG to the color type you want. Default: yes*/
 
+  /*if not LPF_RAW, decode to this GPU pixel format instead of to info_raw. The conversion is done
+  per scanline right after unfiltering, so no extra pass over the image is made. color_convert is
+  ignored and info_raw is set to RGBA with 8-bit (16-bit for LPF_RGBA16F_LINEAR) to reflect the
+  size of the pixels. Default: LPF_RAW*/
+  LodePNGPixelFormat pixel_format;
+
+  /*allocator used for all memory allocated while decoding (default: null = malloc). The
+  output buffer and the contents of info_raw and info_png of the state then come from it
+  too, so it must stay alive until they are freed, see LodePNGAllocator.*/
+  const LodePNGAllocator* allocator;
+
 #ifdef LODEPNG_COMPILE_ANCILLARY_CHUNKS
   unsigned read_text_chunks; /*if false but remember_unknown_chunks is true, they're stored in the unknown chunks*/
   /*store all bytes from unknown chunks in the LodePNGInfo (off by default, useful for a png editor)*/
@@ -601,6 +657,10 @@ typedef struct LodePNGEncoderSettings
   /*force creating a PLTE chunk if colortype is 2 or 6 (= a suggested palette).
   If colortype is 3, PLTE is _always_ created.*/
   unsigned force_palette;
+
+  /*allocator used for all memory allocated while encoding, including the output buffer
+  (default: null = malloc)*/
+  const LodePNGAllocator* allocator;
 #ifdef LODEPNG_COMPILE_ANCILLARY_CHUNKS
   /*add LodePNG identifier and version as a text chunk, for debugging*/
   unsigned add_id;
@@ -853,6 +913,55 @@ void save_file(const std::vector<unsigned char>& buffer, const std::string& file
 #endif //LODEPNG_COMPILE_DISK
 #endif //LODEPNG_COMPILE_PNG
 
+#ifdef LODEPNG_COMPILE_ALLOCATORS
+/*
+Bump allocator for the allocator field of the decoder and encoder settings. Allocations
+are carved linearly out of large blocks and freeing is a no-op (except that the most
+recent allocation can shrink or grow in place), so decoding many small images doesn't
+go to the system heap for every vector growth. Call reset() between images to reuse
+the blocks; everything allocated from the arena becomes invalid at that point.
+Pointers the arena did not hand out are passed on to free and realloc, so a state that
+mixes arena memory and malloc'ed memory can still be cleaned up normally.
+*/
+class Arena
+{
+  public:
+    explicit Arena(size_t blocksize = 1024 * 1024);
+    ~Arena();
+
+    const LodePNGAllocator* get_allocator() const { return &allocator; }
+    void reset();
+    size_t bytes_used() const; /*bytes handed out since the last reset, including headers*/
+    size_t bytes_reserved() const; /*total size of the blocks owned by the arena*/
+
+  private:
+    Arena(const Arena& other); /*not copyable*/
+    Arena& operator=(const Arena& other);
+
+    struct Block
+    {
+      unsigned char* data;
+      size_t size;
+      size_t used;
+    };
+
+    void* alloc(size_t size);
+    void* realloc(void* ptr, size_t new_size);
+    void free(void* ptr);
+    bool owns(const void* ptr) const;
+
+    static void* alloc_callback(void* context, size_t size);
+    static void* realloc_callback(void* context, void* ptr, size_t new_size);
+    static void free_callback(void* context, void* ptr);
+
+    std::vector<Block> blocks;
+    size_t current; /*index of the block allocations are currently made from*/
+    size_t blocksize;
+    unsigned char* last; /*most recent allocation, which can be resized in place*/
+    LodePNGAllocator allocator;
+};
+#endif //LODEPNG_COMPILE_ALLOCATORS
+
 #ifdef LODEPNG_COMPILE_ZLIB
 #ifdef LODEPNG_COMPILE_DECODER
 //Zlib-decompress an unsigned char buffer
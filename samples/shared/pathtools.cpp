@@ -21,7 +21,20 @@
 
 #include <sys/stat.h>
 
+#if !defined( _WIN32 )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <algorithm>
+#include <climits>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string.h>
+#include <thread>
 
 /** Returns the path (including filename) to the current executable */
 std::string Path_GetExecutablePath()
@@ -393,6 +406,32 @@ bool Path_IsDirectory( const std::string & sPath )
 }
 
 
+//-----------------------------------------------------------------------------
+// Purpose: creates a directory, and its parents if they are missing
+//-----------------------------------------------------------------------------
+bool Path_CreateDirectory( const std::string & sPath )
+{
+	std::string sFixedPath = Path_FixSlashes( sPath );
+	if( sFixedPath.empty() )
+		return false;
+	if( Path_IsDirectory( sFixedPath ) )
+		return true;
+
+	std::string sParent = Path_StripFilename( sFixedPath );
+	if( !sParent.empty() && sParent != sFixedPath && !Path_CreateDirectory( sParent ) )
+		return false;
+
+#if defined( _WIN32 )
+	_mkdir( sFixedPath.c_str() );
+#else
+	mkdir( sFixedPath.c_str(), 0755 );
+#endif
+
+	// another process may have created it first, which is just as good
+	return Path_IsDirectory( sFixedPath );
+}
+
+
 //-----------------------------------------------------------------------------
 // Purpose: returns true if the the path exists
 //-----------------------------------------------------------------------------
@@ -470,91 +509,402 @@ std::string Path_FindParentSubDirectoryRecursively( const std::string &strStartD
 // Purpose: reading and writing files in the vortex directory
 //-----------------------------------------------------------------------------
 unsigned char * Path_ReadBinaryFile( const std::string &strFilename, int *pSize )
+{
+	CMappedFile file( strFilename );
+
+	// the size is returned as an int, so refuse files that don't fit rather than truncate them
+	if ( !file.IsValid() || file.Size() == 0 || file.Size() > INT_MAX )
+		return NULL;
+
+	unsigned char *buf = new unsigned char[ file.Size() ];
+	memcpy( buf, file.Data(), file.Size() );
+	if ( pSize )
+		*pSize = (int)file.Size();
+
+	return buf;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: copies a text file into a string, converting CRLF -> LF
+//-----------------------------------------------------------------------------
+static std::string ConvertTextFile( const CMappedFile &file )
+{
+	std::string ret;
+	if ( file.Size() == 0 )
+		return ret;
+
+	const unsigned char *buf = file.Data();
+	ret.reserve( file.Size() );
+	ret.push_back( (char)buf[0] );
+	for ( size_t i = 1; i < file.Size(); i++ )
+	{
+		if ( buf[i] == '\n' && buf[i-1] == '\r' ) // CRLF
+			ret[ ret.size() - 1 ] = '\n'; // ->LF
+		else
+			ret.push_back( (char)buf[i] ); // just copy
+	}
+	return ret;
+}
+
+
+std::string Path_ReadTextFile( const std::string &strFilename )
+{
+	CMappedFile file( strFilename );
+	if ( !file.IsValid() )
+		return "";
+
+	return ConvertTextFile( file );
+}
+
+
+bool Path_WriteStringToTextFile( const std::string &strFilename, const char *pchData )
 {
 	FILE *f;
 #if defined( POSIX )
-	f = fopen( strFilename.c_str(), "rb" );
+	f = fopen( strFilename.c_str(), "w" );
 #else
-	errno_t err = fopen_s(&f, strFilename.c_str(), "rb");
+	errno_t err = fopen_s(&f, strFilename.c_str(), "w");
 	if ( err != 0 )
 	{
 		f = NULL;
 	}
 #endif
 	
-	unsigned char* buf = NULL;
+	bool ok = false;
+
+	if ( f != NULL )
+	{
+		ok = fputs( pchData, f) >= 0;
+		fclose(f);
+	}
+
+	return ok;
+}
+
+
+bool Path_WriteBinaryFile( const std::string &strFilename, const unsigned char *pData, size_t unSize )
+{
+	FILE *f;
+#if defined( POSIX )
+	f = fopen( strFilename.c_str(), "wb" );
+#else
+	errno_t err = fopen_s(&f, strFilename.c_str(), "wb");
+	if ( err != 0 )
+	{
+		f = NULL;
+	}
+#endif
+
+	bool ok = false;
 
 	if ( f != NULL )
 	{
-		fseek(f, 0, SEEK_END);
-		int size = ftell(f);
-		fseek(f, 0, SEEK_SET);
+		ok = fwrite( pData, 1, unSize, f ) == unSize;
+		ok = fclose( f ) == 0 && ok;
+	}
+
+	return ok;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: memory mapped files
+//-----------------------------------------------------------------------------
+CMappedFile::CMappedFile()
+	: m_pData( NULL ), m_nSize( 0 ), m_bValid( false )
+{
+}
+
+
+CMappedFile::CMappedFile( const std::string &strFilename )
+	: m_pData( NULL ), m_nSize( 0 ), m_bValid( false )
+{
+	Open( strFilename );
+}
+
+
+CMappedFile::CMappedFile( CMappedFile &&other )
+	: m_pData( other.m_pData ), m_nSize( other.m_nSize ), m_bValid( other.m_bValid )
+{
+	other.m_pData = NULL;
+	other.m_nSize = 0;
+	other.m_bValid = false;
+}
+
+
+CMappedFile & CMappedFile::operator=( CMappedFile &&other )
+{
+	if ( this != &other )
+	{
+		Close();
+		m_pData = other.m_pData;
+		m_nSize = other.m_nSize;
+		m_bValid = other.m_bValid;
+		other.m_pData = NULL;
+		other.m_nSize = 0;
+		other.m_bValid = false;
+	}
+	return *this;
+}
+
+
+CMappedFile::~CMappedFile()
+{
+	Close();
+}
+
+
+bool CMappedFile::Open( const std::string &strFilename )
+{
+	Close();
+
+#if defined( _WIN32 )
+	HANDLE hFile = CreateFileA( strFilename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+	if ( hFile == INVALID_HANDLE_VALUE )
+		return false;
+
+	LARGE_INTEGER nFileSize;
+	if ( !GetFileSizeEx( hFile, &nFileSize ) || (unsigned long long)nFileSize.QuadPart > (size_t)-1 )
+	{
+		CloseHandle( hFile );
+		return false;
+	}
 
-		buf = new unsigned char[size];
-		if (buf && fread(buf, size, 1, f) == 1)
+	if ( nFileSize.QuadPart != 0 )
+	{
+		// the view keeps the mapping alive, so neither handle is needed once it exists
+		HANDLE hMapping = CreateFileMappingA( hFile, NULL, PAGE_READONLY, 0, 0, NULL );
+		if ( hMapping )
 		{
-			if (pSize)
-				*pSize = size;
+			m_pData = (const unsigned char *)MapViewOfFile( hMapping, FILE_MAP_READ, 0, 0, 0 );
+			CloseHandle( hMapping );
 		}
-		else
+		if ( !m_pData )
 		{
-			delete[] buf;
-			buf = 0;
+			CloseHandle( hFile );
+			return false;
 		}
+	}
+	CloseHandle( hFile );
+	m_nSize = (size_t)nFileSize.QuadPart;
+#else
+	int fd = open( strFilename.c_str(), O_RDONLY );
+	if ( fd < 0 )
+		return false;
 
-		fclose(f);
+	struct stat buf;
+	if ( fstat( fd, &buf ) != 0 || !S_ISREG( buf.st_mode ) )
+	{
+		close( fd );
+		return false;
 	}
 
-	return buf;
+	if ( buf.st_size != 0 )
+	{
+		void *pData = mmap( NULL, (size_t)buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+		if ( pData == MAP_FAILED )
+		{
+			close( fd );
+			return false;
+		}
+		m_pData = (const unsigned char *)pData;
+	}
+	close( fd );
+	m_nSize = (size_t)buf.st_size;
+#endif
+
+	m_bValid = true;
+	return true;
 }
 
 
-std::string Path_ReadTextFile( const std::string &strFilename )
+void CMappedFile::Close()
 {
-	// doing it this way seems backwards, but I don't
-	// see an easy way to do this with C/C++ style IO
-	// that isn't worse...
-	int size;
-	unsigned char* buf = Path_ReadBinaryFile( strFilename, &size );
-	if (!buf)
-		return "";
+	if ( m_pData )
+	{
+#if defined( _WIN32 )
+		UnmapViewOfFile( m_pData );
+#else
+		munmap( (void *)m_pData, m_nSize );
+#endif
+	}
+	m_pData = NULL;
+	m_nSize = 0;
+	m_bValid = false;
+}
+
 
-	// convert CRLF -> LF
-	int outsize = 1;
-	for (int i=1; i < size; i++)
+//-----------------------------------------------------------------------------
+// Purpose: The threads behind the Path_*Async functions. Each call queues one
+//			batch; the workers take the next job from the oldest batch that has
+//			any left. Threads are started as jobs arrive, up to one per core, and
+//			are joined once the queue drains at shutdown.
+//-----------------------------------------------------------------------------
+class CFileJobPool
+{
+public:
+	CFileJobPool();
+	~CFileJobPool();
+
+	/** Runs work( 0 .. nCount-1 ) on the pool */
+	void AddBatch( size_t nCount, const std::function< void( size_t ) > &work );
+
+private:
+	struct Batch_t
 	{
-		if (buf[i] == '\n' && buf[i-1] == '\r') // CRLF
-			buf[outsize-1] = '\n'; // ->LF
-		else
-			buf[outsize++] = buf[i]; // just copy
+		std::function< void( size_t ) > work;
+		size_t nCount;
+		size_t nNext;
+	};
+
+	void WorkerThread();
+
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::deque< std::shared_ptr< Batch_t > > m_queue;
+	size_t m_nQueuedJobs;
+	std::vector< std::thread > m_vecThreads;
+	size_t m_nMaxThreads;
+	bool m_bShutdown;
+};
+
+
+CFileJobPool::CFileJobPool()
+	: m_nQueuedJobs( 0 )
+	, m_nMaxThreads( std::max< unsigned >( 1u, std::thread::hardware_concurrency() ) )
+	, m_bShutdown( false )
+{
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Finishes all queued jobs and joins the worker threads
+//-----------------------------------------------------------------------------
+CFileJobPool::~CFileJobPool()
+{
+	{
+		std::lock_guard< std::mutex > lock( m_mutex );
+		m_bShutdown = true;
 	}
+	m_condition.notify_all();
 
-	std::string ret((char *)buf, (char *)(buf + outsize));
-	delete[] buf;
-	return ret;
+	for ( std::vector< std::thread >::iterator i = m_vecThreads.begin(); i != m_vecThreads.end(); i++ )
+		i->join();
 }
 
 
-bool Path_WriteStringToTextFile( const std::string &strFilename, const char *pchData )
+void CFileJobPool::AddBatch( size_t nCount, const std::function< void( size_t ) > &work )
 {
-	FILE *f;
-#if defined( POSIX )
-	f = fopen( strFilename.c_str(), "w" );
-#else
-	errno_t err = fopen_s(&f, strFilename.c_str(), "w");
-	if ( err != 0 )
+	if ( nCount == 0 )
+		return;
+
 	{
-		f = NULL;
+		std::lock_guard< std::mutex > lock( m_mutex );
+		std::shared_ptr< Batch_t > pBatch = std::make_shared< Batch_t >();
+		pBatch->work = work;
+		pBatch->nCount = nCount;
+		pBatch->nNext = 0;
+		m_queue.push_back( pBatch );
+		m_nQueuedJobs += nCount;
+
+		while ( m_vecThreads.size() < std::min( m_nMaxThreads, m_nQueuedJobs ) )
+			m_vecThreads.push_back( std::thread( &CFileJobPool::WorkerThread, this ) );
 	}
-#endif
-	
-	bool ok = false;
+	m_condition.notify_all();
+}
 
-	if ( f != NULL )
+
+void CFileJobPool::WorkerThread()
+{
+	std::unique_lock< std::mutex > lock( m_mutex );
+	for ( ;; )
 	{
-		ok = fputs( pchData, f) >= 0;
-		fclose(f);
+		m_condition.wait( lock, [this] { return m_bShutdown || !m_queue.empty(); } );
+		if ( m_queue.empty() )
+			return;
+
+		// the batch leaves the queue when its last job is taken, while that job may still be running
+		std::shared_ptr< Batch_t > pBatch = m_queue.front();
+		const size_t nJob = pBatch->nNext++;
+		if ( pBatch->nNext == pBatch->nCount )
+			m_queue.pop_front();
+		m_nQueuedJobs--;
+
+		lock.unlock();
+		pBatch->work( nJob );
+		pBatch.reset();
+		lock.lock();
 	}
+}
 
-	return ok;
-}
\ No newline at end of file
+
+//-----------------------------------------------------------------------------
+// Purpose: runs work( 0 .. nCount-1 ) on the shared file job pool, which is
+//			created by the first call
+//-----------------------------------------------------------------------------
+static void RunFileJobs( size_t nCount, const std::function< void( size_t ) > &work )
+{
+	static CFileJobPool s_pool;
+	s_pool.AddBatch( nCount, work );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: touches every page of a view so the reads happen on this thread
+//-----------------------------------------------------------------------------
+static void PageInMappedFile( const CMappedFile &file )
+{
+	const size_t k_nPageSize = 4096;
+	volatile unsigned char nSum = 0;
+	for ( size_t i = 0; i < file.Size(); i += k_nPageSize )
+		nSum += file.Data()[i];
+}
+
+
+std::vector< std::shared_future< MappedFileHandle_t > > Path_MapFilesAsync( const std::vector< std::string > &vecFilenames )
+{
+	std::shared_ptr< std::vector< std::promise< MappedFileHandle_t > > > pPromises = std::make_shared< std::vector< std::promise< MappedFileHandle_t > > >( vecFilenames.size() );
+
+	std::vector< std::shared_future< MappedFileHandle_t > > vecFutures;
+	for ( size_t i = 0; i < vecFilenames.size(); i++ )
+		vecFutures.push_back( (*pPromises)[i].get_future().share() );
+
+	RunFileJobs( vecFilenames.size(), [pPromises, vecFilenames]( size_t i )
+	{
+		std::shared_ptr< CMappedFile > pFile = std::make_shared< CMappedFile >( vecFilenames[i] );
+		PageInMappedFile( *pFile );
+		(*pPromises)[i].set_value( pFile );
+	} );
+
+	return vecFutures;
+}
+
+
+std::shared_future< MappedFileHandle_t > Path_MapFileAsync( const std::string &strFilename )
+{
+	return Path_MapFilesAsync( std::vector< std::string >( 1, strFilename ) )[0];
+}
+
+
+std::vector< std::shared_future< std::string > > Path_ReadTextFilesAsync( const std::vector< std::string > &vecFilenames )
+{
+	std::shared_ptr< std::vector< std::promise< std::string > > > pPromises = std::make_shared< std::vector< std::promise< std::string > > >( vecFilenames.size() );
+
+	std::vector< std::shared_future< std::string > > vecFutures;
+	for ( size_t i = 0; i < vecFilenames.size(); i++ )
+		vecFutures.push_back( (*pPromises)[i].get_future().share() );
+
+	RunFileJobs( vecFilenames.size(), [pPromises, vecFilenames]( size_t i )
+	{
+		(*pPromises)[i].set_value( Path_ReadTextFile( vecFilenames[i] ) );
+	} );
+
+	return vecFutures;
+}
+
+
+std::shared_future< std::string > Path_ReadTextFileAsync( const std::string &strFilename )
+{
+	return Path_ReadTextFilesAsync( std::vector< std::string >( 1, strFilename ) )[0];
+}
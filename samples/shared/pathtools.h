@@ -1,7 +1,10 @@
 //========= Copyright Valve Corporation ============//
 #pragma once
 
+#include <future>
+#include <memory>
 #include <string>
+#include <vector>
 
 /** Returns the path (including filename) to the current executable */
 std::string Path_GetExecutablePath();
@@ -63,6 +66,10 @@ std::string Path_Compact( const std::string & sRawPath, char slash = 0 );
 /** returns true if the specified path exists and is a directory */
 bool Path_IsDirectory( const std::string & sPath );
 
+/** Creates the directory and any missing parents. Returns true if the path is a directory
+* afterwards, including when it already was one. */
+bool Path_CreateDirectory( const std::string & sPath );
+
 /** Returns the path to the current DLL or exe */
 std::string GetThisModulePath();
 
@@ -77,6 +84,46 @@ std::string Path_FindParentSubDirectoryRecursively( const std::string &strStartD
 unsigned char * Path_ReadBinaryFile( const std::string &strFilename, int *pSize );
 std::string Path_ReadTextFile( const std::string &strFilename );
 bool Path_WriteStringToTextFile( const std::string &strFilename, const char *pchData );
+bool Path_WriteBinaryFile( const std::string &strFilename, const unsigned char *pData, size_t unSize );
+
+/** A read-only view of a whole file mapped into memory. The view is unmapped when the object
+* is destroyed. Empty files are valid views with a NULL Data() and a Size() of 0. */
+class CMappedFile
+{
+public:
+	CMappedFile();
+	explicit CMappedFile( const std::string &strFilename );
+	CMappedFile( CMappedFile &&other );
+	CMappedFile & operator=( CMappedFile &&other );
+	~CMappedFile();
+
+	/** Maps the file, replacing any existing view. Returns false if the file couldn't be mapped. */
+	bool Open( const std::string &strFilename );
+	void Close();
+
+	bool IsValid() const { return m_bValid; }
+	const unsigned char *Data() const { return m_pData; }
+	size_t Size() const { return m_nSize; }
+
+private:
+	CMappedFile( const CMappedFile & );
+	CMappedFile & operator=( const CMappedFile & );
+
+	const unsigned char *m_pData;
+	size_t m_nSize;
+	bool m_bValid;
+};
+
+typedef std::shared_ptr< const CMappedFile > MappedFileHandle_t;
+
+/** Maps files and pages them in on background threads. The futures are returned in the same
+* order as the filenames; a file that couldn't be mapped yields an invalid view. */
+std::shared_future< MappedFileHandle_t > Path_MapFileAsync( const std::string &strFilename );
+std::vector< std::shared_future< MappedFileHandle_t > > Path_MapFilesAsync( const std::vector< std::string > &vecFilenames );
+
+/** Asynchronous versions of Path_ReadTextFile */
+std::shared_future< std::string > Path_ReadTextFileAsync( const std::string &strFilename );
+std::vector< std::shared_future< std::string > > Path_ReadTextFilesAsync( const std::vector< std::string > &vecFilenames );
 
 //-----------------------------------------------------------------------------
 #if defined(WIN32)
@@ -0,0 +1,156 @@
+//========= Copyright Valve Corporation ============//
+#include "startupprofiler.h"
+
+#include <algorithm>
+
+#include "tracebuffer.h"
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CStartupProfiler::CStartupProfiler()
+	: m_ulStartTicks( 0 )
+	, m_flMsPerTick( 1000.0 / Trace_GetTimestampFrequency() )
+{
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CStartupProfiler::Start()
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	m_vecPhases.clear();
+	m_vecPhases.reserve( k_unMaxPhases );
+	m_vecThreads.clear();
+	m_vecThreads.push_back( std::this_thread::get_id() );
+	m_ulStartTicks = Trace_GetTimestamp();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+double CStartupProfiler::GetElapsedMs() const
+{
+	return ( Trace_GetTimestamp() - m_ulStartTicks ) * m_flMsPerTick;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+uint32_t CStartupProfiler::GetThreadIndex()
+{
+	const std::thread::id thisThread = std::this_thread::get_id();
+	for ( size_t i = 0; i < m_vecThreads.size(); i++ )
+	{
+		if ( m_vecThreads[i] == thisThread )
+			return (uint32_t)i;
+	}
+
+	m_vecThreads.push_back( thisThread );
+	return (uint32_t)m_vecThreads.size() - 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+uint32_t CStartupProfiler::BeginPhase( const char *pchName, uint32_t unAfter )
+{
+	const double flStartMs = GetElapsedMs();
+
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( m_vecPhases.size() >= k_unMaxPhases )
+		return k_unInvalidPhase;
+
+	StartupPhase_t phase;
+	phase.pchName = pchName;
+	phase.flStartMs = flStartMs;
+	phase.flEndMs = -1.0;
+	phase.unThread = GetThreadIndex();
+	phase.ulDependencies = unAfter < m_vecPhases.size() ? 1ull << unAfter : 0;
+	m_vecPhases.push_back( phase );
+	return (uint32_t)m_vecPhases.size() - 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CStartupProfiler::EndPhase( uint32_t unPhase )
+{
+	const double flEndMs = GetElapsedMs();
+
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( unPhase < m_vecPhases.size() )
+		m_vecPhases[ unPhase ].flEndMs = flEndMs;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CStartupProfiler::AddDependency( uint32_t unPhase, uint32_t unDependsOn )
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	if ( unPhase < m_vecPhases.size() && unDependsOn < m_vecPhases.size() && unDependsOn != unPhase )
+		m_vecPhases[ unPhase ].ulDependencies |= 1ull << unDependsOn;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+std::vector< StartupPhase_t > CStartupProfiler::GetPhases() const
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+	return m_vecPhases;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+std::vector< uint32_t > CStartupProfiler::GetCriticalPath() const
+{
+	std::lock_guard< std::mutex > lock( m_mutex );
+
+	std::vector< uint32_t > vecPath;
+	uint32_t unPhase = k_unInvalidPhase;
+	for ( uint32_t i = 0; i < m_vecPhases.size(); i++ )
+	{
+		if ( m_vecPhases[i].flEndMs >= 0.0 && ( unPhase == k_unInvalidPhase || m_vecPhases[i].flEndMs > m_vecPhases[ unPhase ].flEndMs ) )
+			unPhase = i;
+	}
+
+	// predecessors must have begun earlier, so this walk ends
+	while ( unPhase != k_unInvalidPhase )
+	{
+		vecPath.push_back( unPhase );
+		const StartupPhase_t &phase = m_vecPhases[ unPhase ];
+
+		uint32_t unPredecessor = k_unInvalidPhase;
+		for ( uint32_t i = 0; i < m_vecPhases.size(); i++ )
+		{
+			const StartupPhase_t &candidate = m_vecPhases[i];
+			const bool bBeganEarlier = candidate.flStartMs < phase.flStartMs || ( candidate.flStartMs == phase.flStartMs && i < unPhase );
+			if ( candidate.flEndMs < 0.0 || !bBeganEarlier )
+				continue;
+
+			const bool bDependency = ( phase.ulDependencies & ( 1ull << i ) ) != 0;
+			const bool bSameThread = candidate.unThread == phase.unThread && candidate.flEndMs <= phase.flStartMs;
+			if ( !bDependency && !bSameThread )
+				continue;
+
+			if ( unPredecessor == k_unInvalidPhase || candidate.flEndMs > m_vecPhases[ unPredecessor ].flEndMs )
+				unPredecessor = i;
+		}
+		unPhase = unPredecessor;
+	}
+
+	std::reverse( vecPath.begin(), vecPath.end() );
+	return vecPath;
+}
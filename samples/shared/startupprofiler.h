@@ -0,0 +1,81 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** One timed piece of startup. Times are milliseconds since CStartupProfiler::Start(). */
+struct StartupPhase_t
+{
+	const char *pchName;
+	double flStartMs;
+	double flEndMs;				// negative while the phase is still running
+	uint32_t unThread;			// 0 for the thread that called Start(), then in order of first use
+	uint64_t ulDependencies;	// bit n is set when the phase waited for phase n
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Times startup phases on any thread, and the waits between them,
+//			so a report can show what overlapped and which chain of phases
+//			decided the time to first frame. Each phase implicitly follows
+//			the one before it on the same thread.
+//-----------------------------------------------------------------------------
+class CStartupProfiler
+{
+public:
+	static const uint32_t k_unMaxPhases = 64;
+	static const uint32_t k_unInvalidPhase = UINT32_MAX;
+
+	CStartupProfiler();
+
+	/** Sets time zero and forgets any phases. The calling thread becomes thread 0. */
+	void Start();
+	double GetElapsedMs() const;
+
+	/** Returns the phase's id, or k_unInvalidPhase once k_unMaxPhases have begun. pchName is
+	* kept, not copied. unAfter is a phase this one depends on, usually the one that started
+	* the thread it runs on. These and AddDependency are thread safe. */
+	uint32_t BeginPhase( const char *pchName, uint32_t unAfter = k_unInvalidPhase );
+	void EndPhase( uint32_t unPhase );
+
+	/** Records that unPhase had to wait for unDependsOn to end */
+	void AddDependency( uint32_t unPhase, uint32_t unDependsOn );
+
+	/** The phases in the order they began */
+	std::vector< StartupPhase_t > GetPhases() const;
+
+	/** Phase ids from first to last, ending with the last phase to end. Each phase is preceded by
+	* whichever of its dependencies and its thread's previous phase ended last. */
+	std::vector< uint32_t > GetCriticalPath() const;
+
+private:
+	uint32_t GetThreadIndex();	// needs m_mutex
+
+	mutable std::mutex m_mutex;
+	uint64_t m_ulStartTicks;
+	double m_flMsPerTick;
+	std::vector< StartupPhase_t > m_vecPhases;
+	std::vector< std::thread::id > m_vecThreads;
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: Times the rest of the enclosing scope as a phase
+//-----------------------------------------------------------------------------
+class CStartupPhaseScope
+{
+public:
+	CStartupPhaseScope( CStartupProfiler &profiler, const char *pchName, uint32_t unAfter = CStartupProfiler::k_unInvalidPhase )
+		: m_profiler( profiler ), m_unPhase( profiler.BeginPhase( pchName, unAfter ) ) {}
+	~CStartupPhaseScope() { m_profiler.EndPhase( m_unPhase ); }
+
+	uint32_t GetPhase() const { return m_unPhase; }
+
+private:
+	CStartupPhaseScope( const CStartupPhaseScope & );
+	CStartupPhaseScope & operator=( const CStartupPhaseScope & );
+
+	CStartupProfiler &m_profiler;
+	uint32_t m_unPhase;
+};
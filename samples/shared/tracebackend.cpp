@@ -0,0 +1,139 @@
+//========= Copyright Valve Corporation ============//
+#include "tracebackend.h"
+
+#include <string.h>
+
+#if defined( USE_USDT )
+#include <sys/sdt.h>
+#endif
+
+// deeper ranges are still passed to NVTX, which keeps its own stack
+static const uint32_t k_unMaxRangeDepth = 64;
+
+static uint32_t s_unBackends = TraceBackend_Ring;
+static TraceNvtxPushFn_t s_pNvtxPush = NULL;
+static TraceNvtxPopFn_t s_pNvtxPop = NULL;
+
+// names of this thread's open ranges, for the end events
+static thread_local uint16_t t_runRangeStack[ k_unMaxRangeDepth ];
+static thread_local uint32_t t_unRangeDepth = 0;
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+uint32_t Trace_GetAvailableBackends()
+{
+	uint32_t unBackends = TraceBackend_Ring;
+	if ( s_pNvtxPush && s_pNvtxPop )
+		unBackends |= TraceBackend_Nvtx;
+#if defined( USE_USDT )
+	unBackends |= TraceBackend_Usdt;
+#endif
+	return unBackends;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void Trace_SetBackends( uint32_t unBackends )
+{
+	s_unBackends = unBackends & Trace_GetAvailableBackends();
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+uint32_t Trace_GetBackends()
+{
+	return s_unBackends;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool Trace_ParseBackends( const char *pchList, uint32_t *punBackends )
+{
+	uint32_t unBackends = 0;
+	const char *pch = pchList;
+	while ( *pch )
+	{
+		const char *pchEnd = strchr( pch, ',' );
+		const size_t unLength = pchEnd ? (size_t)( pchEnd - pch ) : strlen( pch );
+
+		if ( unLength == 4 && !strncmp( pch, "nvtx", 4 ) )
+			unBackends |= TraceBackend_Nvtx;
+		else if ( unLength == 4 && !strncmp( pch, "ring", 4 ) )
+			unBackends |= TraceBackend_Ring;
+		else if ( unLength == 4 && !strncmp( pch, "usdt", 4 ) )
+			unBackends |= TraceBackend_Usdt;
+		else if ( !( unLength == 4 && !strncmp( pch, "none", 4 ) ) )
+			return false;
+
+		pch += unLength;
+		if ( *pch == ',' )
+			pch++;
+	}
+
+	*punBackends = unBackends;
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void Trace_SetNvtxHooks( TraceNvtxPushFn_t pPush, TraceNvtxPopFn_t pPop )
+{
+	s_pNvtxPush = pPush;
+	s_pNvtxPop = pPop;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void Trace_RangePush( uint16_t unNameId, uint32_t unColor )
+{
+	const uint32_t unBackends = s_unBackends;
+	if ( unBackends & TraceBackend_Nvtx )
+		s_pNvtxPush( Trace_GetName( unNameId ), unColor );
+
+	if ( t_unRangeDepth++ >= k_unMaxRangeDepth )
+		return;
+	t_runRangeStack[ t_unRangeDepth - 1 ] = unNameId;
+
+	if ( unBackends & TraceBackend_Ring )
+		Trace_Event( unNameId, TraceEvent_Begin );
+#if defined( USE_USDT )
+	if ( unBackends & TraceBackend_Usdt )
+		DTRACE_PROBE2( vrtrace, range_begin, Trace_GetName( unNameId ), unColor );
+#endif
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void Trace_RangePop()
+{
+	const uint32_t unBackends = s_unBackends;
+	if ( unBackends & TraceBackend_Nvtx )
+		s_pNvtxPop();
+
+	if ( t_unRangeDepth == 0 )
+		return;
+	if ( t_unRangeDepth-- > k_unMaxRangeDepth )
+		return;
+	const uint16_t unNameId = t_runRangeStack[ t_unRangeDepth ];
+
+	if ( unBackends & TraceBackend_Ring )
+		Trace_Event( unNameId, TraceEvent_End );
+#if defined( USE_USDT )
+	if ( unBackends & TraceBackend_Usdt )
+		DTRACE_PROBE1( vrtrace, range_end, Trace_GetName( unNameId ) );
+#endif
+}
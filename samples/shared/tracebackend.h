@@ -0,0 +1,61 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <cstdint>
+
+#include "tracebuffer.h"
+
+/** Where NvtxRangePushColored/NvtxRangePop ranges go. Any combination can be enabled. */
+enum ETraceBackend
+{
+	TraceBackend_Nvtx = 1 << 0,		// the NVTX hooks from Trace_SetNvtxHooks, for Nsight and friends
+	TraceBackend_Ring = 1 << 1,		// the in-process ring from tracebuffer.h, exported with Trace_WriteChromeJson
+	TraceBackend_Usdt = 1 << 2,		// vrtrace:range_begin/range_end USDT probes for perf, bpftrace etc.
+};
+
+/** Backends compiled into this build. USDT needs USE_USDT and <sys/sdt.h>; NVTX needs hooks. */
+uint32_t Trace_GetAvailableBackends();
+
+/** Enables the given backends, dropping any that aren't available. Not thread safe; call at startup. */
+void Trace_SetBackends( uint32_t unBackends );
+uint32_t Trace_GetBackends();
+
+/** Parses a comma separated list of "nvtx", "ring", "usdt" or just "none". Returns false on an unknown name. */
+bool Trace_ParseBackends( const char *pchList, uint32_t *punBackends );
+
+/** NVTX lives with the application, which hands its push and pop here */
+typedef void (*TraceNvtxPushFn_t)( const char *pchName, uint32_t unColor );
+typedef void (*TraceNvtxPopFn_t)();
+void Trace_SetNvtxHooks( TraceNvtxPushFn_t pPush, TraceNvtxPopFn_t pPop );
+
+/** Opens and closes a range on the calling thread in every enabled backend.
+* Ranges nest up to 64 deep per thread; deeper ones are only passed to NVTX. */
+void Trace_RangePush( uint16_t unNameId, uint32_t unColor );
+void Trace_RangePop();
+
+/** The trace name id for a string literal, registered the first time this line runs */
+#define TRACE_NAME_ID( pchName ) ( []() -> uint16_t { static const uint16_t s_unNameId = Trace_RegisterName( pchName ); return s_unNameId; }() )
+
+/** The range calls the sample has always made, now routed to the enabled backends */
+#define NvtxRangePushColored( pchName, unColor ) Trace_RangePush( TRACE_NAME_ID( pchName ), unColor )
+#define NvtxRangePop() Trace_RangePop()
+
+//-----------------------------------------------------------------------------
+// Purpose: Pushes a range now and pops it when it goes out of scope
+//-----------------------------------------------------------------------------
+class CTraceRangeScope
+{
+public:
+	CTraceRangeScope( uint16_t unNameId, uint32_t unColor ) { Trace_RangePush( unNameId, unColor ); }
+	~CTraceRangeScope() { Trace_RangePop(); }
+
+private:
+	CTraceRangeScope( const CTraceRangeScope & );
+	CTraceRangeScope & operator=( const CTraceRangeScope & );
+};
+
+#define TRACE_CONCAT_( a, b ) a##b
+#define TRACE_CONCAT( a, b ) TRACE_CONCAT_( a, b )
+
+/** Traces the rest of the enclosing scope as a range named by the string literal pchName */
+#define TRACE_RANGE( pchName, unColor ) CTraceRangeScope TRACE_CONCAT( traceRange, __LINE__ )( TRACE_NAME_ID( pchName ), unColor )
@@ -0,0 +1,223 @@
+//========= Copyright Valve Corporation ============//
+#include "tracebuffer.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+
+#if defined( _WIN32 )
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// power of two so the ring index is a mask
+static const uint32_t k_unTraceRingEvents = 64 * 1024;
+static const uint32_t k_unMaxTraceNames = 4096;
+
+struct TraceRing_t
+{
+	uint32_t unThreadIndex;
+	std::atomic< uint64_t > ulHead;	// events ever written; only the owning thread stores
+	TraceEvent_t rEvents[ k_unTraceRingEvents ];
+};
+
+struct TraceRegistry_t
+{
+	std::mutex mutex;
+	const char *rpchNames[ k_unMaxTraceNames ];
+	uint32_t unNames;
+	std::vector< TraceRing_t * > vecRings;	// never freed, so a ring outlives its thread until the trace is written
+};
+
+static TraceRegistry_t &GetRegistry()
+{
+	static TraceRegistry_t *s_pRegistry = []
+	{
+		TraceRegistry_t *pRegistry = new TraceRegistry_t;
+		memset( pRegistry->rpchNames, 0, sizeof( pRegistry->rpchNames ) );
+		pRegistry->rpchNames[ 0 ] = "(too many trace names)";
+		pRegistry->unNames = 1;
+		return pRegistry;
+	}();
+	return *s_pRegistry;
+}
+
+static thread_local TraceRing_t *t_pTraceRing = nullptr;
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+uint16_t Trace_RegisterName( const char *pchName )
+{
+	TraceRegistry_t &registry = GetRegistry();
+	std::lock_guard< std::mutex > lock( registry.mutex );
+	if ( registry.unNames >= k_unMaxTraceNames )
+		return 0;
+
+	registry.rpchNames[ registry.unNames ] = pchName;
+	return (uint16_t)registry.unNames++;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Ids are only handed out after their slot is written, and slots are
+//			never rewritten, so readers don't need the lock
+//-----------------------------------------------------------------------------
+const char *Trace_GetName( uint16_t unNameId )
+{
+	const char *pchName = unNameId < k_unMaxTraceNames ? GetRegistry().rpchNames[ unNameId ] : NULL;
+	return pchName ? pchName : "";
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+uint64_t Trace_GetTimestamp()
+{
+#if defined( _WIN32 )
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter( &counter );
+	return (uint64_t)counter.QuadPart;
+#else
+	timespec now;
+	clock_gettime( CLOCK_MONOTONIC, &now );
+	return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+#endif
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+uint64_t Trace_GetTimestampFrequency()
+{
+#if defined( _WIN32 )
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency( &frequency );
+	return (uint64_t)frequency.QuadPart;
+#else
+	return 1000000000ull;
+#endif
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Allocates and registers the calling thread's ring
+//-----------------------------------------------------------------------------
+static TraceRing_t *CreateThreadRing()
+{
+	TraceRing_t *pRing = new TraceRing_t;
+	pRing->ulHead.store( 0, std::memory_order_relaxed );
+
+	TraceRegistry_t &registry = GetRegistry();
+	std::lock_guard< std::mutex > lock( registry.mutex );
+	pRing->unThreadIndex = (uint32_t)registry.vecRings.size();
+	registry.vecRings.push_back( pRing );
+
+	t_pTraceRing = pRing;
+	return pRing;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void Trace_Event( uint16_t unNameId, ETraceEventType eType )
+{
+	TraceRing_t *pRing = t_pTraceRing ? t_pTraceRing : CreateThreadRing();
+
+	const uint64_t ulHead = pRing->ulHead.load( std::memory_order_relaxed );
+	TraceEvent_t &event = pRing->rEvents[ ulHead & ( k_unTraceRingEvents - 1 ) ];
+	event.ulTimestamp = Trace_GetTimestamp();
+	event.unNameId = unNameId;
+	event.unType = (uint16_t)eType;
+	event.unReserved = 0;
+
+	// publishes the event to the exporter
+	pRing->ulHead.store( ulHead + 1, std::memory_order_release );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Writes pchString as a JSON string body
+//-----------------------------------------------------------------------------
+static void WriteJsonString( FILE *f, const char *pchString )
+{
+	for ( const char *pch = pchString; *pch; pch++ )
+	{
+		if ( *pch == '"' || *pch == '\\' )
+			fputc( '\\', f );
+		if ( (unsigned char)*pch >= 0x20 )
+			fputc( *pch, f );
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+bool Trace_WriteChromeJson( const std::string &strFilename )
+{
+	TraceRegistry_t &registry = GetRegistry();
+	std::lock_guard< std::mutex > lock( registry.mutex );
+
+	FILE *f;
+#if defined( _WIN32 )
+	if ( fopen_s( &f, strFilename.c_str(), "w" ) != 0 )
+		f = NULL;
+#else
+	f = fopen( strFilename.c_str(), "w" );
+#endif
+	if ( f == NULL )
+		return false;
+
+	// the oldest surviving event across all threads is time zero
+	uint64_t ulBase = UINT64_MAX;
+	for ( TraceRing_t *pRing : registry.vecRings )
+	{
+		const uint64_t ulHead = pRing->ulHead.load( std::memory_order_acquire );
+		const uint64_t ulFirst = ulHead > k_unTraceRingEvents ? ulHead - k_unTraceRingEvents : 0;
+		if ( ulFirst < ulHead && pRing->rEvents[ ulFirst & ( k_unTraceRingEvents - 1 ) ].ulTimestamp < ulBase )
+			ulBase = pRing->rEvents[ ulFirst & ( k_unTraceRingEvents - 1 ) ].ulTimestamp;
+	}
+	const double flMicrosecondsPerTick = 1000000.0 / Trace_GetTimestampFrequency();
+
+	fprintf( f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" );
+	bool bFirst = true;
+	for ( TraceRing_t *pRing : registry.vecRings )
+	{
+		const uint64_t ulHead = pRing->ulHead.load( std::memory_order_acquire );
+		const uint64_t ulFirst = ulHead > k_unTraceRingEvents ? ulHead - k_unTraceRingEvents : 0;
+
+		// once the ring has wrapped, ends can survive their begins; viewers don't like those
+		uint32_t unDepth = 0;
+		for ( uint64_t i = ulFirst; i < ulHead; i++ )
+		{
+			const TraceEvent_t &event = pRing->rEvents[ i & ( k_unTraceRingEvents - 1 ) ];
+			if ( event.unType == TraceEvent_End )
+			{
+				if ( unDepth == 0 )
+					continue;
+				unDepth--;
+			}
+			else
+			{
+				unDepth++;
+			}
+
+			fprintf( f, "%s{\"name\":\"", bFirst ? "" : ",\n" );
+			WriteJsonString( f, Trace_GetName( event.unNameId ) );
+			fprintf( f, "\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+				event.unType == TraceEvent_End ? 'E' : 'B', ( event.ulTimestamp - ulBase ) * flMicrosecondsPerTick, pRing->unThreadIndex );
+			bFirst = false;
+		}
+	}
+	fprintf( f, "\n]}\n" );
+
+	return fclose( f ) == 0;
+}
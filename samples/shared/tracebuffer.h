@@ -0,0 +1,41 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+enum ETraceEventType
+{
+	TraceEvent_Begin = 0,
+	TraceEvent_End = 1,
+};
+
+/** One ring entry. 16 bytes so a ring of 64K events per thread is 1MB. */
+struct TraceEvent_t
+{
+	uint64_t ulTimestamp;	// Trace_GetTimestamp() ticks
+	uint16_t unNameId;
+	uint16_t unType;		// ETraceEventType
+	uint32_t unReserved;
+};
+
+/** Returns the id that stands for pchName in the trace. pchName is kept, not copied, so it
+* must live until the trace is written; string literals are the intent. Takes a lock, so
+* register once per call site, as TRACE_NAME_ID in tracebackend.h does. */
+uint16_t Trace_RegisterName( const char *pchName );
+
+/** The name registered for an id Trace_RegisterName returned. Doesn't lock. */
+const char *Trace_GetName( uint16_t unNameId );
+
+/** Monotonic ticks (QueryPerformanceCounter or CLOCK_MONOTONIC) and ticks per second */
+uint64_t Trace_GetTimestamp();
+uint64_t Trace_GetTimestampFrequency();
+
+/** Appends an event to the calling thread's ring, overwriting the oldest once it is full.
+* A thread's first event allocates its ring; after that recording never allocates or locks. */
+void Trace_Event( uint16_t unNameId, ETraceEventType eType );
+
+/** Writes every thread's events as Chrome trace event JSON, which chrome://tracing and
+* ui.perfetto.dev both open. Meant for shutdown: threads still recording while this runs
+* may have their newest events missed or torn. */
+bool Trace_WriteChromeJson( const std::string &strFilename );
@@ -0,0 +1,143 @@
+//========= Copyright Valve Corporation ============//
+#include "trackeddevicetable.h"
+
+#include <algorithm>
+#include <cstring>
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+CTrackedDeviceTable::CTrackedDeviceTable()
+	: m_unValidPoses( 0 )
+{
+	Reserve( vr::k_unMaxTrackedDeviceCount );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Grows every per-device array together; never shrinks
+//-----------------------------------------------------------------------------
+void CTrackedDeviceTable::Reserve( uint32_t unCapacity )
+{
+	if ( unCapacity <= GetCapacity() )
+		return;
+
+	vr::HmdMatrix34_t matZero;
+	memset( &matZero, 0, sizeof( matZero ) );
+	vr::HmdVector3_t vecZero = { { 0.0f, 0.0f, 0.0f } };
+
+	m_vecDeviceToAbsoluteTracking.resize( unCapacity, matZero );
+	m_vecVelocity.resize( unCapacity, vecZero );
+	m_vecAngularVelocity.resize( unCapacity, vecZero );
+	m_vecTrackingResult.resize( unCapacity, vr::TrackingResult_Uninitialized );
+	m_vecPoseValid.resize( unCapacity, 0 );
+	m_vecClass.resize( unCapacity, vr::TrackedDeviceClass_Invalid );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Also updates the class of a device that is already connected
+//-----------------------------------------------------------------------------
+void CTrackedDeviceTable::SetDeviceConnected( vr::TrackedDeviceIndex_t unDevice, vr::ETrackedDeviceClass eClass )
+{
+	if ( unDevice == vr::k_unTrackedDeviceIndexInvalid || eClass == vr::TrackedDeviceClass_Invalid )
+		return;
+
+	if ( unDevice >= GetCapacity() )
+		Reserve( std::max( unDevice + 1, GetCapacity() * 2 ) );
+
+	if ( !IsDeviceConnected( unDevice ) )
+		m_vecConnected.insert( std::lower_bound( m_vecConnected.begin(), m_vecConnected.end(), unDevice ), unDevice );
+	m_vecClass[ unDevice ] = eClass;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CTrackedDeviceTable::SetDeviceDisconnected( vr::TrackedDeviceIndex_t unDevice )
+{
+	if ( !IsDeviceConnected( unDevice ) )
+		return;
+
+	m_vecConnected.erase( std::lower_bound( m_vecConnected.begin(), m_vecConnected.end(), unDevice ) );
+	m_vecClass[ unDevice ] = vr::TrackedDeviceClass_Invalid;
+	SetPoseValid( unDevice, false );
+	m_vecTrackingResult[ unDevice ] = vr::TrackingResult_Uninitialized;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Keeps m_unValidPoses in step so it never needs a pass to count
+//-----------------------------------------------------------------------------
+void CTrackedDeviceTable::SetPoseValid( vr::TrackedDeviceIndex_t unDevice, bool bValid )
+{
+	const uint8_t ubValid = bValid ? 1 : 0;
+	if ( m_vecPoseValid[ unDevice ] == ubValid )
+		return;
+
+	m_vecPoseValid[ unDevice ] = ubValid;
+	if ( bValid )
+		m_unValidPoses++;
+	else
+		m_unValidPoses--;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+void CTrackedDeviceTable::UpdatePoses( const vr::TrackedDevicePose_t *pPoses, uint32_t unCount )
+{
+	for ( vr::TrackedDeviceIndex_t unDevice : m_vecConnected )
+	{
+		if ( unDevice < unCount )
+		{
+			UpdatePose( unDevice, pPoses[ unDevice ] );
+		}
+		else
+		{
+			SetPoseValid( unDevice, false );
+			m_vecTrackingResult[ unDevice ] = vr::TrackingResult_Uninitialized;
+		}
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Poses for devices that aren't connected are ignored
+//-----------------------------------------------------------------------------
+void CTrackedDeviceTable::UpdatePose( vr::TrackedDeviceIndex_t unDevice, const vr::TrackedDevicePose_t &pose )
+{
+	if ( !IsDeviceConnected( unDevice ) )
+		return;
+
+	m_vecDeviceToAbsoluteTracking[ unDevice ] = pose.mDeviceToAbsoluteTracking;
+	m_vecVelocity[ unDevice ] = pose.vVelocity;
+	m_vecAngularVelocity[ unDevice ] = pose.vAngularVelocity;
+	m_vecTrackingResult[ unDevice ] = pose.eTrackingResult;
+	SetPoseValid( unDevice, pose.bPoseIsValid && pose.bDeviceIsConnected );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+uint32_t CTrackedDeviceTable::GetPoseSnapshot( vr::TrackedDevicePose_t *pPoses, vr::TrackedDeviceIndex_t *punDevices, uint32_t unMaxPoses ) const
+{
+	const uint32_t unCopied = std::min( unMaxPoses, GetConnectedCount() );
+	for ( uint32_t i = 0; i < unCopied; i++ )
+	{
+		const vr::TrackedDeviceIndex_t unDevice = m_vecConnected[i];
+		vr::TrackedDevicePose_t &pose = pPoses[i];
+		pose.mDeviceToAbsoluteTracking = m_vecDeviceToAbsoluteTracking[ unDevice ];
+		pose.vVelocity = m_vecVelocity[ unDevice ];
+		pose.vAngularVelocity = m_vecAngularVelocity[ unDevice ];
+		pose.eTrackingResult = m_vecTrackingResult[ unDevice ];
+		pose.bPoseIsValid = m_vecPoseValid[ unDevice ] != 0;
+		pose.bDeviceIsConnected = true;
+		if ( punDevices )
+			punDevices[i] = unDevice;
+	}
+	return GetConnectedCount();
+}
@@ -0,0 +1,62 @@
+//========= Copyright Valve Corporation ============//
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <openvr.h>
+
+//-----------------------------------------------------------------------------
+// Purpose: An application's view of the tracked devices, with room for as many
+//			device indices as connect rather than k_unMaxTrackedDeviceCount.
+//			Each pose field is kept in its own array indexed by device, and the
+//			connected devices in a sorted list, so a pass over the poses touches
+//			only the connected devices and only the fields it reads.
+//-----------------------------------------------------------------------------
+class CTrackedDeviceTable
+{
+public:
+	CTrackedDeviceTable();
+
+	/** How many device indices there is room for. Connecting a device past it grows the table. */
+	uint32_t GetCapacity() const { return (uint32_t)m_vecClass.size(); }
+	void Reserve( uint32_t unCapacity );
+
+	void SetDeviceConnected( vr::TrackedDeviceIndex_t unDevice, vr::ETrackedDeviceClass eClass );
+	void SetDeviceDisconnected( vr::TrackedDeviceIndex_t unDevice );
+	bool IsDeviceConnected( vr::TrackedDeviceIndex_t unDevice ) const { return GetDeviceClass( unDevice ) != vr::TrackedDeviceClass_Invalid; }
+
+	/** TrackedDeviceClass_Invalid for devices that are not connected */
+	vr::ETrackedDeviceClass GetDeviceClass( vr::TrackedDeviceIndex_t unDevice ) const { return unDevice < m_vecClass.size() ? m_vecClass[ unDevice ] : vr::TrackedDeviceClass_Invalid; }
+
+	/** The connected devices in index order */
+	uint32_t GetConnectedCount() const { return (uint32_t)m_vecConnected.size(); }
+	vr::TrackedDeviceIndex_t GetConnectedDevice( uint32_t unConnected ) const { return m_vecConnected[ unConnected ]; }
+
+	/** Takes the poses of the connected devices from an array indexed by device, as filled by
+	* IVRCompositor::WaitGetPoses or IVRSystem::GetDeviceToAbsoluteTrackingPose. Entries for
+	* devices that are not connected are not read; connected devices past unCount lose their pose. */
+	void UpdatePoses( const vr::TrackedDevicePose_t *pPoses, uint32_t unCount );
+	void UpdatePose( vr::TrackedDeviceIndex_t unDevice, const vr::TrackedDevicePose_t &pose );
+
+	bool IsPoseValid( vr::TrackedDeviceIndex_t unDevice ) const { return unDevice < m_vecPoseValid.size() && m_vecPoseValid[ unDevice ] != 0; }
+	uint32_t GetValidPoseCount() const { return m_unValidPoses; }
+	const vr::HmdMatrix34_t &GetDeviceToAbsoluteTracking( vr::TrackedDeviceIndex_t unDevice ) const { return m_vecDeviceToAbsoluteTracking[ unDevice ]; }
+
+	/** Copies the poses of the connected devices, in index order, to the caller's arrays, with
+	* each one's device index if punDevices isn't NULL. Returns the number of connected devices;
+	* if that is more than unMaxPoses only the first unMaxPoses are copied. */
+	uint32_t GetPoseSnapshot( vr::TrackedDevicePose_t *pPoses, vr::TrackedDeviceIndex_t *punDevices, uint32_t unMaxPoses ) const;
+
+private:
+	void SetPoseValid( vr::TrackedDeviceIndex_t unDevice, bool bValid );
+
+	std::vector< vr::HmdMatrix34_t > m_vecDeviceToAbsoluteTracking;
+	std::vector< vr::HmdVector3_t > m_vecVelocity;
+	std::vector< vr::HmdVector3_t > m_vecAngularVelocity;
+	std::vector< vr::ETrackingResult > m_vecTrackingResult;
+	std::vector< uint8_t > m_vecPoseValid;
+	std::vector< vr::ETrackedDeviceClass > m_vecClass;
+	std::vector< vr::TrackedDeviceIndex_t > m_vecConnected;
+	uint32_t m_unValidPoses;
+};
@@ -0,0 +1,866 @@
+//========= Copyright Valve Corporation ============//
+//
+// Times the math, image and path code in samples/shared on synthetic input and writes
+// the numbers as JSON, so a change to one of them can be measured against the build
+// before it. Every case does a fixed batch of operations per sample and keeps taking
+// samples until -mintime has passed; the report gives nanoseconds per operation.
+// Results only compare between runs on the same machine and build configuration.
+//
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openvr.h>
+
+#include "shared/Matrices.h"
+#include "shared/RigidTransform.h"
+#include "shared/lodepng.h"
+#include "shared/pathtools.h"
+
+/** Timings for one case, in nanoseconds per operation */
+struct BenchmarkResult_t
+{
+	std::string sName;
+	uint32_t unSamples;
+	uint32_t unOpsPerSample;
+	double flMeanNs;
+	double flP50Ns;
+	double flP99Ns;
+	double flMinNs;
+};
+
+// Results are folded into this so the optimizer can't drop the work being timed
+static volatile float g_flSink = 0.0f;
+
+// Which Matrix4 kernels Matrices.h picked for this build
+#if defined( MATRICES_AVX )
+static const char *k_pchMatricesKernels = "avx";
+#elif defined( MATRICES_SSE )
+static const char *k_pchMatricesKernels = "sse2";
+#elif defined( MATRICES_NEON )
+static const char *k_pchMatricesKernels = "neon";
+#else
+static const char *k_pchMatricesKernels = "scalar";
+#endif
+
+static const uint32_t k_unMinSamples = 3;
+static const uint32_t k_unMaxSamples = 1000000;
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Sorts vecValues in place
+//-----------------------------------------------------------------------------
+static double GetPercentile( std::vector< double > &vecValues, double flFraction )
+{
+	if ( vecValues.empty() )
+		return 0.0;
+
+	std::sort( vecValues.begin(), vecValues.end() );
+	const size_t unIndex = std::min( vecValues.size() - 1, (size_t)( vecValues.size() * flFraction ) );
+	return vecValues[ unIndex ];
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Runs the cases the filter lets through and keeps their results
+//-----------------------------------------------------------------------------
+class CBenchmarkRunner
+{
+public:
+	CBenchmarkRunner( double flMinSeconds, const char *pchFilter )
+		: m_flMinSeconds( flMinSeconds )
+		, m_sFilter( pchFilter ? pchFilter : "" )
+	{
+	}
+
+	/** Times fnSample, which does unOpsPerSample operations, unless pchName doesn't contain the filter */
+	void Run( const char *pchName, uint32_t unOpsPerSample, const std::function< void() > &fnSample );
+
+	bool WriteReport( const char *pchFilename ) const;
+
+private:
+	double m_flMinSeconds;
+	std::string m_sFilter;
+	std::vector< BenchmarkResult_t > m_vecResults;
+};
+
+
+void CBenchmarkRunner::Run( const char *pchName, uint32_t unOpsPerSample, const std::function< void() > &fnSample )
+{
+	if ( !m_sFilter.empty() && !strstr( pchName, m_sFilter.c_str() ) )
+		return;
+
+	// once untimed, for the caches and any lazily built state
+	fnSample();
+
+	std::vector< double > vecSampleNs;
+	double flTotalNs = 0.0;
+	while ( vecSampleNs.size() < k_unMinSamples || ( flTotalNs < m_flMinSeconds * 1e9 && vecSampleNs.size() < k_unMaxSamples ) )
+	{
+		std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+		fnSample();
+		const double flNs = std::chrono::duration< double, std::nano >( std::chrono::high_resolution_clock::now() - startTime ).count();
+		vecSampleNs.push_back( flNs / unOpsPerSample );
+		flTotalNs += flNs;
+	}
+
+	BenchmarkResult_t result;
+	result.sName = pchName;
+	result.unSamples = (uint32_t)vecSampleNs.size();
+	result.unOpsPerSample = unOpsPerSample;
+	result.flMeanNs = flTotalNs / unOpsPerSample / vecSampleNs.size();
+	result.flP50Ns = GetPercentile( vecSampleNs, 0.5 );
+	result.flP99Ns = GetPercentile( vecSampleNs, 0.99 );
+	result.flMinNs = vecSampleNs.front();
+	m_vecResults.push_back( result );
+
+	printf( "%-40s %12.1f %12.1f %12.1f %8u\n", pchName, result.flP50Ns, result.flP99Ns, result.flMinNs, result.unSamples );
+	fflush( stdout );
+}
+
+
+bool CBenchmarkRunner::WriteReport( const char *pchFilename ) const
+{
+	FILE *f = NULL;
+#if defined( _WIN32 )
+	if ( fopen_s( &f, pchFilename, "w" ) != 0 )
+		f = NULL;
+#else
+	f = fopen( pchFilename, "w" );
+#endif
+	if ( f == NULL )
+		return false;
+
+	fprintf( f, "{\n" );
+	fprintf( f, "  \"min_seconds\": %.3f,\n", m_flMinSeconds );
+	fprintf( f, "  \"matrices_kernels\": \"%s\",\n", k_pchMatricesKernels );
+	fprintf( f, "  \"benchmarks\": [\n" );
+	for ( size_t i = 0; i < m_vecResults.size(); i++ )
+	{
+		const BenchmarkResult_t &result = m_vecResults[i];
+		fprintf( f, "    { \"name\": \"%s\", \"samples\": %u, \"ops_per_sample\": %u, \"mean_ns\": %.2f, \"p50_ns\": %.2f, \"p99_ns\": %.2f, \"min_ns\": %.2f }%s\n",
+			result.sName.c_str(), result.unSamples, result.unOpsPerSample, result.flMeanNs, result.flP50Ns, result.flP99Ns, result.flMinNs,
+			i + 1 < m_vecResults.size() ? "," : "" );
+	}
+	fprintf( f, "  ]\n" );
+	fprintf( f, "}\n" );
+	fclose( f );
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Vector3/Vector4 arithmetic and building Matrix4 transforms
+//-----------------------------------------------------------------------------
+static void RunVectorBenchmarks( CBenchmarkRunner &runner )
+{
+	const uint32_t k_unVectors = 1024;
+
+	std::mt19937 rng( 1 );
+	std::uniform_real_distribution< float > value( -1.0f, 1.0f );
+	std::vector< Vector3 > vecA, vecB;
+	std::vector< Vector4 > vecA4, vecB4;
+	for ( uint32_t i = 0; i < k_unVectors; i++ )
+	{
+		vecA.push_back( Vector3( value( rng ), value( rng ), value( rng ) ) );
+		vecB.push_back( Vector3( value( rng ), value( rng ), value( rng ) ) );
+		vecA4.push_back( Vector4( value( rng ), value( rng ), value( rng ), value( rng ) ) );
+		vecB4.push_back( Vector4( value( rng ), value( rng ), value( rng ), value( rng ) ) );
+	}
+
+	runner.Run( "vector3_dot", k_unVectors, [&]
+	{
+		float flSum = 0.0f;
+		for ( uint32_t i = 0; i < k_unVectors; i++ )
+			flSum += vecA[i].dot( vecB[i] );
+		g_flSink = flSum;
+	} );
+
+	runner.Run( "vector3_cross", k_unVectors, [&]
+	{
+		Vector3 sum;
+		for ( uint32_t i = 0; i < k_unVectors; i++ )
+			sum += vecA[i].cross( vecB[i] );
+		g_flSink = sum.x + sum.y + sum.z;
+	} );
+
+	runner.Run( "vector3_normalize", k_unVectors, [&]
+	{
+		Vector3 sum;
+		for ( uint32_t i = 0; i < k_unVectors; i++ )
+		{
+			Vector3 v = vecA[i];
+			sum += v.normalize();
+		}
+		g_flSink = sum.x + sum.y + sum.z;
+	} );
+
+	runner.Run( "vector4_dot", k_unVectors, [&]
+	{
+		float flSum = 0.0f;
+		for ( uint32_t i = 0; i < k_unVectors; i++ )
+			flSum += vecA4[i].dot( vecB4[i] );
+		g_flSink = flSum;
+	} );
+
+	// what SetupScene does for each cube, and a model matrix per frame
+	runner.Run( "matrix4_translate", k_unVectors, [&]
+	{
+		float flSum = 0.0f;
+		for ( uint32_t i = 0; i < k_unVectors; i++ )
+		{
+			Matrix4 mat;
+			mat.translate( vecA[i] );
+			flSum += mat[12];
+		}
+		g_flSink = flSum;
+	} );
+
+	runner.Run( "matrix4_rotate", k_unVectors, [&]
+	{
+		float flSum = 0.0f;
+		for ( uint32_t i = 0; i < k_unVectors; i++ )
+		{
+			Matrix4 mat;
+			mat.rotate( vecB[i].x * 180.0f, vecA[i] );
+			flSum += mat[0];
+		}
+		g_flSink = flSum;
+	} );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Depends on every element, so none of a result can be skipped
+//-----------------------------------------------------------------------------
+static float SumMatrix( const Matrix4 &mat )
+{
+	float flSum = 0.0f;
+	for ( int i = 0; i < 16; i++ )
+		flSum += mat[i];
+	return flSum;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: A rotation about a random axis, with a scale if flMaxScale > 1, and a translation
+//-----------------------------------------------------------------------------
+static Matrix4 MakeRandomTransform( std::mt19937 &rng, float flMaxScale )
+{
+	std::uniform_real_distribution< float > value( -1.0f, 1.0f );
+	std::uniform_real_distribution< float > scale( 1.0f, flMaxScale );
+
+	Matrix4 mat;
+	mat.scale( scale( rng ), scale( rng ), scale( rng ) );
+	mat.rotate( value( rng ) * 180.0f, value( rng ), value( rng ), value( rng ) + 2.0f );
+	mat.translate( value( rng ) * 5.0f, value( rng ) * 5.0f, value( rng ) * 5.0f );
+	return mat;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Matrix4 multiplies, transforms and each inverse. Which kernels these
+//			time is in the report's matrices_kernels; build with MATRICES_NO_SIMD
+//			to time the scalar reference.
+//-----------------------------------------------------------------------------
+static void RunMatrixBenchmarks( CBenchmarkRunner &runner )
+{
+	const uint32_t k_unMatrices = 256;
+
+	std::mt19937 rng( 2 );
+	std::uniform_real_distribution< float > value( -1.0f, 1.0f );
+
+	// random entries plus a diagonal keep these well away from singular, so no
+	// inverse takes the early out to identity
+	std::vector< Matrix4 > vecGeneral, vecAffine, vecEuclidean, vecProjection;
+	std::vector< Vector4 > vecPoints4;
+	std::vector< Vector3 > vecPoints3;
+	for ( uint32_t i = 0; i < k_unMatrices; i++ )
+	{
+		float rflGeneral[ 16 ];
+		for ( int j = 0; j < 16; j++ )
+			rflGeneral[j] = value( rng ) + ( j % 5 == 0 ? 4.0f : 0.0f );
+		vecGeneral.push_back( Matrix4( rflGeneral ) );
+		vecAffine.push_back( MakeRandomTransform( rng, 3.0f ) );
+		vecEuclidean.push_back( MakeRandomTransform( rng, 1.0f ) );
+
+		// what GetHMDMatrixProjectionEye returns for an eye, times its pose
+		const float flNear = 0.1f, flFar = 30.0f;
+		const float flLeft = -1.0f - 0.2f * value( rng ), flRight = 1.0f + 0.2f * value( rng );
+		const float flTop = 1.0f + 0.2f * value( rng ), flBottom = -1.0f - 0.2f * value( rng );
+		Matrix4 matProjection(
+			2.0f / ( flRight - flLeft ), 0.0f, 0.0f, 0.0f,
+			0.0f, 2.0f / ( flTop - flBottom ), 0.0f, 0.0f,
+			( flRight + flLeft ) / ( flRight - flLeft ), ( flTop + flBottom ) / ( flTop - flBottom ), -flFar / ( flFar - flNear ), -1.0f,
+			0.0f, 0.0f, -flFar * flNear / ( flFar - flNear ), 0.0f );
+		vecProjection.push_back( matProjection * vecEuclidean.back() );
+
+		vecPoints4.push_back( Vector4( value( rng ), value( rng ), value( rng ), 1.0f ) );
+		vecPoints3.push_back( Vector3( value( rng ), value( rng ), value( rng ) ) );
+	}
+
+	runner.Run( "matrix4_multiply", k_unMatrices, [&]
+	{
+		Matrix4 sum;
+		for ( uint32_t i = 0; i < k_unMatrices; i++ )
+			sum += vecEuclidean[i] * vecAffine[i];
+		g_flSink = SumMatrix( sum );
+	} );
+
+	// accumulating, so each multiply depends on the one before it
+	runner.Run( "matrix4_multiply_chain", k_unMatrices, [&]
+	{
+		Matrix4 mat;
+		for ( uint32_t i = 0; i < k_unMatrices; i++ )
+			mat *= vecEuclidean[i];
+		g_flSink = SumMatrix( mat );
+	} );
+
+	runner.Run( "matrix4_transform_vector4", k_unMatrices, [&]
+	{
+		Vector4 sum;
+		for ( uint32_t i = 0; i < k_unMatrices; i++ )
+			sum += vecProjection[i] * vecPoints4[i];
+		g_flSink = sum.x + sum.y + sum.z + sum.w;
+	} );
+
+	runner.Run( "matrix4_transform_vector3", k_unMatrices, [&]
+	{
+		Vector3 sum;
+		for ( uint32_t i = 0; i < k_unMatrices; i++ )
+			sum += vecAffine[i] * vecPoints3[i];
+		g_flSink = sum.x + sum.y + sum.z;
+	} );
+
+	runner.Run( "matrix4_premultiply_vector4", k_unMatrices, [&]
+	{
+		Vector4 sum;
+		for ( uint32_t i = 0; i < k_unMatrices; i++ )
+			sum += vecPoints4[i] * vecProjection[i];
+		g_flSink = sum.x + sum.y + sum.z + sum.w;
+	} );
+
+	struct InvertCase_t
+	{
+		const char *pchName;
+		const std::vector< Matrix4 > *pvecMatrices;
+		Matrix4 &( Matrix4::*pfnInvert )();
+	};
+	const InvertCase_t rInvertCases[] =
+	{
+		{ "matrix4_invert_general", &vecGeneral, &Matrix4::invertGeneral },
+		{ "matrix4_invert_affine", &vecAffine, &Matrix4::invertAffine },
+		{ "matrix4_invert_euclidean", &vecEuclidean, &Matrix4::invertEuclidean },
+		{ "matrix4_invert_projective", &vecGeneral, &Matrix4::invertProjective },
+		// invert() picks invertAffine for these and invertGeneral for projections
+		{ "matrix4_invert_affine_input", &vecAffine, &Matrix4::invert },
+		{ "matrix4_invert_projection_input", &vecProjection, &Matrix4::invert },
+	};
+	for ( const InvertCase_t &invertCase : rInvertCases )
+	{
+		runner.Run( invertCase.pchName, k_unMatrices, [&]
+		{
+			Matrix4 sum;
+			for ( uint32_t i = 0; i < k_unMatrices; i++ )
+			{
+				Matrix4 mat = ( *invertCase.pvecMatrices )[i];
+				sum += ( mat.*invertCase.pfnInvert )();
+			}
+			g_flSink = SumMatrix( sum );
+		} );
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Depends on every element of the rotation and translation
+//-----------------------------------------------------------------------------
+static float SumRigidTransform( const RigidTransform<> &xform )
+{
+	float flSum = xform.getTranslation().x + xform.getTranslation().y + xform.getTranslation().z;
+	for ( int i = 0; i < 9; i++ )
+		flSum += xform.getRotation()[i];
+	return flSum;
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: How hellovr turned a tracked pose into a Matrix4 before it used
+//			RigidTransform
+//-----------------------------------------------------------------------------
+static Matrix4 ConvertSteamVRMatrixToMatrix4( const vr::HmdMatrix34_t &matPose )
+{
+	return Matrix4(
+		matPose.m[0][0], matPose.m[1][0], matPose.m[2][0], 0.0f,
+		matPose.m[0][1], matPose.m[1][1], matPose.m[2][1], 0.0f,
+		matPose.m[0][2], matPose.m[1][2], matPose.m[2][2], 0.0f,
+		matPose.m[0][3], matPose.m[1][3], matPose.m[2][3], 1.0f );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: RigidTransform against the Matrix4 code it replaced for tracked
+//			poses: converting and inverting a pose, composing, and building a
+//			view projection matrix
+//-----------------------------------------------------------------------------
+static void RunRigidTransformBenchmarks( CBenchmarkRunner &runner )
+{
+	const uint32_t k_unPoses = 256;
+
+	std::mt19937 rng( 4 );
+	std::vector< vr::HmdMatrix34_t > vecPoses( k_unPoses );
+	std::vector< RigidTransform<> > vecRigid, vecEyes;
+	std::vector< Matrix4 > vecMatrices, vecEyeMatrices;
+	for ( uint32_t i = 0; i < k_unPoses; i++ )
+	{
+		const Matrix4 mat = MakeRandomTransform( rng, 1.0f );
+		for ( int nRow = 0; nRow < 3; nRow++ )
+		{
+			for ( int nCol = 0; nCol < 4; nCol++ )
+				vecPoses[i].m[nRow][nCol] = mat[ nCol * 4 + nRow ];
+		}
+		vecRigid.push_back( RigidTransform<>::fromHmdMatrix34( vecPoses[i] ) );
+		vecMatrices.push_back( ConvertSteamVRMatrixToMatrix4( vecPoses[i] ) );
+
+		// eye to head is a small offset with, on some headsets, a canted rotation
+		const RigidTransform<> eye = RigidTransform<>::fromQuaternion( 1.0, 0.0, 0.05 * ( i & 1 ? 1 : -1 ), 0.0, i & 1 ? 0.032 : -0.032, 0.0, 0.015 );
+		vecEyes.push_back( eye );
+		vecEyeMatrices.push_back( eye.toMatrix4() );
+	}
+	const Matrix4 matProjection(
+		0.75f, 0.0f, 0.0f, 0.0f,
+		0.0f, 0.68f, 0.0f, 0.0f,
+		-0.06f, 0.0f, -1.003f, -1.0f,
+		0.0f, 0.0f, -0.1003f, 0.0f );
+
+	// UpdateHMDMatrixPose, before and after
+	runner.Run( "pose_matrix4_convert_invert", k_unPoses, [&]
+	{
+		Matrix4 sum;
+		for ( uint32_t i = 0; i < k_unPoses; i++ )
+			sum += ConvertSteamVRMatrixToMatrix4( vecPoses[i] ).invert();
+		g_flSink = SumMatrix( sum );
+	} );
+
+	runner.Run( "pose_rigid_from_hmd_matrix34_inverse", k_unPoses, [&]
+	{
+		float flSum = 0.0f;
+		for ( uint32_t i = 0; i < k_unPoses; i++ )
+			flSum += SumRigidTransform( RigidTransform<>::fromHmdMatrix34( vecPoses[i] ).inverse() );
+		g_flSink = flSum;
+	} );
+
+	runner.Run( "rigid_transform_compose", k_unPoses, [&]
+	{
+		float flSum = 0.0f;
+		for ( uint32_t i = 0; i < k_unPoses; i++ )
+			flSum += SumRigidTransform( vecEyes[i] * vecRigid[i] );
+		g_flSink = flSum;
+	} );
+
+	runner.Run( "rigid_transform_inverse", k_unPoses, [&]
+	{
+		float flSum = 0.0f;
+		for ( uint32_t i = 0; i < k_unPoses; i++ )
+			flSum += SumRigidTransform( vecRigid[i].inverse() );
+		g_flSink = flSum;
+	} );
+
+	// GetCurrentViewProjectionMatrix, before and after
+	runner.Run( "view_projection_matrix4", k_unPoses, [&]
+	{
+		Matrix4 sum;
+		for ( uint32_t i = 0; i < k_unPoses; i++ )
+			sum += matProjection * vecEyeMatrices[i] * vecMatrices[i];
+		g_flSink = SumMatrix( sum );
+	} );
+
+	runner.Run( "view_projection_rigid", k_unPoses, [&]
+	{
+		Matrix4 sum;
+		for ( uint32_t i = 0; i < k_unPoses; i++ )
+			sum += matProjection * ( vecEyes[i] * vecRigid[i] );
+		g_flSink = SumMatrix( sum );
+	} );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: An RGBA image with gradients, hard edges and a little noise, so the
+//			filters and LZ77 both have something to do
+//-----------------------------------------------------------------------------
+static std::vector< unsigned char > MakeTestImage( unsigned nWidth, unsigned nHeight, uint32_t unSeed )
+{
+	std::mt19937 rng( unSeed );
+	std::vector< unsigned char > vecPixels( nWidth * nHeight * 4 );
+	for ( unsigned y = 0; y < nHeight; y++ )
+	{
+		for ( unsigned x = 0; x < nWidth; x++ )
+		{
+			unsigned char *pPixel = &vecPixels[ ( y * nWidth + x ) * 4 ];
+			const unsigned nNoise = rng() & 7;
+			pPixel[0] = (unsigned char)( x * 255 / nWidth + nNoise );
+			pPixel[1] = (unsigned char)( y * 255 / nHeight );
+			pPixel[2] = (unsigned char)( ( ( x / 8 + y / 8 + unSeed ) & 1 ) ? 200 : 40 );
+			pPixel[3] = (unsigned char)( ( x + y ) < ( nWidth + nHeight ) / 8 ? 0 : 255 );
+		}
+	}
+	return vecPixels;
+}
+
+
+struct CompressionSetting_t
+{
+	const char *pchName;
+	unsigned nBlockType;
+	unsigned bUseLZ77;
+	unsigned nWindowSize;
+};
+
+static const CompressionSetting_t k_rCompressionSettings[] =
+{
+	{ "store", 0, 0, 2048 },
+	{ "fast", 2, 1, 256 },
+	{ "default", 2, 1, 2048 },
+	{ "best", 2, 1, 32768 },
+};
+
+
+//-----------------------------------------------------------------------------
+// Purpose: lodepng encode and decode at each size and compression setting.
+//			Decoding is timed on the output of each setting because how the
+//			file was compressed changes how much inflate has to do.
+//-----------------------------------------------------------------------------
+static void RunLodePNGBenchmarks( CBenchmarkRunner &runner )
+{
+	static const unsigned k_rnSizes[] = { 32, 128, 512 };
+
+	for ( unsigned nSize : k_rnSizes )
+	{
+		const std::vector< unsigned char > vecPixels = MakeTestImage( nSize, nSize, nSize );
+
+		for ( const CompressionSetting_t &setting : k_rCompressionSettings )
+		{
+			lodepng::State state;
+			state.encoder.zlibsettings.btype = setting.nBlockType;
+			state.encoder.zlibsettings.use_lz77 = setting.bUseLZ77;
+			state.encoder.zlibsettings.windowsize = setting.nWindowSize;
+
+			std::vector< unsigned char > vecPNG;
+			if ( lodepng::encode( vecPNG, vecPixels, nSize, nSize, state ) != 0 )
+			{
+				fprintf( stderr, "Unable to encode the %ux%u test image\n", nSize, nSize );
+				continue;
+			}
+
+			char rchName[ 64 ];
+			snprintf( rchName, sizeof( rchName ), "lodepng_encode_%u_%s", nSize, setting.pchName );
+			runner.Run( rchName, 1, [&]
+			{
+				std::vector< unsigned char > vecOut;
+				lodepng::encode( vecOut, vecPixels, nSize, nSize, state );
+				g_flSink = (float)vecOut.size();
+			} );
+
+			snprintf( rchName, sizeof( rchName ), "lodepng_decode_%u_%s", nSize, setting.pchName );
+			runner.Run( rchName, 1, [&]
+			{
+				std::vector< unsigned char > vecOut;
+				unsigned nWidth, nHeight;
+				lodepng::decode( vecOut, nWidth, nHeight, vecPNG );
+				g_flSink = (float)vecOut.size();
+			} );
+		}
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Decoding a few hundred icon sized PNGs, as for overlays and
+//			notifications, with lodepng's allocations going to the heap and to
+//			a lodepng::Arena that is reset after each image
+//-----------------------------------------------------------------------------
+static void RunIconDecodeBenchmarks( CBenchmarkRunner &runner )
+{
+	const uint32_t k_unIcons = 256;
+
+	std::vector< std::vector< unsigned char > > vecIcons;
+	for ( uint32_t i = 0; i < k_unIcons; i++ )
+	{
+		const unsigned nSize = 16 + ( i % 3 ) * 16;
+		std::vector< unsigned char > vecPNG;
+		if ( lodepng::encode( vecPNG, MakeTestImage( nSize, nSize, i ), nSize, nSize ) != 0 )
+		{
+			fprintf( stderr, "Unable to encode the %ux%u test icon\n", nSize, nSize );
+			return;
+		}
+		vecIcons.push_back( vecPNG );
+	}
+
+	// a State per icon, as a loader would keep one per image
+	std::vector< unsigned char > vecPixels;
+	runner.Run( "lodepng_decode_icons_heap", k_unIcons, [&]
+	{
+		for ( const std::vector< unsigned char > &vecPNG : vecIcons )
+		{
+			lodepng::State state;
+			unsigned nWidth, nHeight;
+			lodepng::decode( vecPixels, nWidth, nHeight, state, vecPNG );
+		}
+		g_flSink = (float)vecPixels.size();
+	} );
+
+	lodepng::Arena arena;
+	runner.Run( "lodepng_decode_icons_arena", k_unIcons, [&]
+	{
+		for ( const std::vector< unsigned char > &vecPNG : vecIcons )
+		{
+			{
+				lodepng::State state;
+				state.decoder.allocator = arena.get_allocator();
+				unsigned nWidth, nHeight;
+				lodepng::decode( vecPixels, nWidth, nHeight, state, vecPNG );
+			}
+			arena.reset();
+		}
+		g_flSink = (float)vecPixels.size();
+	} );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: The Path_* string helpers on render model and resource style paths
+//-----------------------------------------------------------------------------
+static void RunPathBenchmarks( CBenchmarkRunner &runner )
+{
+	const std::string sBase = Path_Join( Path_GetSlash() == '\\' ? "C:" : "", "Program Files (x86)", "Steam", "steamapps", "common" );
+	std::vector< std::string > vecPaths;
+	vecPaths.push_back( Path_Join( sBase, "SteamVR", "resources", "rendermodels", Path_Join( "vr_controller_vive_1_5", "body.obj" ) ) );
+	vecPaths.push_back( Path_Join( sBase, "SteamVR", "resources", "textures", "overlay_notification_icon.png" ) );
+	vecPaths.push_back( Path_Join( sBase, "SteamVR", "bin", "win32", "openvr_api.dll" ) );
+	vecPaths.push_back( Path_Join( "samples", "bin", "cube_texture.png" ) );
+	vecPaths.push_back( Path_Join( "..", "shared", "..", "bin", Path_Join( ".", "hellovr_benchmark.json" ) ) );
+	vecPaths.push_back( "samples/bin\\win32/../win64\\./hellovr_opengl.exe" );
+	const uint32_t unPaths = (uint32_t)vecPaths.size();
+
+	runner.Run( "path_strip_filename", unPaths, [&]
+	{
+		size_t nLength = 0;
+		for ( const std::string &sPath : vecPaths )
+			nLength += Path_StripFilename( sPath ).size();
+		g_flSink = (float)nLength;
+	} );
+
+	runner.Run( "path_strip_directory", unPaths, [&]
+	{
+		size_t nLength = 0;
+		for ( const std::string &sPath : vecPaths )
+			nLength += Path_StripDirectory( sPath ).size();
+		g_flSink = (float)nLength;
+	} );
+
+	runner.Run( "path_strip_extension", unPaths, [&]
+	{
+		size_t nLength = 0;
+		for ( const std::string &sPath : vecPaths )
+			nLength += Path_StripExtension( sPath ).size();
+		g_flSink = (float)nLength;
+	} );
+
+	runner.Run( "path_fix_slashes", unPaths, [&]
+	{
+		size_t nLength = 0;
+		for ( const std::string &sPath : vecPaths )
+			nLength += Path_FixSlashes( sPath ).size();
+		g_flSink = (float)nLength;
+	} );
+
+	runner.Run( "path_compact", unPaths, [&]
+	{
+		size_t nLength = 0;
+		for ( const std::string &sPath : vecPaths )
+			nLength += Path_Compact( Path_FixSlashes( sPath ) ).size();
+		g_flSink = (float)nLength;
+	} );
+
+	runner.Run( "path_join", unPaths, [&]
+	{
+		size_t nLength = 0;
+		for ( const std::string &sPath : vecPaths )
+			nLength += Path_Join( sPath, "textures", "icon.png" ).size();
+		g_flSink = (float)nLength;
+	} );
+
+	runner.Run( "path_make_absolute", unPaths, [&]
+	{
+		size_t nLength = 0;
+		for ( const std::string &sPath : vecPaths )
+			nLength += Path_MakeAbsolute( Path_StripDirectory( sPath ), sBase ).size();
+		g_flSink = (float)nLength;
+	} );
+
+	runner.Run( "path_is_absolute", unPaths, [&]
+	{
+		size_t nAbsolute = 0;
+		for ( const std::string &sPath : vecPaths )
+			nAbsolute += Path_IsAbsolute( sPath ) ? 1 : 0;
+		g_flSink = (float)nAbsolute;
+	} );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Extrapolates every pose by its velocities, the way an application
+//			predicts a TrackedDevicePose_t forward to the time of a later photon
+//-----------------------------------------------------------------------------
+static void PredictPoses( const vr::TrackedDevicePose_t *pPoses, uint32_t unCount, float flSeconds, vr::HmdMatrix34_t *pPredicted )
+{
+	for ( uint32_t unDevice = 0; unDevice < unCount; unDevice++ )
+	{
+		const vr::TrackedDevicePose_t &pose = pPoses[ unDevice ];
+		vr::HmdMatrix34_t &predicted = pPredicted[ unDevice ];
+		if ( !pose.bPoseIsValid )
+		{
+			predicted = pose.mDeviceToAbsoluteTracking;
+			continue;
+		}
+
+		// rotation by |w| * t about w, applied in tracking space
+		const vr::HmdVector3_t &w = pose.vAngularVelocity;
+		const float flSpeed = sqrtf( w.v[0] * w.v[0] + w.v[1] * w.v[1] + w.v[2] * w.v[2] );
+		float rflDelta[ 3 ][ 3 ] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+		if ( flSpeed > 1e-6f )
+		{
+			const float flAngle = flSpeed * flSeconds;
+			const float x = w.v[0] / flSpeed, y = w.v[1] / flSpeed, z = w.v[2] / flSpeed;
+			const float s = sinf( flAngle ), c = cosf( flAngle ), t = 1.0f - c;
+			rflDelta[0][0] = t * x * x + c;      rflDelta[0][1] = t * x * y - s * z;  rflDelta[0][2] = t * x * z + s * y;
+			rflDelta[1][0] = t * x * y + s * z;  rflDelta[1][1] = t * y * y + c;      rflDelta[1][2] = t * y * z - s * x;
+			rflDelta[2][0] = t * x * z - s * y;  rflDelta[2][1] = t * y * z + s * x;  rflDelta[2][2] = t * z * z + c;
+		}
+
+		const vr::HmdMatrix34_t &mat = pose.mDeviceToAbsoluteTracking;
+		for ( int nRow = 0; nRow < 3; nRow++ )
+		{
+			for ( int nCol = 0; nCol < 3; nCol++ )
+				predicted.m[nRow][nCol] = rflDelta[nRow][0] * mat.m[0][nCol] + rflDelta[nRow][1] * mat.m[1][nCol] + rflDelta[nRow][2] * mat.m[2][nCol];
+			predicted.m[nRow][3] = mat.m[nRow][3] + pose.vVelocity.v[nRow] * flSeconds;
+		}
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose: Predicting a full set of synthetic device poses ahead, as an
+//			application would for each frame
+//-----------------------------------------------------------------------------
+static void RunPosePredictionBenchmarks( CBenchmarkRunner &runner )
+{
+	static const uint32_t k_rnDeviceCounts[] = { 3, 16, 64 };
+
+	std::mt19937 rng( 3 );
+	std::uniform_real_distribution< float > value( -1.0f, 1.0f );
+
+	for ( uint32_t unDevices : k_rnDeviceCounts )
+	{
+		std::vector< vr::TrackedDevicePose_t > vecPoses( unDevices );
+		for ( uint32_t unDevice = 0; unDevice < unDevices; unDevice++ )
+		{
+			vr::TrackedDevicePose_t &pose = vecPoses[ unDevice ];
+			memset( &pose, 0, sizeof( pose ) );
+
+			Matrix4 mat;
+			mat.rotate( value( rng ) * 180.0f, value( rng ), value( rng ), value( rng ) + 2.0f );
+			for ( int nRow = 0; nRow < 3; nRow++ )
+			{
+				for ( int nCol = 0; nCol < 3; nCol++ )
+					pose.mDeviceToAbsoluteTracking.m[nRow][nCol] = mat[ nCol * 4 + nRow ];
+				pose.mDeviceToAbsoluteTracking.m[nRow][3] = value( rng ) * 2.0f;
+				pose.vVelocity.v[nRow] = value( rng );
+				pose.vAngularVelocity.v[nRow] = value( rng ) * 3.0f;
+			}
+			pose.eTrackingResult = vr::TrackingResult_Running_OK;
+			// a few devices without a pose, as when one is out of view
+			pose.bPoseIsValid = ( unDevice % 8 ) != 7;
+			pose.bDeviceIsConnected = true;
+		}
+
+		std::vector< vr::HmdMatrix34_t > vecPredicted( unDevices );
+		char rchName[ 64 ];
+		snprintf( rchName, sizeof( rchName ), "pose_predict_%u_devices", unDevices );
+		runner.Run( rchName, unDevices, [&]
+		{
+			PredictPoses( &vecPoses[0], unDevices, 0.011f, &vecPredicted[0] );
+			g_flSink = vecPredicted[ unDevices - 1 ].m[0][3];
+		} );
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+static void PrintUsage()
+{
+	fprintf( stderr, "Usage: shared_benchmark [options]\n" );
+	fprintf( stderr, "  -filter <text>    only run the cases whose name contains this\n" );
+	fprintf( stderr, "  -mintime <ms>     keep sampling each case for at least this long (200)\n" );
+	fprintf( stderr, "  -report <file>    where to write the JSON results (shared_benchmark.json)\n" );
+}
+
+
+//-----------------------------------------------------------------------------
+// Purpose:
+//-----------------------------------------------------------------------------
+int main( int argc, char *argv[] )
+{
+	double flMinMs = 200.0;
+	const char *pchFilter = NULL;
+	const char *pchReport = "shared_benchmark.json";
+
+	for ( int i = 1; i < argc; i++ )
+	{
+		const bool bHasValue = i + 1 < argc;
+		if ( !strcmp( argv[i], "-filter" ) && bHasValue )
+			pchFilter = argv[ ++i ];
+		else if ( !strcmp( argv[i], "-mintime" ) && bHasValue )
+			flMinMs = atof( argv[ ++i ] );
+		else if ( !strcmp( argv[i], "-report" ) && bHasValue )
+			pchReport = argv[ ++i ];
+		else
+		{
+			PrintUsage();
+			return 2;
+		}
+	}
+	if ( flMinMs < 0.0 )
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	CBenchmarkRunner runner( flMinMs / 1000.0, pchFilter );
+	printf( "%-40s %12s %12s %12s %8s\n", "ns per op", "p50", "p99", "min", "samples" );
+	RunVectorBenchmarks( runner );
+	RunMatrixBenchmarks( runner );
+	RunRigidTransformBenchmarks( runner );
+	RunLodePNGBenchmarks( runner );
+	RunIconDecodeBenchmarks( runner );
+	RunPathBenchmarks( runner );
+	RunPosePredictionBenchmarks( runner );
+
+	if ( !runner.WriteReport( pchReport ) )
+	{
+		fprintf( stderr, "Unable to write %s\n", pchReport );
+		return 1;
+	}
+	printf( "Wrote %s\n", pchReport );
+	return 0;
+}